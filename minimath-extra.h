@@ -5,50 +5,43 @@
 // replacement, and I'm not going to be thorough and I'm not going to add tests
 // until I do that.
 
+#include "minimath.h"
 
-// Upper triangle is stored, in the usual row-major order.
+
+// Upper triangle is stored, in the usual row-major order. These are lookups in
+// the minimath_index_symNN tables from minimath_generated.h: no branches, and
+// the compiler folds them away when i,j are known
 __attribute__((unused))
-static
+static inline
 int index_sym33(int i, int j)
 {
-    // In the top-right triangle I have i<=j, and
-    //   index = N*i+j - sum(i, i=0..i)
-    //         = N*i+j - (i+1)*i/2
-    //         = (N*2 - i - 1)*i/2 + j
-    const int N=3;
-    if(i<=j) return (N*2-i-1)*i/2 + j;
-    else     return (N*2-j-1)*j/2 + i;
+    return minimath_index_sym33[i*3 + j];
 }
 __attribute__((unused))
-static
+static inline
 int index_sym33_assume_upper(int i, int j)
 {
-    const int N=3;
-    return (N*2-i-1)*i/2 + j;
+    return minimath_index_sym33[i*3 + j];
 }
 
 // Upper triangle is stored, in the usual row-major order.
 __attribute__((unused))
-static
+static inline
 int index_sym66(int i, int j)
 {
-    // In the top-right triangle I have i<=j, and
-    //   index = N*i+j - sum(i, i=0..i)
-    //         = N*i+j - (i+1)*i/2
-    //         = (N*2 - i - 1)*i/2 + j
-    const int N=6;
-    if(i<=j) return (N*2-i-1)*i/2 + j;
-    else     return (N*2-j-1)*j/2 + i;
+    return minimath_index_sym66[i*6 + j];
 }
 __attribute__((unused))
-static
+static inline
 int index_sym66_assume_upper(int i, int j)
 {
-    const int N=6;
-    return (N*2-i-1)*i/2 + j;
+    return minimath_index_sym66[i*6 + j];
 }
+// The 3x3-block-in-sym66 helpers. These are wrappers around the unrolled
+// block kernels in minimath_generated.h, which are available for other block
+// and matrix sizes also
 __attribute__((unused))
-static
+static inline
 void mul_gen33_gen33insym66(// output
                             double* restrict P, int P_strideelems0, int P_strideelems1,
                             // input
@@ -56,22 +49,15 @@ void mul_gen33_gen33insym66(// output
                             const double* Bsym66, int B_i0, int B_j0,
                             const double scale)
 {
-    for(int iout=0; iout<3; iout++)
-        for(int jout=0; jout<3; jout++)
-        {
-            P[iout*P_strideelems0 + jout*P_strideelems1] = 0;
-            for(int k=0; k<3; k++)
-            {
-                P[iout*P_strideelems0 + jout*P_strideelems1] +=
-                    A[iout*A_strideelems0 + k*A_strideelems1] *
-                    Bsym66[index_sym66(k+B_i0, jout+B_j0)];
-            }
-            P[iout*P_strideelems0 + jout*P_strideelems1] *= scale;
-        }
+    mul_gen33_block33_sym66(P, P_strideelems0, P_strideelems1,
+                            A, A_strideelems0, A_strideelems1,
+                            Bsym66, B_i0, B_j0, scale);
 }
-// Assumes the output is symmetric, and only computes the upper triangle
+// Assumes the output is symmetric, and only computes the upper triangle. To
+// accumulate normal equations from whole rows of a Jacobian, the unrolled
+// normal_accum_genK6() in minimath_generated.h is much faster
 __attribute__((unused))
-static
+static inline
 void mul_gen33_gen33_into33insym66_accum(// output
                                          double* restrict Psym66, int P_i0, int P_j0,
                                          // input
@@ -79,1832 +65,33 @@ void mul_gen33_gen33_into33insym66_accum(// output
                                          const double* B, int B_strideelems0, int B_strideelems1,
                                          const double scale)
 {
-    for(int iout=0; iout<3; iout++)
-        for(int jout=0; jout<3; jout++)
-        {
-            if(jout + P_j0 < iout + P_i0)
-            {
-                // Wrong triangle. Set it up to look at the right triangle
-                // during the next loop interation
-                jout = iout + P_i0 - P_j0 - 1;
-                continue;
-            }
-
-            for(int k=0; k<3; k++)
-            {
-                Psym66[index_sym66_assume_upper(iout+P_i0, jout+P_j0)] +=
-                    A[iout*A_strideelems0 + k   *A_strideelems1] *
-                    B[k   *B_strideelems0 + jout*B_strideelems1] * scale;
-            }
-        }
+    mul_gen33_gen33_accum_block33_sym66(Psym66, P_i0, P_j0,
+                                        A, A_strideelems0, A_strideelems1,
+                                        B, B_strideelems0, B_strideelems1,
+                                        scale);
 }
 __attribute__((unused))
-static
+static inline
 void set_gen33_from_gen33insym66(// output
                                  double* restrict P, int P_strideelems0, int P_strideelems1,
                                  // input
                                  const double* Msym66, int M_i0, int M_j0,
                                  const double scale)
 {
-    for(int iout=0; iout<3; iout++)
-        for(int jout=0; jout<3; jout++)
-            P[iout*P_strideelems0 + jout*P_strideelems1] =
-                Msym66[index_sym66(iout+M_i0, jout+M_j0)] * scale;
+    get_block33_sym66(P, P_strideelems0, P_strideelems1,
+                      Msym66, M_i0, M_j0, scale);
 }
 // Assumes the output is symmetric, and only computes the upper triangle
 __attribute__((unused))
-static
+static inline
 void set_33insym66_from_gen33_accum(// output
                                     double* restrict Psym66, int P_i0, int P_j0,
                                     // input
                                     const double* M, int M_strideelems0, int M_strideelems1,
                                     const double scale)
 {
-    for(int iout=0; iout<3; iout++)
-        for(int jout=0; jout<3; jout++)
-        {
-            if(jout + P_j0 < iout + P_i0)
-            {
-                // Wrong triangle. Set it up to look at the right triangle
-                // during the next loop interation
-                jout = iout + P_i0 - P_j0 - 1;
-                continue;
-            }
-
-            Psym66[index_sym66_assume_upper(iout+P_i0, jout+P_j0)] +=
-                M[iout*M_strideelems0 + jout*M_strideelems1] * scale;
-        }
-}
-
-// This is completely unreasonable. I'm almost certainly going to replace it
-__attribute__((unused))
-static
-double cofactors_sym6(const double* restrict m, double* restrict c)
-{
-    /*
-Just like in libminimath; adding 6x6 version. I use the maxima result verbatim, except:
-
-- mNNN  -> m[NNN]
-- XXX^2 -> XXX*XXX
-
-maxima session:
-
-(%i1) display2d : false;
-
-(%i2) sym6 : matrix([m0,m1, m2,  m3, m4,  m5 ],
-                    [m1,m6, m7,  m8, m9,  m10],
-                    [m2,m7, m11, m12,m13, m14],
-                    [m3,m8, m12, m15,m16, m17],
-                    [m4,m9, m13, m16,m18, m19],
-                    [m5,m10,m14, m17,m19, m20]);
-
-(%i10) num( ev(invert(sym6),detout) );
-
-(%o10) matrix([(-m7*((-m12*((-m16*(m20*m9-m10*m19))+m17*(m19*m9-m10*m18)
-                                                   +(m18*m20-m19^2)*m8))
-                    +m13*((-m15*(m20*m9-m10*m19))+m17*(m17*m9-m10*m16)
-                                                 +(m16*m20-m17*m19)*m8)
-                    -m14*((-m15*(m19*m9-m10*m18))+m16*(m17*m9-m10*m16)
-                                                 +(m16*m19-m17*m18)*m8)
-                    +(m15*(m18*m20-m19^2)-m16*(m16*m20-m17*m19)
-                                         +m17*(m16*m19-m17*m18))
-                     *m7))
-                +m8*((-m11*((-m16*(m20*m9-m10*m19))+m17*(m19*m9-m10*m18)
-                                                   +(m18*m20-m19^2)*m8))
-                    +m13*((-m12*(m20*m9-m10*m19))+m17*(m14*m9-m10*m13)
-                                                 +(m13*m20-m14*m19)*m8)
-                    -m14*((-m12*(m19*m9-m10*m18))+m16*(m14*m9-m10*m13)
-                                                 +(m13*m19-m14*m18)*m8)
-                    +(m12*(m18*m20-m19^2)-m16*(m13*m20-m14*m19)
-                                         +m17*(m13*m19-m14*m18))
-                     *m7)
-                -m9*((-m11*((-m15*(m20*m9-m10*m19))+m17*(m17*m9-m10*m16)
-                                                   +(m16*m20-m17*m19)*m8))
-                    +m12*((-m12*(m20*m9-m10*m19))+m17*(m14*m9-m10*m13)
-                                                 +(m13*m20-m14*m19)*m8)
-                    -m14*((-m12*(m17*m9-m10*m16))+m15*(m14*m9-m10*m13)
-                                                 +(m13*m17-m14*m16)*m8)
-                    +(m12*(m16*m20-m17*m19)-m15*(m13*m20-m14*m19)
-                                           +m17*(m13*m17-m14*m16))
-                     *m7)
-                +m10*((-m11*((-m15*(m19*m9-m10*m18))+m16*(m17*m9-m10*m16)
-                                                    +(m16*m19-m17*m18)*m8))
-                     +m12*((-m12*(m19*m9-m10*m18))+m16*(m14*m9-m10*m13)
-                                                  +(m13*m19-m14*m18)*m8)
-                     -m13*((-m12*(m17*m9-m10*m16))+m15*(m14*m9-m10*m13)
-                                                  +(m13*m17-m14*m16)*m8)
-                     +(m12*(m16*m19-m17*m18)-m15*(m13*m19-m14*m18)
-                                            +m16*(m13*m17-m14*m16))
-                      *m7)
-                +(m11*(m15*(m18*m20-m19^2)-m16*(m16*m20-m17*m19)
-                                          +m17*(m16*m19-m17*m18))
-                 -m12*(m12*(m18*m20-m19^2)-m16*(m13*m20-m14*m19)
-                                          +m17*(m13*m19-m14*m18))
-                 +m13*(m12*(m16*m20-m17*m19)-m15*(m13*m20-m14*m19)
-                                            +m17*(m13*m17-m14*m16))
-                 -m14*(m12*(m16*m19-m17*m18)-m15*(m13*m19-m14*m18)
-                                            +m16*(m13*m17-m14*m16)))
-                 *m6,
-               m2*((-m12*((-m16*(m20*m9-m10*m19))+m17*(m19*m9-m10*m18)
-                                                 +(m18*m20-m19^2)*m8))
-                  +m13*((-m15*(m20*m9-m10*m19))+m17*(m17*m9-m10*m16)
-                                               +(m16*m20-m17*m19)*m8)
-                  -m14*((-m15*(m19*m9-m10*m18))+m16*(m17*m9-m10*m16)
-                                               +(m16*m19-m17*m18)*m8)
-                  +(m15*(m18*m20-m19^2)-m16*(m16*m20-m17*m19)
-                                       +m17*(m16*m19-m17*m18))
-                   *m7)
-                -m3*((-m11*((-m16*(m20*m9-m10*m19))+m17*(m19*m9-m10*m18)
-                                                   +(m18*m20-m19^2)*m8))
-                    +m13*((-m12*(m20*m9-m10*m19))+m17*(m14*m9-m10*m13)
-                                                 +(m13*m20-m14*m19)*m8)
-                    -m14*((-m12*(m19*m9-m10*m18))+m16*(m14*m9-m10*m13)
-                                                 +(m13*m19-m14*m18)*m8)
-                    +(m12*(m18*m20-m19^2)-m16*(m13*m20-m14*m19)
-                                         +m17*(m13*m19-m14*m18))
-                     *m7)
-                +m4*((-m11*((-m15*(m20*m9-m10*m19))+m17*(m17*m9-m10*m16)
-                                                   +(m16*m20-m17*m19)*m8))
-                    +m12*((-m12*(m20*m9-m10*m19))+m17*(m14*m9-m10*m13)
-                                                 +(m13*m20-m14*m19)*m8)
-                    -m14*((-m12*(m17*m9-m10*m16))+m15*(m14*m9-m10*m13)
-                                                 +(m13*m17-m14*m16)*m8)
-                    +(m12*(m16*m20-m17*m19)-m15*(m13*m20-m14*m19)
-                                           +m17*(m13*m17-m14*m16))
-                     *m7)
-                -m5*((-m11*((-m15*(m19*m9-m10*m18))+m16*(m17*m9-m10*m16)
-                                                   +(m16*m19-m17*m18)*m8))
-                    +m12*((-m12*(m19*m9-m10*m18))+m16*(m14*m9-m10*m13)
-                                                 +(m13*m19-m14*m18)*m8)
-                    -m13*((-m12*(m17*m9-m10*m16))+m15*(m14*m9-m10*m13)
-                                                 +(m13*m17-m14*m16)*m8)
-                    +(m12*(m16*m19-m17*m18)-m15*(m13*m19-m14*m18)
-                                           +m16*(m13*m17-m14*m16))
-                     *m7)
-                -m1*(m11*(m15*(m18*m20-m19^2)-m16*(m16*m20-m17*m19)
-                                             +m17*(m16*m19-m17*m18))
-                    -m12*(m12*(m18*m20-m19^2)-m16*(m13*m20-m14*m19)
-                                             +m17*(m13*m19-m14*m18))
-                    +m13*(m12*(m16*m20-m17*m19)-m15*(m13*m20-m14*m19)
-                                               +m17*(m13*m17-m14*m16))
-                    -m14*(m12*(m16*m19-m17*m18)-m15*(m13*m19-m14*m18)
-                                               +m16*(m13*m17-m14*m16))),
-               (-m2*((-m8*((-m16*(m20*m9-m10*m19))+m17*(m19*m9-m10*m18)
-                                                  +(m18*m20-m19^2)*m8))
-                    +m9*((-m15*(m20*m9-m10*m19))+m17*(m17*m9-m10*m16)
-                                                +(m16*m20-m17*m19)*m8)
-                    -m10*((-m15*(m19*m9-m10*m18))+m16*(m17*m9-m10*m16)
-                                                 +(m16*m19-m17*m18)*m8)
-                    +(m15*(m18*m20-m19^2)-m16*(m16*m20-m17*m19)
-                                         +m17*(m16*m19-m17*m18))
-                     *m6))
-                +m3*((-m7*((-m16*(m20*m9-m10*m19))+m17*(m19*m9-m10*m18)
-                                                  +(m18*m20-m19^2)*m8))
-                    +m9*((-m12*(m20*m9-m10*m19))+m17*(m14*m9-m10*m13)
-                                                +(m13*m20-m14*m19)*m8)
-                    -m10*((-m12*(m19*m9-m10*m18))+m16*(m14*m9-m10*m13)
-                                                 +(m13*m19-m14*m18)*m8)
-                    +(m12*(m18*m20-m19^2)-m16*(m13*m20-m14*m19)
-                                         +m17*(m13*m19-m14*m18))
-                     *m6)
-                -m4*((-m7*((-m15*(m20*m9-m10*m19))+m17*(m17*m9-m10*m16)
-                                                  +(m16*m20-m17*m19)*m8))
-                    +m8*((-m12*(m20*m9-m10*m19))+m17*(m14*m9-m10*m13)
-                                                +(m13*m20-m14*m19)*m8)
-                    -m10*((-m12*(m17*m9-m10*m16))+m15*(m14*m9-m10*m13)
-                                                 +(m13*m17-m14*m16)*m8)
-                    +(m12*(m16*m20-m17*m19)-m15*(m13*m20-m14*m19)
-                                           +m17*(m13*m17-m14*m16))
-                     *m6)
-                +m5*((-m7*((-m15*(m19*m9-m10*m18))+m16*(m17*m9-m10*m16)
-                                                  +(m16*m19-m17*m18)*m8))
-                    +m8*((-m12*(m19*m9-m10*m18))+m16*(m14*m9-m10*m13)
-                                                +(m13*m19-m14*m18)*m8)
-                    -m9*((-m12*(m17*m9-m10*m16))+m15*(m14*m9-m10*m13)
-                                                +(m13*m17-m14*m16)*m8)
-                    +(m12*(m16*m19-m17*m18)-m15*(m13*m19-m14*m18)
-                                           +m16*(m13*m17-m14*m16))
-                     *m6)
-                +m1*((m12*(m16*m20-m17*m19)-m15*(m13*m20-m14*m19)
-                                           +m17*(m13*m17-m14*m16))
-                    *m9
-                    -(m12*(m18*m20-m19^2)-m16*(m13*m20-m14*m19)
-                                         +m17*(m13*m19-m14*m18))
-                     *m8
-                    +(m15*(m18*m20-m19^2)-m16*(m16*m20-m17*m19)
-                                         +m17*(m16*m19-m17*m18))
-                     *m7
-                    -m10*(m12*(m16*m19-m17*m18)-m15*(m13*m19-m14*m18)
-                                               +m16*(m13*m17-m14*m16))),
-               m2*((-m8*((-m13*(m20*m9-m10*m19))+m14*(m19*m9-m10*m18)
-                                                +(m18*m20-m19^2)*m7))
-                  +m9*((-m12*(m20*m9-m10*m19))+m14*(m17*m9-m10*m16)
-                                              +(m16*m20-m17*m19)*m7)
-                  -m10*((-m12*(m19*m9-m10*m18))+m13*(m17*m9-m10*m16)
-                                               +(m16*m19-m17*m18)*m7)
-                  +(m12*(m18*m20-m19^2)-m13*(m16*m20-m17*m19)
-                                       +m14*(m16*m19-m17*m18))
-                   *m6)
-                -m3*((-m7*((-m13*(m20*m9-m10*m19))+m14*(m19*m9-m10*m18)
-                                                  +(m18*m20-m19^2)*m7))
-                    +m9*((-m11*(m20*m9-m10*m19))+m14*(m14*m9-m10*m13)
-                                                +(m13*m20-m14*m19)*m7)
-                    -m10*((-m11*(m19*m9-m10*m18))+m13*(m14*m9-m10*m13)
-                                                 +(m13*m19-m14*m18)*m7)
-                    +(m11*(m18*m20-m19^2)-m13*(m13*m20-m14*m19)
-                                         +m14*(m13*m19-m14*m18))
-                     *m6)
-                +m4*((-m7*((-m12*(m20*m9-m10*m19))+m14*(m17*m9-m10*m16)
-                                                  +(m16*m20-m17*m19)*m7))
-                    +m8*((-m11*(m20*m9-m10*m19))+m14*(m14*m9-m10*m13)
-                                                +(m13*m20-m14*m19)*m7)
-                    -m10*((-m11*(m17*m9-m10*m16))+m12*(m14*m9-m10*m13)
-                                                 +(m13*m17-m14*m16)*m7)
-                    +(m11*(m16*m20-m17*m19)-m12*(m13*m20-m14*m19)
-                                           +m14*(m13*m17-m14*m16))
-                     *m6)
-                -m5*((-m7*((-m12*(m19*m9-m10*m18))+m13*(m17*m9-m10*m16)
-                                                  +(m16*m19-m17*m18)*m7))
-                    +m8*((-m11*(m19*m9-m10*m18))+m13*(m14*m9-m10*m13)
-                                                +(m13*m19-m14*m18)*m7)
-                    -m9*((-m11*(m17*m9-m10*m16))+m12*(m14*m9-m10*m13)
-                                                +(m13*m17-m14*m16)*m7)
-                    +(m11*(m16*m19-m17*m18)-m12*(m13*m19-m14*m18)
-                                           +m13*(m13*m17-m14*m16))
-                     *m6)
-                -m1*((m11*(m16*m20-m17*m19)-m12*(m13*m20-m14*m19)
-                                           +m14*(m13*m17-m14*m16))
-                    *m9
-                    -(m11*(m18*m20-m19^2)-m13*(m13*m20-m14*m19)
-                                         +m14*(m13*m19-m14*m18))
-                     *m8
-                    +(m12*(m18*m20-m19^2)-m13*(m16*m20-m17*m19)
-                                         +m14*(m16*m19-m17*m18))
-                     *m7
-                    -m10*(m11*(m16*m19-m17*m18)-m12*(m13*m19-m14*m18)
-                                               +m13*(m13*m17-m14*m16))),
-               (-m2*(((-m12*(m20*m8-m10*m17))+m14*(m17*m8-m10*m15)
-                                             +(m15*m20-m17^2)*m7)
-                    *m9
-                    -m8*((-m13*(m20*m8-m10*m17))+m14*(m19*m8-m10*m16)
-                                                +(m16*m20-m17*m19)*m7)
-                    -m10*((-m12*(m19*m8-m10*m16))+m13*(m17*m8-m10*m15)
-                                                 +(m15*m19-m16*m17)*m7)
-                    +(m12*(m16*m20-m17*m19)-m13*(m15*m20-m17^2)
-                                           +m14*(m15*m19-m16*m17))
-                     *m6))
-                +m3*(((-m11*(m20*m8-m10*m17))+m14*(m14*m8-m10*m12)
-                                             +(m12*m20-m14*m17)*m7)
-                    *m9
-                    -m7*((-m13*(m20*m8-m10*m17))+m14*(m19*m8-m10*m16)
-                                                +(m16*m20-m17*m19)*m7)
-                    -m10*((-m11*(m19*m8-m10*m16))+m13*(m14*m8-m10*m12)
-                                                 +(m12*m19-m14*m16)*m7)
-                    +(m11*(m16*m20-m17*m19)-m13*(m12*m20-m14*m17)
-                                           +m14*(m12*m19-m14*m16))
-                     *m6)
-                +m5*((-((-m11*(m17*m8-m10*m15))+m12*(m14*m8-m10*m12)
-                                               +(m12*m17-m14*m15)*m7)
-                    *m9)
-                    -m7*((-m12*(m19*m8-m10*m16))+m13*(m17*m8-m10*m15)
-                                                +(m15*m19-m16*m17)*m7)
-                    +m8*((-m11*(m19*m8-m10*m16))+m13*(m14*m8-m10*m12)
-                                                +(m12*m19-m14*m16)*m7)
-                    +(m11*(m15*m19-m16*m17)-m12*(m12*m19-m14*m16)
-                                           +m13*(m12*m17-m14*m15))
-                     *m6)
-                +m1*((m11*(m15*m20-m17^2)-m12*(m12*m20-m14*m17)
-                                         +m14*(m12*m17-m14*m15))
-                    *m9
-                    -(m11*(m16*m20-m17*m19)-m13*(m12*m20-m14*m17)
-                                           +m14*(m12*m19-m14*m16))
-                     *m8
-                    +(m12*(m16*m20-m17*m19)-m13*(m15*m20-m17^2)
-                                           +m14*(m15*m19-m16*m17))
-                     *m7
-                    -m10*(m11*(m15*m19-m16*m17)-m12*(m12*m19-m14*m16)
-                                               +m13*(m12*m17-m14*m15)))
-                -m4*((-m7*((-m12*(m20*m8-m10*m17))+m14*(m17*m8-m10*m15)
-                                                  +(m15*m20-m17^2)*m7))
-                    +m8*((-m11*(m20*m8-m10*m17))+m14*(m14*m8-m10*m12)
-                                                +(m12*m20-m14*m17)*m7)
-                    -m10*((-m11*(m17*m8-m10*m15))+m12*(m14*m8-m10*m12)
-                                                 +(m12*m17-m14*m15)*m7)
-                    +(m11*(m15*m20-m17^2)-m12*(m12*m20-m14*m17)
-                                         +m14*(m12*m17-m14*m15))
-                     *m6),
-               m2*((-m8*((-m13*(m19*m8-m17*m9))+m14*(m18*m8-m16*m9)
-                                               +(m16*m19-m17*m18)*m7))
-                  +m9*((-m12*(m19*m8-m17*m9))+m14*(m16*m8-m15*m9)
-                                             +(m15*m19-m16*m17)*m7)
-                  -m10*((-m12*(m18*m8-m16*m9))+m13*(m16*m8-m15*m9)
-                                              +(m15*m18-m16^2)*m7)
-                  +(m12*(m16*m19-m17*m18)-m13*(m15*m19-m16*m17)
-                                         +m14*(m15*m18-m16^2))
-                   *m6)
-                -m3*((-m7*((-m13*(m19*m8-m17*m9))+m14*(m18*m8-m16*m9)
-                                                 +(m16*m19-m17*m18)*m7))
-                    +m9*((-m11*(m19*m8-m17*m9))+m14*(m13*m8-m12*m9)
-                                               +(m12*m19-m13*m17)*m7)
-                    -m10*((-m11*(m18*m8-m16*m9))+m13*(m13*m8-m12*m9)
-                                                +(m12*m18-m13*m16)*m7)
-                    +(m11*(m16*m19-m17*m18)-m13*(m12*m19-m13*m17)
-                                           +m14*(m12*m18-m13*m16))
-                     *m6)
-                +m4*((-m7*((-m12*(m19*m8-m17*m9))+m14*(m16*m8-m15*m9)
-                                                 +(m15*m19-m16*m17)*m7))
-                    +m8*((-m11*(m19*m8-m17*m9))+m14*(m13*m8-m12*m9)
-                                               +(m12*m19-m13*m17)*m7)
-                    -m10*((-m11*(m16*m8-m15*m9))+m12*(m13*m8-m12*m9)
-                                                +(m12*m16-m13*m15)*m7)
-                    +(m11*(m15*m19-m16*m17)-m12*(m12*m19-m13*m17)
-                                           +m14*(m12*m16-m13*m15))
-                     *m6)
-                -m5*((-m7*((-m12*(m18*m8-m16*m9))+m13*(m16*m8-m15*m9)
-                                                 +(m15*m18-m16^2)*m7))
-                    +m8*((-m11*(m18*m8-m16*m9))+m13*(m13*m8-m12*m9)
-                                               +(m12*m18-m13*m16)*m7)
-                    -m9*((-m11*(m16*m8-m15*m9))+m12*(m13*m8-m12*m9)
-                                               +(m12*m16-m13*m15)*m7)
-                    +(m11*(m15*m18-m16^2)-m12*(m12*m18-m13*m16)
-                                         +m13*(m12*m16-m13*m15))
-                     *m6)
-                -m1*((m11*(m15*m19-m16*m17)-m12*(m12*m19-m13*m17)
-                                           +m14*(m12*m16-m13*m15))
-                    *m9
-                    -(m11*(m16*m19-m17*m18)-m13*(m12*m19-m13*m17)
-                                           +m14*(m12*m18-m13*m16))
-                     *m8
-                    +(m12*(m16*m19-m17*m18)-m13*(m15*m19-m16*m17)
-                                           +m14*(m15*m18-m16^2))
-                     *m7
-                    -m10*(m11*(m15*m18-m16^2)-m12*(m12*m18-m13*m16)
-                                             +m13*(m12*m16-m13*m15)))],
-              [((-m11*((-m15*(m20*m4-m19*m5))+m17*(m17*m4-m16*m5)
-                                             +(m16*m20-m17*m19)*m3))
-                +m12*((-m12*(m20*m4-m19*m5))+m17*(m14*m4-m13*m5)
-                                            +(m13*m20-m14*m19)*m3)
-                -m14*((-m12*(m17*m4-m16*m5))+m15*(m14*m4-m13*m5)
-                                            +(m13*m17-m14*m16)*m3)
-                +m2*(m12*(m16*m20-m17*m19)-m15*(m13*m20-m14*m19)
-                                          +m17*(m13*m17-m14*m16)))
-                *m9
-                -((-m11*((-m16*(m20*m4-m19*m5))+m17*(m19*m4-m18*m5)
-                                               +(m18*m20-m19^2)*m3))
-                 +m13*((-m12*(m20*m4-m19*m5))+m17*(m14*m4-m13*m5)
-                                             +(m13*m20-m14*m19)*m3)
-                 -m14*((-m12*(m19*m4-m18*m5))+m16*(m14*m4-m13*m5)
-                                             +(m13*m19-m14*m18)*m3)
-                 +m2*(m12*(m18*m20-m19^2)-m16*(m13*m20-m14*m19)
-                                         +m17*(m13*m19-m14*m18)))
-                 *m8
-                +((-m12*((-m16*(m20*m4-m19*m5))+m17*(m19*m4-m18*m5)
-                                               +(m18*m20-m19^2)*m3))
-                 +m13*((-m15*(m20*m4-m19*m5))+m17*(m17*m4-m16*m5)
-                                             +(m16*m20-m17*m19)*m3)
-                 -m14*((-m15*(m19*m4-m18*m5))+m16*(m17*m4-m16*m5)
-                                             +(m16*m19-m17*m18)*m3)
-                 +m2*(m15*(m18*m20-m19^2)-m16*(m16*m20-m17*m19)
-                                         +m17*(m16*m19-m17*m18)))
-                 *m7
-                -m10*((-m11*((-m15*(m19*m4-m18*m5))+m16*(m17*m4-m16*m5)
-                                                   +(m16*m19-m17*m18)*m3))
-                     +m12*((-m12*(m19*m4-m18*m5))+m16*(m14*m4-m13*m5)
-                                                 +(m13*m19-m14*m18)*m3)
-                     -m13*((-m12*(m17*m4-m16*m5))+m15*(m14*m4-m13*m5)
-                                                 +(m13*m17-m14*m16)*m3)
-                     +(m12*(m16*m19-m17*m18)-m15*(m13*m19-m14*m18)
-                                            +m16*(m13*m17-m14*m16))
-                      *m2)
-                -m1*(m11*(m15*(m18*m20-m19^2)-m16*(m16*m20-m17*m19)
-                                             +m17*(m16*m19-m17*m18))
-                    -m12*(m12*(m18*m20-m19^2)-m16*(m13*m20-m14*m19)
-                                             +m17*(m13*m19-m14*m18))
-                    +m13*(m12*(m16*m20-m17*m19)-m15*(m13*m20-m14*m19)
-                                               +m17*(m13*m17-m14*m16))
-                    -m14*(m12*(m16*m19-m17*m18)-m15*(m13*m19-m14*m18)
-                                               +m16*(m13*m17-m14*m16))),
-               (-m2*((-m12*((-m16*(m20*m4-m19*m5))+m17*(m19*m4-m18*m5)
-                                                  +(m18*m20-m19^2)*m3))
-                    +m13*((-m15*(m20*m4-m19*m5))+m17*(m17*m4-m16*m5)
-                                                +(m16*m20-m17*m19)*m3)
-                    -m14*((-m15*(m19*m4-m18*m5))+m16*(m17*m4-m16*m5)
-                                                +(m16*m19-m17*m18)*m3)
-                    +m2*(m15*(m18*m20-m19^2)-m16*(m16*m20-m17*m19)
-                                            +m17*(m16*m19-m17*m18))))
-                +m3*((-m11*((-m16*(m20*m4-m19*m5))+m17*(m19*m4-m18*m5)
-                                                  +(m18*m20-m19^2)*m3))
-                    +m13*((-m12*(m20*m4-m19*m5))+m17*(m14*m4-m13*m5)
-                                                +(m13*m20-m14*m19)*m3)
-                    -m14*((-m12*(m19*m4-m18*m5))+m16*(m14*m4-m13*m5)
-                                                +(m13*m19-m14*m18)*m3)
-                    +m2*(m12*(m18*m20-m19^2)-m16*(m13*m20-m14*m19)
-                                            +m17*(m13*m19-m14*m18)))
-                -m4*((-m11*((-m15*(m20*m4-m19*m5))+m17*(m17*m4-m16*m5)
-                                                  +(m16*m20-m17*m19)*m3))
-                    +m12*((-m12*(m20*m4-m19*m5))+m17*(m14*m4-m13*m5)
-                                                +(m13*m20-m14*m19)*m3)
-                    -m14*((-m12*(m17*m4-m16*m5))+m15*(m14*m4-m13*m5)
-                                                +(m13*m17-m14*m16)*m3)
-                    +m2*(m12*(m16*m20-m17*m19)-m15*(m13*m20-m14*m19)
-                                              +m17*(m13*m17-m14*m16)))
-                +m5*((-m11*((-m15*(m19*m4-m18*m5))+m16*(m17*m4-m16*m5)
-                                                  +(m16*m19-m17*m18)*m3))
-                    +m12*((-m12*(m19*m4-m18*m5))+m16*(m14*m4-m13*m5)
-                                                +(m13*m19-m14*m18)*m3)
-                    -m13*((-m12*(m17*m4-m16*m5))+m15*(m14*m4-m13*m5)
-                                                +(m13*m17-m14*m16)*m3)
-                    +(m12*(m16*m19-m17*m18)-m15*(m13*m19-m14*m18)
-                                           +m16*(m13*m17-m14*m16))
-                     *m2)
-                +m0*(m11*(m15*(m18*m20-m19^2)-m16*(m16*m20-m17*m19)
-                                             +m17*(m16*m19-m17*m18))
-                    -m12*(m12*(m18*m20-m19^2)-m16*(m13*m20-m14*m19)
-                                             +m17*(m13*m19-m14*m18))
-                    +m13*(m12*(m16*m20-m17*m19)-m15*(m13*m20-m14*m19)
-                                               +m17*(m13*m17-m14*m16))
-                    -m14*(m12*(m16*m19-m17*m18)-m15*(m13*m19-m14*m18)
-                                               +m16*(m13*m17-m14*m16))),
-               m2*(((-m15*(m20*m4-m19*m5))+m17*(m17*m4-m16*m5)
-                                          +(m16*m20-m17*m19)*m3)
-                  *m9
-                  -((-m16*(m20*m4-m19*m5))+m17*(m19*m4-m18*m5)
-                                          +(m18*m20-m19^2)*m3)
-                   *m8
-                  -m10*((-m15*(m19*m4-m18*m5))+m16*(m17*m4-m16*m5)
-                                              +(m16*m19-m17*m18)*m3)
-                  +m1*(m15*(m18*m20-m19^2)-m16*(m16*m20-m17*m19)
-                                          +m17*(m16*m19-m17*m18)))
-                -m3*(((-m12*(m20*m4-m19*m5))+m17*(m14*m4-m13*m5)
-                                            +(m13*m20-m14*m19)*m3)
-                    *m9
-                    -((-m16*(m20*m4-m19*m5))+m17*(m19*m4-m18*m5)
-                                            +(m18*m20-m19^2)*m3)
-                     *m7
-                    -m10*((-m12*(m19*m4-m18*m5))+m16*(m14*m4-m13*m5)
-                                                +(m13*m19-m14*m18)*m3)
-                    +m1*(m12*(m18*m20-m19^2)-m16*(m13*m20-m14*m19)
-                                            +m17*(m13*m19-m14*m18)))
-                -m5*((-((-m12*(m17*m4-m16*m5))+m15*(m14*m4-m13*m5)
-                                              +(m13*m17-m14*m16)*m3)
-                    *m9)
-                    +((-m12*(m19*m4-m18*m5))+m16*(m14*m4-m13*m5)
-                                            +(m13*m19-m14*m18)*m3)
-                     *m8
-                    -((-m15*(m19*m4-m18*m5))+m16*(m17*m4-m16*m5)
-                                            +(m16*m19-m17*m18)*m3)
-                     *m7
-                    +m1*(m12*(m16*m19-m17*m18)-m15*(m13*m19-m14*m18)
-                                              +m16*(m13*m17-m14*m16)))
-                -m0*((m12*(m16*m20-m17*m19)-m15*(m13*m20-m14*m19)
-                                           +m17*(m13*m17-m14*m16))
-                    *m9
-                    -(m12*(m18*m20-m19^2)-m16*(m13*m20-m14*m19)
-                                         +m17*(m13*m19-m14*m18))
-                     *m8
-                    +(m15*(m18*m20-m19^2)-m16*(m16*m20-m17*m19)
-                                         +m17*(m16*m19-m17*m18))
-                     *m7
-                    -m10*(m12*(m16*m19-m17*m18)-m15*(m13*m19-m14*m18)
-                                               +m16*(m13*m17-m14*m16)))
-                +m4*(((-m12*(m20*m4-m19*m5))+m17*(m14*m4-m13*m5)
-                                            +(m13*m20-m14*m19)*m3)
-                    *m8
-                    -((-m15*(m20*m4-m19*m5))+m17*(m17*m4-m16*m5)
-                                            +(m16*m20-m17*m19)*m3)
-                     *m7
-                    -m10*((-m12*(m17*m4-m16*m5))+m15*(m14*m4-m13*m5)
-                                                +(m13*m17-m14*m16)*m3)
-                    +m1*(m12*(m16*m20-m17*m19)-m15*(m13*m20-m14*m19)
-                                              +m17*(m13*m17-m14*m16))),
-               (-m2*(((-m12*(m20*m4-m19*m5))+m14*(m17*m4-m16*m5)
-                                            +m2*(m16*m20-m17*m19))
-                    *m9
-                    -((-m13*(m20*m4-m19*m5))+m14*(m19*m4-m18*m5)
-                                            +m2*(m18*m20-m19^2))
-                     *m8
-                    -m10*((-m12*(m19*m4-m18*m5))+m13*(m17*m4-m16*m5)
-                                                +(m16*m19-m17*m18)*m2)
-                    +m1*(m12*(m18*m20-m19^2)-m13*(m16*m20-m17*m19)
-                                            +m14*(m16*m19-m17*m18))))
-                +m3*(((-m11*(m20*m4-m19*m5))+m14*(m14*m4-m13*m5)
-                                            +m2*(m13*m20-m14*m19))
-                    *m9
-                    -((-m13*(m20*m4-m19*m5))+m14*(m19*m4-m18*m5)
-                                            +m2*(m18*m20-m19^2))
-                     *m7
-                    -m10*((-m11*(m19*m4-m18*m5))+m13*(m14*m4-m13*m5)
-                                                +(m13*m19-m14*m18)*m2)
-                    +m1*(m11*(m18*m20-m19^2)-m13*(m13*m20-m14*m19)
-                                            +m14*(m13*m19-m14*m18)))
-                +m5*((-((-m11*(m17*m4-m16*m5))+m12*(m14*m4-m13*m5)
-                                              +(m13*m17-m14*m16)*m2)
-                    *m9)
-                    +((-m11*(m19*m4-m18*m5))+m13*(m14*m4-m13*m5)
-                                            +(m13*m19-m14*m18)*m2)
-                     *m8
-                    -((-m12*(m19*m4-m18*m5))+m13*(m17*m4-m16*m5)
-                                            +(m16*m19-m17*m18)*m2)
-                     *m7
-                    +m1*(m11*(m16*m19-m17*m18)-m12*(m13*m19-m14*m18)
-                                              +m13*(m13*m17-m14*m16)))
-                +m0*((m11*(m16*m20-m17*m19)-m12*(m13*m20-m14*m19)
-                                           +m14*(m13*m17-m14*m16))
-                    *m9
-                    -(m11*(m18*m20-m19^2)-m13*(m13*m20-m14*m19)
-                                         +m14*(m13*m19-m14*m18))
-                     *m8
-                    +(m12*(m18*m20-m19^2)-m13*(m16*m20-m17*m19)
-                                         +m14*(m16*m19-m17*m18))
-                     *m7
-                    -m10*(m11*(m16*m19-m17*m18)-m12*(m13*m19-m14*m18)
-                                               +m13*(m13*m17-m14*m16)))
-                -m4*(((-m11*(m20*m4-m19*m5))+m14*(m14*m4-m13*m5)
-                                            +m2*(m13*m20-m14*m19))
-                    *m8
-                    -((-m12*(m20*m4-m19*m5))+m14*(m17*m4-m16*m5)
-                                            +m2*(m16*m20-m17*m19))
-                     *m7
-                    -m10*((-m11*(m17*m4-m16*m5))+m12*(m14*m4-m13*m5)
-                                                +(m13*m17-m14*m16)*m2)
-                    +m1*(m11*(m16*m20-m17*m19)-m12*(m13*m20-m14*m19)
-                                              +m14*(m13*m17-m14*m16))),
-               m2*(((-m12*(m20*m3-m17*m5))+m14*(m17*m3-m15*m5)
-                                          +m2*(m15*m20-m17^2))
-                  *m9
-                  -((-m13*(m20*m3-m17*m5))+m14*(m19*m3-m16*m5)
-                                          +m2*(m16*m20-m17*m19))
-                   *m8
-                  -m10*((-m12*(m19*m3-m16*m5))+m13*(m17*m3-m15*m5)
-                                              +(m15*m19-m16*m17)*m2)
-                  +m1*(m12*(m16*m20-m17*m19)-m13*(m15*m20-m17^2)
-                                            +m14*(m15*m19-m16*m17)))
-                -m3*(((-m11*(m20*m3-m17*m5))+m14*(m14*m3-m12*m5)
-                                            +m2*(m12*m20-m14*m17))
-                    *m9
-                    -((-m13*(m20*m3-m17*m5))+m14*(m19*m3-m16*m5)
-                                            +m2*(m16*m20-m17*m19))
-                     *m7
-                    -m10*((-m11*(m19*m3-m16*m5))+m13*(m14*m3-m12*m5)
-                                                +(m12*m19-m14*m16)*m2)
-                    +m1*(m11*(m16*m20-m17*m19)-m13*(m12*m20-m14*m17)
-                                              +m14*(m12*m19-m14*m16)))
-                -m5*((-((-m11*(m17*m3-m15*m5))+m12*(m14*m3-m12*m5)
-                                              +(m12*m17-m14*m15)*m2)
-                    *m9)
-                    +((-m11*(m19*m3-m16*m5))+m13*(m14*m3-m12*m5)
-                                            +(m12*m19-m14*m16)*m2)
-                     *m8
-                    -((-m12*(m19*m3-m16*m5))+m13*(m17*m3-m15*m5)
-                                            +(m15*m19-m16*m17)*m2)
-                     *m7
-                    +m1*(m11*(m15*m19-m16*m17)-m12*(m12*m19-m14*m16)
-                                              +m13*(m12*m17-m14*m15)))
-                -m0*((m11*(m15*m20-m17^2)-m12*(m12*m20-m14*m17)
-                                         +m14*(m12*m17-m14*m15))
-                    *m9
-                    -(m11*(m16*m20-m17*m19)-m13*(m12*m20-m14*m17)
-                                           +m14*(m12*m19-m14*m16))
-                     *m8
-                    +(m12*(m16*m20-m17*m19)-m13*(m15*m20-m17^2)
-                                           +m14*(m15*m19-m16*m17))
-                     *m7
-                    -m10*(m11*(m15*m19-m16*m17)-m12*(m12*m19-m14*m16)
-                                               +m13*(m12*m17-m14*m15)))
-                +m4*(((-m11*(m20*m3-m17*m5))+m14*(m14*m3-m12*m5)
-                                            +m2*(m12*m20-m14*m17))
-                    *m8
-                    -((-m12*(m20*m3-m17*m5))+m14*(m17*m3-m15*m5)
-                                            +m2*(m15*m20-m17^2))
-                     *m7
-                    -m10*((-m11*(m17*m3-m15*m5))+m12*(m14*m3-m12*m5)
-                                                +(m12*m17-m14*m15)*m2)
-                    +m1*(m11*(m15*m20-m17^2)-m12*(m12*m20-m14*m17)
-                                            +m14*(m12*m17-m14*m15))),
-               (-m2*(((-m12*(m19*m3-m17*m4))+m14*(m16*m3-m15*m4)
-                                            +(m15*m19-m16*m17)*m2)
-                    *m9
-                    -((-m13*(m19*m3-m17*m4))+m14*(m18*m3-m16*m4)
-                                            +(m16*m19-m17*m18)*m2)
-                     *m8
-                    -m10*((-m12*(m18*m3-m16*m4))+m13*(m16*m3-m15*m4)
-                                                +(m15*m18-m16^2)*m2)
-                    +m1*(m12*(m16*m19-m17*m18)-m13*(m15*m19-m16*m17)
-                                              +m14*(m15*m18-m16^2))))
-                +m3*(((-m11*(m19*m3-m17*m4))+m14*(m13*m3-m12*m4)
-                                            +(m12*m19-m13*m17)*m2)
-                    *m9
-                    -((-m13*(m19*m3-m17*m4))+m14*(m18*m3-m16*m4)
-                                            +(m16*m19-m17*m18)*m2)
-                     *m7
-                    -m10*((-m11*(m18*m3-m16*m4))+m13*(m13*m3-m12*m4)
-                                                +(m12*m18-m13*m16)*m2)
-                    +m1*(m11*(m16*m19-m17*m18)-m13*(m12*m19-m13*m17)
-                                              +m14*(m12*m18-m13*m16)))
-                +m5*((-((-m11*(m16*m3-m15*m4))+m12*(m13*m3-m12*m4)
-                                              +(m12*m16-m13*m15)*m2)
-                    *m9)
-                    +((-m11*(m18*m3-m16*m4))+m13*(m13*m3-m12*m4)
-                                            +(m12*m18-m13*m16)*m2)
-                     *m8
-                    -((-m12*(m18*m3-m16*m4))+m13*(m16*m3-m15*m4)
-                                            +(m15*m18-m16^2)*m2)
-                     *m7
-                    +m1*(m11*(m15*m18-m16^2)-m12*(m12*m18-m13*m16)
-                                            +m13*(m12*m16-m13*m15)))
-                +m0*((m11*(m15*m19-m16*m17)-m12*(m12*m19-m13*m17)
-                                           +m14*(m12*m16-m13*m15))
-                    *m9
-                    -(m11*(m16*m19-m17*m18)-m13*(m12*m19-m13*m17)
-                                           +m14*(m12*m18-m13*m16))
-                     *m8
-                    +(m12*(m16*m19-m17*m18)-m13*(m15*m19-m16*m17)
-                                           +m14*(m15*m18-m16^2))
-                     *m7
-                    -m10*(m11*(m15*m18-m16^2)-m12*(m12*m18-m13*m16)
-                                             +m13*(m12*m16-m13*m15)))
-                -m4*(((-m11*(m19*m3-m17*m4))+m14*(m13*m3-m12*m4)
-                                            +(m12*m19-m13*m17)*m2)
-                    *m8
-                    -((-m12*(m19*m3-m17*m4))+m14*(m16*m3-m15*m4)
-                                            +(m15*m19-m16*m17)*m2)
-                     *m7
-                    -m10*((-m11*(m16*m3-m15*m4))+m12*(m13*m3-m12*m4)
-                                                +(m12*m16-m13*m15)*m2)
-                    +m1*(m11*(m15*m19-m16*m17)-m12*(m12*m19-m13*m17)
-                                              +m14*(m12*m16-m13*m15)))],
-              [m8*(m13*(m17*(m10*m4-m5*m9)+m3*(m20*m9-m10*m19)
-                                          -(m20*m4-m19*m5)*m8)
-                  -m14*(m16*(m10*m4-m5*m9)+m3*(m19*m9-m10*m18)
-                                          -(m19*m4-m18*m5)*m8)
-                  +m2*((-m16*(m20*m9-m10*m19))+m17*(m19*m9-m10*m18)
-                                              +(m18*m20-m19^2)*m8)
-                  -((-m16*(m20*m4-m19*m5))+m17*(m19*m4-m18*m5)
-                                          +(m18*m20-m19^2)*m3)
-                   *m7)
-                -m9*(m12*(m17*(m10*m4-m5*m9)+m3*(m20*m9-m10*m19)
-                                            -(m20*m4-m19*m5)*m8)
-                    -m14*(m15*(m10*m4-m5*m9)+m3*(m17*m9-m10*m16)
-                                            -(m17*m4-m16*m5)*m8)
-                    +m2*((-m15*(m20*m9-m10*m19))+m17*(m17*m9-m10*m16)
-                                                +(m16*m20-m17*m19)*m8)
-                    -((-m15*(m20*m4-m19*m5))+m17*(m17*m4-m16*m5)
-                                            +(m16*m20-m17*m19)*m3)
-                     *m7)
-                +m10*(m12*(m16*(m10*m4-m5*m9)+m3*(m19*m9-m10*m18)
-                                             -(m19*m4-m18*m5)*m8)
-                     -m13*(m15*(m10*m4-m5*m9)+m3*(m17*m9-m10*m16)
-                                             -(m17*m4-m16*m5)*m8)
-                     +m2*((-m15*(m19*m9-m10*m18))+m16*(m17*m9-m10*m16)
-                                                 +(m16*m19-m17*m18)*m8)
-                     -((-m15*(m19*m4-m18*m5))+m16*(m17*m4-m16*m5)
-                                             +(m16*m19-m17*m18)*m3)
-                      *m7)
-                +m1*((-m12*((-m16*(m20*m9-m10*m19))+m17*(m19*m9-m10*m18)
-                                                   +(m18*m20-m19^2)*m8))
-                    +m13*((-m15*(m20*m9-m10*m19))+m17*(m17*m9-m10*m16)
-                                                 +(m16*m20-m17*m19)*m8)
-                    -m14*((-m15*(m19*m9-m10*m18))+m16*(m17*m9-m10*m16)
-                                                 +(m16*m19-m17*m18)*m8)
-                    +(m15*(m18*m20-m19^2)-m16*(m16*m20-m17*m19)
-                                         +m17*(m16*m19-m17*m18))
-                     *m7)
-                -((-m12*((-m16*(m20*m4-m19*m5))+m17*(m19*m4-m18*m5)
-                                               +(m18*m20-m19^2)*m3))
-                 +m13*((-m15*(m20*m4-m19*m5))+m17*(m17*m4-m16*m5)
-                                             +(m16*m20-m17*m19)*m3)
-                 -m14*((-m15*(m19*m4-m18*m5))+m16*(m17*m4-m16*m5)
-                                             +(m16*m19-m17*m18)*m3)
-                 +m2*(m15*(m18*m20-m19^2)-m16*(m16*m20-m17*m19)
-                                         +m17*(m16*m19-m17*m18)))
-                 *m6,
-               (-m3*(m13*(m17*(m10*m4-m5*m9)+m3*(m20*m9-m10*m19)
-                                            -(m20*m4-m19*m5)*m8)
-                    -m14*(m16*(m10*m4-m5*m9)+m3*(m19*m9-m10*m18)
-                                            -(m19*m4-m18*m5)*m8)
-                    +m2*((-m16*(m20*m9-m10*m19))+m17*(m19*m9-m10*m18)
-                                                +(m18*m20-m19^2)*m8)
-                    -((-m16*(m20*m4-m19*m5))+m17*(m19*m4-m18*m5)
-                                            +(m18*m20-m19^2)*m3)
-                     *m7))
-                +m4*(m12*(m17*(m10*m4-m5*m9)+m3*(m20*m9-m10*m19)
-                                            -(m20*m4-m19*m5)*m8)
-                    -m14*(m15*(m10*m4-m5*m9)+m3*(m17*m9-m10*m16)
-                                            -(m17*m4-m16*m5)*m8)
-                    +m2*((-m15*(m20*m9-m10*m19))+m17*(m17*m9-m10*m16)
-                                                +(m16*m20-m17*m19)*m8)
-                    -((-m15*(m20*m4-m19*m5))+m17*(m17*m4-m16*m5)
-                                            +(m16*m20-m17*m19)*m3)
-                     *m7)
-                -m5*(m12*(m16*(m10*m4-m5*m9)+m3*(m19*m9-m10*m18)
-                                            -(m19*m4-m18*m5)*m8)
-                    -m13*(m15*(m10*m4-m5*m9)+m3*(m17*m9-m10*m16)
-                                            -(m17*m4-m16*m5)*m8)
-                    +m2*((-m15*(m19*m9-m10*m18))+m16*(m17*m9-m10*m16)
-                                                +(m16*m19-m17*m18)*m8)
-                    -((-m15*(m19*m4-m18*m5))+m16*(m17*m4-m16*m5)
-                                            +(m16*m19-m17*m18)*m3)
-                     *m7)
-                -m0*((-m12*((-m16*(m20*m9-m10*m19))+m17*(m19*m9-m10*m18)
-                                                   +(m18*m20-m19^2)*m8))
-                    +m13*((-m15*(m20*m9-m10*m19))+m17*(m17*m9-m10*m16)
-                                                 +(m16*m20-m17*m19)*m8)
-                    -m14*((-m15*(m19*m9-m10*m18))+m16*(m17*m9-m10*m16)
-                                                 +(m16*m19-m17*m18)*m8)
-                    +(m15*(m18*m20-m19^2)-m16*(m16*m20-m17*m19)
-                                         +m17*(m16*m19-m17*m18))
-                     *m7)
-                +m1*((-m12*((-m16*(m20*m4-m19*m5))+m17*(m19*m4-m18*m5)
-                                                  +(m18*m20-m19^2)*m3))
-                    +m13*((-m15*(m20*m4-m19*m5))+m17*(m17*m4-m16*m5)
-                                                +(m16*m20-m17*m19)*m3)
-                    -m14*((-m15*(m19*m4-m18*m5))+m16*(m17*m4-m16*m5)
-                                                +(m16*m19-m17*m18)*m3)
-                    +m2*(m15*(m18*m20-m19^2)-m16*(m16*m20-m17*m19)
-                                            +m17*(m16*m19-m17*m18))),
-               m3*(m9*(m17*(m10*m4-m5*m9)+m3*(m20*m9-m10*m19)
-                                         -(m20*m4-m19*m5)*m8)
-                  -m10*(m16*(m10*m4-m5*m9)+m3*(m19*m9-m10*m18)
-                                          -(m19*m4-m18*m5)*m8)
-                  +m1*((-m16*(m20*m9-m10*m19))+m17*(m19*m9-m10*m18)
-                                              +(m18*m20-m19^2)*m8)
-                  -((-m16*(m20*m4-m19*m5))+m17*(m19*m4-m18*m5)
-                                          +(m18*m20-m19^2)*m3)
-                   *m6)
-                -m4*(m8*(m17*(m10*m4-m5*m9)+m3*(m20*m9-m10*m19)
-                                           -(m20*m4-m19*m5)*m8)
-                    -m10*(m15*(m10*m4-m5*m9)+m3*(m17*m9-m10*m16)
-                                            -(m17*m4-m16*m5)*m8)
-                    +m1*((-m15*(m20*m9-m10*m19))+m17*(m17*m9-m10*m16)
-                                                +(m16*m20-m17*m19)*m8)
-                    -((-m15*(m20*m4-m19*m5))+m17*(m17*m4-m16*m5)
-                                            +(m16*m20-m17*m19)*m3)
-                     *m6)
-                +m5*(m8*(m16*(m10*m4-m5*m9)+m3*(m19*m9-m10*m18)
-                                           -(m19*m4-m18*m5)*m8)
-                    -m9*(m15*(m10*m4-m5*m9)+m3*(m17*m9-m10*m16)
-                                           -(m17*m4-m16*m5)*m8)
-                    +m1*((-m15*(m19*m9-m10*m18))+m16*(m17*m9-m10*m16)
-                                                +(m16*m19-m17*m18)*m8)
-                    -((-m15*(m19*m4-m18*m5))+m16*(m17*m4-m16*m5)
-                                            +(m16*m19-m17*m18)*m3)
-                     *m6)
-                +m0*((-m8*((-m16*(m20*m9-m10*m19))+m17*(m19*m9-m10*m18)
-                                                  +(m18*m20-m19^2)*m8))
-                    +m9*((-m15*(m20*m9-m10*m19))+m17*(m17*m9-m10*m16)
-                                                +(m16*m20-m17*m19)*m8)
-                    -m10*((-m15*(m19*m9-m10*m18))+m16*(m17*m9-m10*m16)
-                                                 +(m16*m19-m17*m18)*m8)
-                    +(m15*(m18*m20-m19^2)-m16*(m16*m20-m17*m19)
-                                         +m17*(m16*m19-m17*m18))
-                     *m6)
-                -m1*(((-m15*(m20*m4-m19*m5))+m17*(m17*m4-m16*m5)
-                                            +(m16*m20-m17*m19)*m3)
-                    *m9
-                    -((-m16*(m20*m4-m19*m5))+m17*(m19*m4-m18*m5)
-                                            +(m18*m20-m19^2)*m3)
-                     *m8
-                    -m10*((-m15*(m19*m4-m18*m5))+m16*(m17*m4-m16*m5)
-                                                +(m16*m19-m17*m18)*m3)
-                    +m1*(m15*(m18*m20-m19^2)-m16*(m16*m20-m17*m19)
-                                            +m17*(m16*m19-m17*m18))),
-               (-m3*(m9*(m14*(m10*m4-m5*m9)+m2*(m20*m9-m10*m19)
-                                           -(m20*m4-m19*m5)*m7)
-                    -m10*(m13*(m10*m4-m5*m9)+m2*(m19*m9-m10*m18)
-                                            -(m19*m4-m18*m5)*m7)
-                    +m1*((-m13*(m20*m9-m10*m19))+m14*(m19*m9-m10*m18)
-                                                +(m18*m20-m19^2)*m7)
-                    -((-m13*(m20*m4-m19*m5))+m14*(m19*m4-m18*m5)
-                                            +m2*(m18*m20-m19^2))
-                     *m6))
-                +m4*(m8*(m14*(m10*m4-m5*m9)+m2*(m20*m9-m10*m19)
-                                           -(m20*m4-m19*m5)*m7)
-                    -m10*(m12*(m10*m4-m5*m9)+m2*(m17*m9-m10*m16)
-                                            -(m17*m4-m16*m5)*m7)
-                    +m1*((-m12*(m20*m9-m10*m19))+m14*(m17*m9-m10*m16)
-                                                +(m16*m20-m17*m19)*m7)
-                    -((-m12*(m20*m4-m19*m5))+m14*(m17*m4-m16*m5)
-                                            +m2*(m16*m20-m17*m19))
-                     *m6)
-                -m5*(m8*(m13*(m10*m4-m5*m9)+m2*(m19*m9-m10*m18)
-                                           -(m19*m4-m18*m5)*m7)
-                    -m9*(m12*(m10*m4-m5*m9)+m2*(m17*m9-m10*m16)
-                                           -(m17*m4-m16*m5)*m7)
-                    +m1*((-m12*(m19*m9-m10*m18))+m13*(m17*m9-m10*m16)
-                                                +(m16*m19-m17*m18)*m7)
-                    -((-m12*(m19*m4-m18*m5))+m13*(m17*m4-m16*m5)
-                                            +(m16*m19-m17*m18)*m2)
-                     *m6)
-                -m0*((-m8*((-m13*(m20*m9-m10*m19))+m14*(m19*m9-m10*m18)
-                                                  +(m18*m20-m19^2)*m7))
-                    +m9*((-m12*(m20*m9-m10*m19))+m14*(m17*m9-m10*m16)
-                                                +(m16*m20-m17*m19)*m7)
-                    -m10*((-m12*(m19*m9-m10*m18))+m13*(m17*m9-m10*m16)
-                                                 +(m16*m19-m17*m18)*m7)
-                    +(m12*(m18*m20-m19^2)-m13*(m16*m20-m17*m19)
-                                         +m14*(m16*m19-m17*m18))
-                     *m6)
-                +m1*(((-m12*(m20*m4-m19*m5))+m14*(m17*m4-m16*m5)
-                                            +m2*(m16*m20-m17*m19))
-                    *m9
-                    -((-m13*(m20*m4-m19*m5))+m14*(m19*m4-m18*m5)
-                                            +m2*(m18*m20-m19^2))
-                     *m8
-                    -m10*((-m12*(m19*m4-m18*m5))+m13*(m17*m4-m16*m5)
-                                                +(m16*m19-m17*m18)*m2)
-                    +m1*(m12*(m18*m20-m19^2)-m13*(m16*m20-m17*m19)
-                                            +m14*(m16*m19-m17*m18))),
-               m3*((m14*(m10*m3-m5*m8)+m2*(m20*m8-m10*m17)-(m20*m3-m17*m5)*m7)
-                  *m9
-                  -m10*(m13*(m10*m3-m5*m8)+m2*(m19*m8-m10*m16)
-                                          -(m19*m3-m16*m5)*m7)
-                  +m1*((-m13*(m20*m8-m10*m17))+m14*(m19*m8-m10*m16)
-                                              +(m16*m20-m17*m19)*m7)
-                  -((-m13*(m20*m3-m17*m5))+m14*(m19*m3-m16*m5)
-                                          +m2*(m16*m20-m17*m19))
-                   *m6)
-                +m5*((-(m12*(m10*m3-m5*m8)+m2*(m17*m8-m10*m15)
-                                          -(m17*m3-m15*m5)*m7)
-                    *m9)
-                    +m8*(m13*(m10*m3-m5*m8)+m2*(m19*m8-m10*m16)
-                                           -(m19*m3-m16*m5)*m7)
-                    +m1*((-m12*(m19*m8-m10*m16))+m13*(m17*m8-m10*m15)
-                                                +(m15*m19-m16*m17)*m7)
-                    -((-m12*(m19*m3-m16*m5))+m13*(m17*m3-m15*m5)
-                                            +(m15*m19-m16*m17)*m2)
-                     *m6)
-                +m0*(((-m12*(m20*m8-m10*m17))+m14*(m17*m8-m10*m15)
-                                             +(m15*m20-m17^2)*m7)
-                    *m9
-                    -m8*((-m13*(m20*m8-m10*m17))+m14*(m19*m8-m10*m16)
-                                                +(m16*m20-m17*m19)*m7)
-                    -m10*((-m12*(m19*m8-m10*m16))+m13*(m17*m8-m10*m15)
-                                                 +(m15*m19-m16*m17)*m7)
-                    +(m12*(m16*m20-m17*m19)-m13*(m15*m20-m17^2)
-                                           +m14*(m15*m19-m16*m17))
-                     *m6)
-                -m1*(((-m12*(m20*m3-m17*m5))+m14*(m17*m3-m15*m5)
-                                            +m2*(m15*m20-m17^2))
-                    *m9
-                    -((-m13*(m20*m3-m17*m5))+m14*(m19*m3-m16*m5)
-                                            +m2*(m16*m20-m17*m19))
-                     *m8
-                    -m10*((-m12*(m19*m3-m16*m5))+m13*(m17*m3-m15*m5)
-                                                +(m15*m19-m16*m17)*m2)
-                    +m1*(m12*(m16*m20-m17*m19)-m13*(m15*m20-m17^2)
-                                              +m14*(m15*m19-m16*m17)))
-                -m4*(m8*(m14*(m10*m3-m5*m8)+m2*(m20*m8-m10*m17)
-                                           -(m20*m3-m17*m5)*m7)
-                    -m10*(m12*(m10*m3-m5*m8)+m2*(m17*m8-m10*m15)
-                                            -(m17*m3-m15*m5)*m7)
-                    +m1*((-m12*(m20*m8-m10*m17))+m14*(m17*m8-m10*m15)
-                                                +(m15*m20-m17^2)*m7)
-                    -((-m12*(m20*m3-m17*m5))+m14*(m17*m3-m15*m5)
-                                            +m2*(m15*m20-m17^2))
-                     *m6),
-               (-m3*(m9*(m14*(m3*m9-m4*m8)+m2*(m19*m8-m17*m9)
-                                          -(m19*m3-m17*m4)*m7)
-                    -m10*(m13*(m3*m9-m4*m8)+m2*(m18*m8-m16*m9)
-                                           -(m18*m3-m16*m4)*m7)
-                    +m1*((-m13*(m19*m8-m17*m9))+m14*(m18*m8-m16*m9)
-                                               +(m16*m19-m17*m18)*m7)
-                    -((-m13*(m19*m3-m17*m4))+m14*(m18*m3-m16*m4)
-                                            +(m16*m19-m17*m18)*m2)
-                     *m6))
-                +m4*(m8*(m14*(m3*m9-m4*m8)+m2*(m19*m8-m17*m9)
-                                          -(m19*m3-m17*m4)*m7)
-                    -m10*(m12*(m3*m9-m4*m8)+m2*(m16*m8-m15*m9)
-                                           -(m16*m3-m15*m4)*m7)
-                    +m1*((-m12*(m19*m8-m17*m9))+m14*(m16*m8-m15*m9)
-                                               +(m15*m19-m16*m17)*m7)
-                    -((-m12*(m19*m3-m17*m4))+m14*(m16*m3-m15*m4)
-                                            +(m15*m19-m16*m17)*m2)
-                     *m6)
-                -m5*(m8*(m13*(m3*m9-m4*m8)+m2*(m18*m8-m16*m9)
-                                          -(m18*m3-m16*m4)*m7)
-                    -m9*(m12*(m3*m9-m4*m8)+m2*(m16*m8-m15*m9)
-                                          -(m16*m3-m15*m4)*m7)
-                    +m1*((-m12*(m18*m8-m16*m9))+m13*(m16*m8-m15*m9)
-                                               +(m15*m18-m16^2)*m7)
-                    -((-m12*(m18*m3-m16*m4))+m13*(m16*m3-m15*m4)
-                                            +(m15*m18-m16^2)*m2)
-                     *m6)
-                -m0*((-m8*((-m13*(m19*m8-m17*m9))+m14*(m18*m8-m16*m9)
-                                                 +(m16*m19-m17*m18)*m7))
-                    +m9*((-m12*(m19*m8-m17*m9))+m14*(m16*m8-m15*m9)
-                                               +(m15*m19-m16*m17)*m7)
-                    -m10*((-m12*(m18*m8-m16*m9))+m13*(m16*m8-m15*m9)
-                                                +(m15*m18-m16^2)*m7)
-                    +(m12*(m16*m19-m17*m18)-m13*(m15*m19-m16*m17)
-                                           +m14*(m15*m18-m16^2))
-                     *m6)
-                +m1*(((-m12*(m19*m3-m17*m4))+m14*(m16*m3-m15*m4)
-                                            +(m15*m19-m16*m17)*m2)
-                    *m9
-                    -((-m13*(m19*m3-m17*m4))+m14*(m18*m3-m16*m4)
-                                            +(m16*m19-m17*m18)*m2)
-                     *m8
-                    -m10*((-m12*(m18*m3-m16*m4))+m13*(m16*m3-m15*m4)
-                                                +(m15*m18-m16^2)*m2)
-                    +m1*(m12*(m16*m19-m17*m18)-m13*(m15*m19-m16*m17)
-                                              +m14*(m15*m18-m16^2)))],
-              [(-m7*(m13*(m17*(m10*m4-m5*m9)+m3*(m20*m9-m10*m19)
-                                            -(m20*m4-m19*m5)*m8)
-                    -m14*(m16*(m10*m4-m5*m9)+m3*(m19*m9-m10*m18)
-                                            -(m19*m4-m18*m5)*m8)
-                    +m2*((-m16*(m20*m9-m10*m19))+m17*(m19*m9-m10*m18)
-                                                +(m18*m20-m19^2)*m8)
-                    -((-m16*(m20*m4-m19*m5))+m17*(m19*m4-m18*m5)
-                                            +(m18*m20-m19^2)*m3)
-                     *m7))
-                +m9*(m11*(m17*(m10*m4-m5*m9)+m3*(m20*m9-m10*m19)
-                                            -(m20*m4-m19*m5)*m8)
-                    -m14*(m12*(m10*m4-m5*m9)+m3*(m14*m9-m10*m13)
-                                            -(m14*m4-m13*m5)*m8)
-                    +m2*((-m12*(m20*m9-m10*m19))+m17*(m14*m9-m10*m13)
-                                                +(m13*m20-m14*m19)*m8)
-                    -((-m12*(m20*m4-m19*m5))+m17*(m14*m4-m13*m5)
-                                            +(m13*m20-m14*m19)*m3)
-                     *m7)
-                -m10*(m11*(m16*(m10*m4-m5*m9)+m3*(m19*m9-m10*m18)
-                                             -(m19*m4-m18*m5)*m8)
-                     -m13*(m12*(m10*m4-m5*m9)+m3*(m14*m9-m10*m13)
-                                             -(m14*m4-m13*m5)*m8)
-                     +m2*((-m12*(m19*m9-m10*m18))+m16*(m14*m9-m10*m13)
-                                                 +(m13*m19-m14*m18)*m8)
-                     -((-m12*(m19*m4-m18*m5))+m16*(m14*m4-m13*m5)
-                                             +(m13*m19-m14*m18)*m3)
-                      *m7)
-                -m1*((-m11*((-m16*(m20*m9-m10*m19))+m17*(m19*m9-m10*m18)
-                                                   +(m18*m20-m19^2)*m8))
-                    +m13*((-m12*(m20*m9-m10*m19))+m17*(m14*m9-m10*m13)
-                                                 +(m13*m20-m14*m19)*m8)
-                    -m14*((-m12*(m19*m9-m10*m18))+m16*(m14*m9-m10*m13)
-                                                 +(m13*m19-m14*m18)*m8)
-                    +(m12*(m18*m20-m19^2)-m16*(m13*m20-m14*m19)
-                                         +m17*(m13*m19-m14*m18))
-                     *m7)
-                +((-m11*((-m16*(m20*m4-m19*m5))+m17*(m19*m4-m18*m5)
-                                               +(m18*m20-m19^2)*m3))
-                 +m13*((-m12*(m20*m4-m19*m5))+m17*(m14*m4-m13*m5)
-                                             +(m13*m20-m14*m19)*m3)
-                 -m14*((-m12*(m19*m4-m18*m5))+m16*(m14*m4-m13*m5)
-                                             +(m13*m19-m14*m18)*m3)
-                 +m2*(m12*(m18*m20-m19^2)-m16*(m13*m20-m14*m19)
-                                         +m17*(m13*m19-m14*m18)))
-                 *m6,
-               m2*(m13*(m17*(m10*m4-m5*m9)+m3*(m20*m9-m10*m19)
-                                          -(m20*m4-m19*m5)*m8)
-                  -m14*(m16*(m10*m4-m5*m9)+m3*(m19*m9-m10*m18)
-                                          -(m19*m4-m18*m5)*m8)
-                  +m2*((-m16*(m20*m9-m10*m19))+m17*(m19*m9-m10*m18)
-                                              +(m18*m20-m19^2)*m8)
-                  -((-m16*(m20*m4-m19*m5))+m17*(m19*m4-m18*m5)
-                                          +(m18*m20-m19^2)*m3)
-                   *m7)
-                -m4*(m11*(m17*(m10*m4-m5*m9)+m3*(m20*m9-m10*m19)
-                                            -(m20*m4-m19*m5)*m8)
-                    -m14*(m12*(m10*m4-m5*m9)+m3*(m14*m9-m10*m13)
-                                            -(m14*m4-m13*m5)*m8)
-                    +m2*((-m12*(m20*m9-m10*m19))+m17*(m14*m9-m10*m13)
-                                                +(m13*m20-m14*m19)*m8)
-                    -((-m12*(m20*m4-m19*m5))+m17*(m14*m4-m13*m5)
-                                            +(m13*m20-m14*m19)*m3)
-                     *m7)
-                +m5*(m11*(m16*(m10*m4-m5*m9)+m3*(m19*m9-m10*m18)
-                                            -(m19*m4-m18*m5)*m8)
-                    -m13*(m12*(m10*m4-m5*m9)+m3*(m14*m9-m10*m13)
-                                            -(m14*m4-m13*m5)*m8)
-                    +m2*((-m12*(m19*m9-m10*m18))+m16*(m14*m9-m10*m13)
-                                                +(m13*m19-m14*m18)*m8)
-                    -((-m12*(m19*m4-m18*m5))+m16*(m14*m4-m13*m5)
-                                            +(m13*m19-m14*m18)*m3)
-                     *m7)
-                +m0*((-m11*((-m16*(m20*m9-m10*m19))+m17*(m19*m9-m10*m18)
-                                                   +(m18*m20-m19^2)*m8))
-                    +m13*((-m12*(m20*m9-m10*m19))+m17*(m14*m9-m10*m13)
-                                                 +(m13*m20-m14*m19)*m8)
-                    -m14*((-m12*(m19*m9-m10*m18))+m16*(m14*m9-m10*m13)
-                                                 +(m13*m19-m14*m18)*m8)
-                    +(m12*(m18*m20-m19^2)-m16*(m13*m20-m14*m19)
-                                         +m17*(m13*m19-m14*m18))
-                     *m7)
-                -m1*((-m11*((-m16*(m20*m4-m19*m5))+m17*(m19*m4-m18*m5)
-                                                  +(m18*m20-m19^2)*m3))
-                    +m13*((-m12*(m20*m4-m19*m5))+m17*(m14*m4-m13*m5)
-                                                +(m13*m20-m14*m19)*m3)
-                    -m14*((-m12*(m19*m4-m18*m5))+m16*(m14*m4-m13*m5)
-                                                +(m13*m19-m14*m18)*m3)
-                    +m2*(m12*(m18*m20-m19^2)-m16*(m13*m20-m14*m19)
-                                            +m17*(m13*m19-m14*m18))),
-               (-m2*(m9*(m17*(m10*m4-m5*m9)+m3*(m20*m9-m10*m19)
-                                           -(m20*m4-m19*m5)*m8)
-                    -m10*(m16*(m10*m4-m5*m9)+m3*(m19*m9-m10*m18)
-                                            -(m19*m4-m18*m5)*m8)
-                    +m1*((-m16*(m20*m9-m10*m19))+m17*(m19*m9-m10*m18)
-                                                +(m18*m20-m19^2)*m8)
-                    -((-m16*(m20*m4-m19*m5))+m17*(m19*m4-m18*m5)
-                                            +(m18*m20-m19^2)*m3)
-                     *m6))
-                +m4*(m7*(m17*(m10*m4-m5*m9)+m3*(m20*m9-m10*m19)
-                                           -(m20*m4-m19*m5)*m8)
-                    -m10*(m12*(m10*m4-m5*m9)+m3*(m14*m9-m10*m13)
-                                            -(m14*m4-m13*m5)*m8)
-                    +m1*((-m12*(m20*m9-m10*m19))+m17*(m14*m9-m10*m13)
-                                                +(m13*m20-m14*m19)*m8)
-                    -((-m12*(m20*m4-m19*m5))+m17*(m14*m4-m13*m5)
-                                            +(m13*m20-m14*m19)*m3)
-                     *m6)
-                -m5*(m7*(m16*(m10*m4-m5*m9)+m3*(m19*m9-m10*m18)
-                                           -(m19*m4-m18*m5)*m8)
-                    -m9*(m12*(m10*m4-m5*m9)+m3*(m14*m9-m10*m13)
-                                           -(m14*m4-m13*m5)*m8)
-                    +m1*((-m12*(m19*m9-m10*m18))+m16*(m14*m9-m10*m13)
-                                                +(m13*m19-m14*m18)*m8)
-                    -((-m12*(m19*m4-m18*m5))+m16*(m14*m4-m13*m5)
-                                            +(m13*m19-m14*m18)*m3)
-                     *m6)
-                -m0*((-m7*((-m16*(m20*m9-m10*m19))+m17*(m19*m9-m10*m18)
-                                                  +(m18*m20-m19^2)*m8))
-                    +m9*((-m12*(m20*m9-m10*m19))+m17*(m14*m9-m10*m13)
-                                                +(m13*m20-m14*m19)*m8)
-                    -m10*((-m12*(m19*m9-m10*m18))+m16*(m14*m9-m10*m13)
-                                                 +(m13*m19-m14*m18)*m8)
-                    +(m12*(m18*m20-m19^2)-m16*(m13*m20-m14*m19)
-                                         +m17*(m13*m19-m14*m18))
-                     *m6)
-                +m1*(((-m12*(m20*m4-m19*m5))+m17*(m14*m4-m13*m5)
-                                            +(m13*m20-m14*m19)*m3)
-                    *m9
-                    -((-m16*(m20*m4-m19*m5))+m17*(m19*m4-m18*m5)
-                                            +(m18*m20-m19^2)*m3)
-                     *m7
-                    -m10*((-m12*(m19*m4-m18*m5))+m16*(m14*m4-m13*m5)
-                                                +(m13*m19-m14*m18)*m3)
-                    +m1*(m12*(m18*m20-m19^2)-m16*(m13*m20-m14*m19)
-                                            +m17*(m13*m19-m14*m18))),
-               m2*(m9*(m14*(m10*m4-m5*m9)+m2*(m20*m9-m10*m19)
-                                         -(m20*m4-m19*m5)*m7)
-                  -m10*(m13*(m10*m4-m5*m9)+m2*(m19*m9-m10*m18)
-                                          -(m19*m4-m18*m5)*m7)
-                  +m1*((-m13*(m20*m9-m10*m19))+m14*(m19*m9-m10*m18)
-                                              +(m18*m20-m19^2)*m7)
-                  -((-m13*(m20*m4-m19*m5))+m14*(m19*m4-m18*m5)
-                                          +m2*(m18*m20-m19^2))
-                   *m6)
-                -m4*(m7*(m14*(m10*m4-m5*m9)+m2*(m20*m9-m10*m19)
-                                           -(m20*m4-m19*m5)*m7)
-                    -m10*(m11*(m10*m4-m5*m9)+m2*(m14*m9-m10*m13)
-                                            -(m14*m4-m13*m5)*m7)
-                    +m1*((-m11*(m20*m9-m10*m19))+m14*(m14*m9-m10*m13)
-                                                +(m13*m20-m14*m19)*m7)
-                    -((-m11*(m20*m4-m19*m5))+m14*(m14*m4-m13*m5)
-                                            +m2*(m13*m20-m14*m19))
-                     *m6)
-                +m5*(m7*(m13*(m10*m4-m5*m9)+m2*(m19*m9-m10*m18)
-                                           -(m19*m4-m18*m5)*m7)
-                    -m9*(m11*(m10*m4-m5*m9)+m2*(m14*m9-m10*m13)
-                                           -(m14*m4-m13*m5)*m7)
-                    +m1*((-m11*(m19*m9-m10*m18))+m13*(m14*m9-m10*m13)
-                                                +(m13*m19-m14*m18)*m7)
-                    -((-m11*(m19*m4-m18*m5))+m13*(m14*m4-m13*m5)
-                                            +(m13*m19-m14*m18)*m2)
-                     *m6)
-                +m0*((-m7*((-m13*(m20*m9-m10*m19))+m14*(m19*m9-m10*m18)
-                                                  +(m18*m20-m19^2)*m7))
-                    +m9*((-m11*(m20*m9-m10*m19))+m14*(m14*m9-m10*m13)
-                                                +(m13*m20-m14*m19)*m7)
-                    -m10*((-m11*(m19*m9-m10*m18))+m13*(m14*m9-m10*m13)
-                                                 +(m13*m19-m14*m18)*m7)
-                    +(m11*(m18*m20-m19^2)-m13*(m13*m20-m14*m19)
-                                         +m14*(m13*m19-m14*m18))
-                     *m6)
-                -m1*(((-m11*(m20*m4-m19*m5))+m14*(m14*m4-m13*m5)
-                                            +m2*(m13*m20-m14*m19))
-                    *m9
-                    -((-m13*(m20*m4-m19*m5))+m14*(m19*m4-m18*m5)
-                                            +m2*(m18*m20-m19^2))
-                     *m7
-                    -m10*((-m11*(m19*m4-m18*m5))+m13*(m14*m4-m13*m5)
-                                                +(m13*m19-m14*m18)*m2)
-                    +m1*(m11*(m18*m20-m19^2)-m13*(m13*m20-m14*m19)
-                                            +m14*(m13*m19-m14*m18))),
-               (-m2*((m14*(m10*m3-m5*m8)+m2*(m20*m8-m10*m17)
-                                        -(m20*m3-m17*m5)*m7)
-                    *m9
-                    -m10*(m13*(m10*m3-m5*m8)+m2*(m19*m8-m10*m16)
-                                            -(m19*m3-m16*m5)*m7)
-                    +m1*((-m13*(m20*m8-m10*m17))+m14*(m19*m8-m10*m16)
-                                                +(m16*m20-m17*m19)*m7)
-                    -((-m13*(m20*m3-m17*m5))+m14*(m19*m3-m16*m5)
-                                            +m2*(m16*m20-m17*m19))
-                     *m6))
-                -m5*((-(m11*(m10*m3-m5*m8)+m2*(m14*m8-m10*m12)
-                                          -(m14*m3-m12*m5)*m7)
-                    *m9)
-                    +m7*(m13*(m10*m3-m5*m8)+m2*(m19*m8-m10*m16)
-                                           -(m19*m3-m16*m5)*m7)
-                    +m1*((-m11*(m19*m8-m10*m16))+m13*(m14*m8-m10*m12)
-                                                +(m12*m19-m14*m16)*m7)
-                    -((-m11*(m19*m3-m16*m5))+m13*(m14*m3-m12*m5)
-                                            +(m12*m19-m14*m16)*m2)
-                     *m6)
-                -m0*(((-m11*(m20*m8-m10*m17))+m14*(m14*m8-m10*m12)
-                                             +(m12*m20-m14*m17)*m7)
-                    *m9
-                    -m7*((-m13*(m20*m8-m10*m17))+m14*(m19*m8-m10*m16)
-                                                +(m16*m20-m17*m19)*m7)
-                    -m10*((-m11*(m19*m8-m10*m16))+m13*(m14*m8-m10*m12)
-                                                 +(m12*m19-m14*m16)*m7)
-                    +(m11*(m16*m20-m17*m19)-m13*(m12*m20-m14*m17)
-                                           +m14*(m12*m19-m14*m16))
-                     *m6)
-                +m1*(((-m11*(m20*m3-m17*m5))+m14*(m14*m3-m12*m5)
-                                            +m2*(m12*m20-m14*m17))
-                    *m9
-                    -((-m13*(m20*m3-m17*m5))+m14*(m19*m3-m16*m5)
-                                            +m2*(m16*m20-m17*m19))
-                     *m7
-                    -m10*((-m11*(m19*m3-m16*m5))+m13*(m14*m3-m12*m5)
-                                                +(m12*m19-m14*m16)*m2)
-                    +m1*(m11*(m16*m20-m17*m19)-m13*(m12*m20-m14*m17)
-                                              +m14*(m12*m19-m14*m16)))
-                +m4*(m7*(m14*(m10*m3-m5*m8)+m2*(m20*m8-m10*m17)
-                                           -(m20*m3-m17*m5)*m7)
-                    -m10*(m11*(m10*m3-m5*m8)+m2*(m14*m8-m10*m12)
-                                            -(m14*m3-m12*m5)*m7)
-                    +m1*((-m11*(m20*m8-m10*m17))+m14*(m14*m8-m10*m12)
-                                                +(m12*m20-m14*m17)*m7)
-                    -((-m11*(m20*m3-m17*m5))+m14*(m14*m3-m12*m5)
-                                            +m2*(m12*m20-m14*m17))
-                     *m6),
-               m2*(m9*(m14*(m3*m9-m4*m8)+m2*(m19*m8-m17*m9)
-                                        -(m19*m3-m17*m4)*m7)
-                  -m10*(m13*(m3*m9-m4*m8)+m2*(m18*m8-m16*m9)
-                                         -(m18*m3-m16*m4)*m7)
-                  +m1*((-m13*(m19*m8-m17*m9))+m14*(m18*m8-m16*m9)
-                                             +(m16*m19-m17*m18)*m7)
-                  -((-m13*(m19*m3-m17*m4))+m14*(m18*m3-m16*m4)
-                                          +(m16*m19-m17*m18)*m2)
-                   *m6)
-                -m4*(m7*(m14*(m3*m9-m4*m8)+m2*(m19*m8-m17*m9)
-                                          -(m19*m3-m17*m4)*m7)
-                    -m10*(m11*(m3*m9-m4*m8)+m2*(m13*m8-m12*m9)
-                                           -(m13*m3-m12*m4)*m7)
-                    +m1*((-m11*(m19*m8-m17*m9))+m14*(m13*m8-m12*m9)
-                                               +(m12*m19-m13*m17)*m7)
-                    -((-m11*(m19*m3-m17*m4))+m14*(m13*m3-m12*m4)
-                                            +(m12*m19-m13*m17)*m2)
-                     *m6)
-                +m5*(m7*(m13*(m3*m9-m4*m8)+m2*(m18*m8-m16*m9)
-                                          -(m18*m3-m16*m4)*m7)
-                    -m9*(m11*(m3*m9-m4*m8)+m2*(m13*m8-m12*m9)
-                                          -(m13*m3-m12*m4)*m7)
-                    +m1*((-m11*(m18*m8-m16*m9))+m13*(m13*m8-m12*m9)
-                                               +(m12*m18-m13*m16)*m7)
-                    -((-m11*(m18*m3-m16*m4))+m13*(m13*m3-m12*m4)
-                                            +(m12*m18-m13*m16)*m2)
-                     *m6)
-                +m0*((-m7*((-m13*(m19*m8-m17*m9))+m14*(m18*m8-m16*m9)
-                                                 +(m16*m19-m17*m18)*m7))
-                    +m9*((-m11*(m19*m8-m17*m9))+m14*(m13*m8-m12*m9)
-                                               +(m12*m19-m13*m17)*m7)
-                    -m10*((-m11*(m18*m8-m16*m9))+m13*(m13*m8-m12*m9)
-                                                +(m12*m18-m13*m16)*m7)
-                    +(m11*(m16*m19-m17*m18)-m13*(m12*m19-m13*m17)
-                                           +m14*(m12*m18-m13*m16))
-                     *m6)
-                -m1*(((-m11*(m19*m3-m17*m4))+m14*(m13*m3-m12*m4)
-                                            +(m12*m19-m13*m17)*m2)
-                    *m9
-                    -((-m13*(m19*m3-m17*m4))+m14*(m18*m3-m16*m4)
-                                            +(m16*m19-m17*m18)*m2)
-                     *m7
-                    -m10*((-m11*(m18*m3-m16*m4))+m13*(m13*m3-m12*m4)
-                                                +(m12*m18-m13*m16)*m2)
-                    +m1*(m11*(m16*m19-m17*m18)-m13*(m12*m19-m13*m17)
-                                              +m14*(m12*m18-m13*m16)))],
-              [m7*(m12*(m17*(m10*m4-m5*m9)+m3*(m20*m9-m10*m19)
-                                          -(m20*m4-m19*m5)*m8)
-                  -m14*(m15*(m10*m4-m5*m9)+m3*(m17*m9-m10*m16)
-                                          -(m17*m4-m16*m5)*m8)
-                  +m2*((-m15*(m20*m9-m10*m19))+m17*(m17*m9-m10*m16)
-                                              +(m16*m20-m17*m19)*m8)
-                  -((-m15*(m20*m4-m19*m5))+m17*(m17*m4-m16*m5)
-                                          +(m16*m20-m17*m19)*m3)
-                   *m7)
-                -m8*(m11*(m17*(m10*m4-m5*m9)+m3*(m20*m9-m10*m19)
-                                            -(m20*m4-m19*m5)*m8)
-                    -m14*(m12*(m10*m4-m5*m9)+m3*(m14*m9-m10*m13)
-                                            -(m14*m4-m13*m5)*m8)
-                    +m2*((-m12*(m20*m9-m10*m19))+m17*(m14*m9-m10*m13)
-                                                +(m13*m20-m14*m19)*m8)
-                    -((-m12*(m20*m4-m19*m5))+m17*(m14*m4-m13*m5)
-                                            +(m13*m20-m14*m19)*m3)
-                     *m7)
-                +m10*(m11*(m15*(m10*m4-m5*m9)+m3*(m17*m9-m10*m16)
-                                             -(m17*m4-m16*m5)*m8)
-                     -m12*(m12*(m10*m4-m5*m9)+m3*(m14*m9-m10*m13)
-                                             -(m14*m4-m13*m5)*m8)
-                     +m2*((-m12*(m17*m9-m10*m16))+m15*(m14*m9-m10*m13)
-                                                 +(m13*m17-m14*m16)*m8)
-                     -((-m12*(m17*m4-m16*m5))+m15*(m14*m4-m13*m5)
-                                             +(m13*m17-m14*m16)*m3)
-                      *m7)
-                +m1*((-m11*((-m15*(m20*m9-m10*m19))+m17*(m17*m9-m10*m16)
-                                                   +(m16*m20-m17*m19)*m8))
-                    +m12*((-m12*(m20*m9-m10*m19))+m17*(m14*m9-m10*m13)
-                                                 +(m13*m20-m14*m19)*m8)
-                    -m14*((-m12*(m17*m9-m10*m16))+m15*(m14*m9-m10*m13)
-                                                 +(m13*m17-m14*m16)*m8)
-                    +(m12*(m16*m20-m17*m19)-m15*(m13*m20-m14*m19)
-                                           +m17*(m13*m17-m14*m16))
-                     *m7)
-                -((-m11*((-m15*(m20*m4-m19*m5))+m17*(m17*m4-m16*m5)
-                                               +(m16*m20-m17*m19)*m3))
-                 +m12*((-m12*(m20*m4-m19*m5))+m17*(m14*m4-m13*m5)
-                                             +(m13*m20-m14*m19)*m3)
-                 -m14*((-m12*(m17*m4-m16*m5))+m15*(m14*m4-m13*m5)
-                                             +(m13*m17-m14*m16)*m3)
-                 +m2*(m12*(m16*m20-m17*m19)-m15*(m13*m20-m14*m19)
-                                           +m17*(m13*m17-m14*m16)))
-                 *m6,
-               (-m2*(m12*(m17*(m10*m4-m5*m9)+m3*(m20*m9-m10*m19)
-                                            -(m20*m4-m19*m5)*m8)
-                    -m14*(m15*(m10*m4-m5*m9)+m3*(m17*m9-m10*m16)
-                                            -(m17*m4-m16*m5)*m8)
-                    +m2*((-m15*(m20*m9-m10*m19))+m17*(m17*m9-m10*m16)
-                                                +(m16*m20-m17*m19)*m8)
-                    -((-m15*(m20*m4-m19*m5))+m17*(m17*m4-m16*m5)
-                                            +(m16*m20-m17*m19)*m3)
-                     *m7))
-                +m3*(m11*(m17*(m10*m4-m5*m9)+m3*(m20*m9-m10*m19)
-                                            -(m20*m4-m19*m5)*m8)
-                    -m14*(m12*(m10*m4-m5*m9)+m3*(m14*m9-m10*m13)
-                                            -(m14*m4-m13*m5)*m8)
-                    +m2*((-m12*(m20*m9-m10*m19))+m17*(m14*m9-m10*m13)
-                                                +(m13*m20-m14*m19)*m8)
-                    -((-m12*(m20*m4-m19*m5))+m17*(m14*m4-m13*m5)
-                                            +(m13*m20-m14*m19)*m3)
-                     *m7)
-                -m5*(m11*(m15*(m10*m4-m5*m9)+m3*(m17*m9-m10*m16)
-                                            -(m17*m4-m16*m5)*m8)
-                    -m12*(m12*(m10*m4-m5*m9)+m3*(m14*m9-m10*m13)
-                                            -(m14*m4-m13*m5)*m8)
-                    +m2*((-m12*(m17*m9-m10*m16))+m15*(m14*m9-m10*m13)
-                                                +(m13*m17-m14*m16)*m8)
-                    -((-m12*(m17*m4-m16*m5))+m15*(m14*m4-m13*m5)
-                                            +(m13*m17-m14*m16)*m3)
-                     *m7)
-                -m0*((-m11*((-m15*(m20*m9-m10*m19))+m17*(m17*m9-m10*m16)
-                                                   +(m16*m20-m17*m19)*m8))
-                    +m12*((-m12*(m20*m9-m10*m19))+m17*(m14*m9-m10*m13)
-                                                 +(m13*m20-m14*m19)*m8)
-                    -m14*((-m12*(m17*m9-m10*m16))+m15*(m14*m9-m10*m13)
-                                                 +(m13*m17-m14*m16)*m8)
-                    +(m12*(m16*m20-m17*m19)-m15*(m13*m20-m14*m19)
-                                           +m17*(m13*m17-m14*m16))
-                     *m7)
-                +m1*((-m11*((-m15*(m20*m4-m19*m5))+m17*(m17*m4-m16*m5)
-                                                  +(m16*m20-m17*m19)*m3))
-                    +m12*((-m12*(m20*m4-m19*m5))+m17*(m14*m4-m13*m5)
-                                                +(m13*m20-m14*m19)*m3)
-                    -m14*((-m12*(m17*m4-m16*m5))+m15*(m14*m4-m13*m5)
-                                                +(m13*m17-m14*m16)*m3)
-                    +m2*(m12*(m16*m20-m17*m19)-m15*(m13*m20-m14*m19)
-                                              +m17*(m13*m17-m14*m16))),
-               m2*(m8*(m17*(m10*m4-m5*m9)+m3*(m20*m9-m10*m19)
-                                         -(m20*m4-m19*m5)*m8)
-                  -m10*(m15*(m10*m4-m5*m9)+m3*(m17*m9-m10*m16)
-                                          -(m17*m4-m16*m5)*m8)
-                  +m1*((-m15*(m20*m9-m10*m19))+m17*(m17*m9-m10*m16)
-                                              +(m16*m20-m17*m19)*m8)
-                  -((-m15*(m20*m4-m19*m5))+m17*(m17*m4-m16*m5)
-                                          +(m16*m20-m17*m19)*m3)
-                   *m6)
-                -m3*(m7*(m17*(m10*m4-m5*m9)+m3*(m20*m9-m10*m19)
-                                           -(m20*m4-m19*m5)*m8)
-                    -m10*(m12*(m10*m4-m5*m9)+m3*(m14*m9-m10*m13)
-                                            -(m14*m4-m13*m5)*m8)
-                    +m1*((-m12*(m20*m9-m10*m19))+m17*(m14*m9-m10*m13)
-                                                +(m13*m20-m14*m19)*m8)
-                    -((-m12*(m20*m4-m19*m5))+m17*(m14*m4-m13*m5)
-                                            +(m13*m20-m14*m19)*m3)
-                     *m6)
-                +m5*(m7*(m15*(m10*m4-m5*m9)+m3*(m17*m9-m10*m16)
-                                           -(m17*m4-m16*m5)*m8)
-                    -m8*(m12*(m10*m4-m5*m9)+m3*(m14*m9-m10*m13)
-                                           -(m14*m4-m13*m5)*m8)
-                    +m1*((-m12*(m17*m9-m10*m16))+m15*(m14*m9-m10*m13)
-                                                +(m13*m17-m14*m16)*m8)
-                    -((-m12*(m17*m4-m16*m5))+m15*(m14*m4-m13*m5)
-                                            +(m13*m17-m14*m16)*m3)
-                     *m6)
-                +m0*((-m7*((-m15*(m20*m9-m10*m19))+m17*(m17*m9-m10*m16)
-                                                  +(m16*m20-m17*m19)*m8))
-                    +m8*((-m12*(m20*m9-m10*m19))+m17*(m14*m9-m10*m13)
-                                                +(m13*m20-m14*m19)*m8)
-                    -m10*((-m12*(m17*m9-m10*m16))+m15*(m14*m9-m10*m13)
-                                                 +(m13*m17-m14*m16)*m8)
-                    +(m12*(m16*m20-m17*m19)-m15*(m13*m20-m14*m19)
-                                           +m17*(m13*m17-m14*m16))
-                     *m6)
-                -m1*(((-m12*(m20*m4-m19*m5))+m17*(m14*m4-m13*m5)
-                                            +(m13*m20-m14*m19)*m3)
-                    *m8
-                    -((-m15*(m20*m4-m19*m5))+m17*(m17*m4-m16*m5)
-                                            +(m16*m20-m17*m19)*m3)
-                     *m7
-                    -m10*((-m12*(m17*m4-m16*m5))+m15*(m14*m4-m13*m5)
-                                                +(m13*m17-m14*m16)*m3)
-                    +m1*(m12*(m16*m20-m17*m19)-m15*(m13*m20-m14*m19)
-                                              +m17*(m13*m17-m14*m16))),
-               (-m2*(m8*(m14*(m10*m4-m5*m9)+m2*(m20*m9-m10*m19)
-                                           -(m20*m4-m19*m5)*m7)
-                    -m10*(m12*(m10*m4-m5*m9)+m2*(m17*m9-m10*m16)
-                                            -(m17*m4-m16*m5)*m7)
-                    +m1*((-m12*(m20*m9-m10*m19))+m14*(m17*m9-m10*m16)
-                                                +(m16*m20-m17*m19)*m7)
-                    -((-m12*(m20*m4-m19*m5))+m14*(m17*m4-m16*m5)
-                                            +m2*(m16*m20-m17*m19))
-                     *m6))
-                +m3*(m7*(m14*(m10*m4-m5*m9)+m2*(m20*m9-m10*m19)
-                                           -(m20*m4-m19*m5)*m7)
-                    -m10*(m11*(m10*m4-m5*m9)+m2*(m14*m9-m10*m13)
-                                            -(m14*m4-m13*m5)*m7)
-                    +m1*((-m11*(m20*m9-m10*m19))+m14*(m14*m9-m10*m13)
-                                                +(m13*m20-m14*m19)*m7)
-                    -((-m11*(m20*m4-m19*m5))+m14*(m14*m4-m13*m5)
-                                            +m2*(m13*m20-m14*m19))
-                     *m6)
-                -m5*(m7*(m12*(m10*m4-m5*m9)+m2*(m17*m9-m10*m16)
-                                           -(m17*m4-m16*m5)*m7)
-                    -m8*(m11*(m10*m4-m5*m9)+m2*(m14*m9-m10*m13)
-                                           -(m14*m4-m13*m5)*m7)
-                    +m1*((-m11*(m17*m9-m10*m16))+m12*(m14*m9-m10*m13)
-                                                +(m13*m17-m14*m16)*m7)
-                    -((-m11*(m17*m4-m16*m5))+m12*(m14*m4-m13*m5)
-                                            +(m13*m17-m14*m16)*m2)
-                     *m6)
-                -m0*((-m7*((-m12*(m20*m9-m10*m19))+m14*(m17*m9-m10*m16)
-                                                  +(m16*m20-m17*m19)*m7))
-                    +m8*((-m11*(m20*m9-m10*m19))+m14*(m14*m9-m10*m13)
-                                                +(m13*m20-m14*m19)*m7)
-                    -m10*((-m11*(m17*m9-m10*m16))+m12*(m14*m9-m10*m13)
-                                                 +(m13*m17-m14*m16)*m7)
-                    +(m11*(m16*m20-m17*m19)-m12*(m13*m20-m14*m19)
-                                           +m14*(m13*m17-m14*m16))
-                     *m6)
-                +m1*(((-m11*(m20*m4-m19*m5))+m14*(m14*m4-m13*m5)
-                                            +m2*(m13*m20-m14*m19))
-                    *m8
-                    -((-m12*(m20*m4-m19*m5))+m14*(m17*m4-m16*m5)
-                                            +m2*(m16*m20-m17*m19))
-                     *m7
-                    -m10*((-m11*(m17*m4-m16*m5))+m12*(m14*m4-m13*m5)
-                                                +(m13*m17-m14*m16)*m2)
-                    +m1*(m11*(m16*m20-m17*m19)-m12*(m13*m20-m14*m19)
-                                              +m14*(m13*m17-m14*m16))),
-               m2*(m8*(m14*(m10*m3-m5*m8)+m2*(m20*m8-m10*m17)
-                                         -(m20*m3-m17*m5)*m7)
-                  -m10*(m12*(m10*m3-m5*m8)+m2*(m17*m8-m10*m15)
-                                          -(m17*m3-m15*m5)*m7)
-                  +m1*((-m12*(m20*m8-m10*m17))+m14*(m17*m8-m10*m15)
-                                              +(m15*m20-m17^2)*m7)
-                  -((-m12*(m20*m3-m17*m5))+m14*(m17*m3-m15*m5)
-                                          +m2*(m15*m20-m17^2))
-                   *m6)
-                -m3*(m7*(m14*(m10*m3-m5*m8)+m2*(m20*m8-m10*m17)
-                                           -(m20*m3-m17*m5)*m7)
-                    -m10*(m11*(m10*m3-m5*m8)+m2*(m14*m8-m10*m12)
-                                            -(m14*m3-m12*m5)*m7)
-                    +m1*((-m11*(m20*m8-m10*m17))+m14*(m14*m8-m10*m12)
-                                                +(m12*m20-m14*m17)*m7)
-                    -((-m11*(m20*m3-m17*m5))+m14*(m14*m3-m12*m5)
-                                            +m2*(m12*m20-m14*m17))
-                     *m6)
-                +m5*(m7*(m12*(m10*m3-m5*m8)+m2*(m17*m8-m10*m15)
-                                           -(m17*m3-m15*m5)*m7)
-                    -m8*(m11*(m10*m3-m5*m8)+m2*(m14*m8-m10*m12)
-                                           -(m14*m3-m12*m5)*m7)
-                    +m1*((-m11*(m17*m8-m10*m15))+m12*(m14*m8-m10*m12)
-                                                +(m12*m17-m14*m15)*m7)
-                    -((-m11*(m17*m3-m15*m5))+m12*(m14*m3-m12*m5)
-                                            +(m12*m17-m14*m15)*m2)
-                     *m6)
-                +m0*((-m7*((-m12*(m20*m8-m10*m17))+m14*(m17*m8-m10*m15)
-                                                  +(m15*m20-m17^2)*m7))
-                    +m8*((-m11*(m20*m8-m10*m17))+m14*(m14*m8-m10*m12)
-                                                +(m12*m20-m14*m17)*m7)
-                    -m10*((-m11*(m17*m8-m10*m15))+m12*(m14*m8-m10*m12)
-                                                 +(m12*m17-m14*m15)*m7)
-                    +(m11*(m15*m20-m17^2)-m12*(m12*m20-m14*m17)
-                                         +m14*(m12*m17-m14*m15))
-                     *m6)
-                -m1*(((-m11*(m20*m3-m17*m5))+m14*(m14*m3-m12*m5)
-                                            +m2*(m12*m20-m14*m17))
-                    *m8
-                    -((-m12*(m20*m3-m17*m5))+m14*(m17*m3-m15*m5)
-                                            +m2*(m15*m20-m17^2))
-                     *m7
-                    -m10*((-m11*(m17*m3-m15*m5))+m12*(m14*m3-m12*m5)
-                                                +(m12*m17-m14*m15)*m2)
-                    +m1*(m11*(m15*m20-m17^2)-m12*(m12*m20-m14*m17)
-                                            +m14*(m12*m17-m14*m15))),
-               (-m2*(m8*(m14*(m3*m9-m4*m8)+m2*(m19*m8-m17*m9)
-                                          -(m19*m3-m17*m4)*m7)
-                    -m10*(m12*(m3*m9-m4*m8)+m2*(m16*m8-m15*m9)
-                                           -(m16*m3-m15*m4)*m7)
-                    +m1*((-m12*(m19*m8-m17*m9))+m14*(m16*m8-m15*m9)
-                                               +(m15*m19-m16*m17)*m7)
-                    -((-m12*(m19*m3-m17*m4))+m14*(m16*m3-m15*m4)
-                                            +(m15*m19-m16*m17)*m2)
-                     *m6))
-                +m3*(m7*(m14*(m3*m9-m4*m8)+m2*(m19*m8-m17*m9)
-                                          -(m19*m3-m17*m4)*m7)
-                    -m10*(m11*(m3*m9-m4*m8)+m2*(m13*m8-m12*m9)
-                                           -(m13*m3-m12*m4)*m7)
-                    +m1*((-m11*(m19*m8-m17*m9))+m14*(m13*m8-m12*m9)
-                                               +(m12*m19-m13*m17)*m7)
-                    -((-m11*(m19*m3-m17*m4))+m14*(m13*m3-m12*m4)
-                                            +(m12*m19-m13*m17)*m2)
-                     *m6)
-                -m5*(m7*(m12*(m3*m9-m4*m8)+m2*(m16*m8-m15*m9)
-                                          -(m16*m3-m15*m4)*m7)
-                    -m8*(m11*(m3*m9-m4*m8)+m2*(m13*m8-m12*m9)
-                                          -(m13*m3-m12*m4)*m7)
-                    +m1*((-m11*(m16*m8-m15*m9))+m12*(m13*m8-m12*m9)
-                                               +(m12*m16-m13*m15)*m7)
-                    -((-m11*(m16*m3-m15*m4))+m12*(m13*m3-m12*m4)
-                                            +(m12*m16-m13*m15)*m2)
-                     *m6)
-                -m0*((-m7*((-m12*(m19*m8-m17*m9))+m14*(m16*m8-m15*m9)
-                                                 +(m15*m19-m16*m17)*m7))
-                    +m8*((-m11*(m19*m8-m17*m9))+m14*(m13*m8-m12*m9)
-                                               +(m12*m19-m13*m17)*m7)
-                    -m10*((-m11*(m16*m8-m15*m9))+m12*(m13*m8-m12*m9)
-                                                +(m12*m16-m13*m15)*m7)
-                    +(m11*(m15*m19-m16*m17)-m12*(m12*m19-m13*m17)
-                                           +m14*(m12*m16-m13*m15))
-                     *m6)
-                +m1*(((-m11*(m19*m3-m17*m4))+m14*(m13*m3-m12*m4)
-                                            +(m12*m19-m13*m17)*m2)
-                    *m8
-                    -((-m12*(m19*m3-m17*m4))+m14*(m16*m3-m15*m4)
-                                            +(m15*m19-m16*m17)*m2)
-                     *m7
-                    -m10*((-m11*(m16*m3-m15*m4))+m12*(m13*m3-m12*m4)
-                                                +(m12*m16-m13*m15)*m2)
-                    +m1*(m11*(m15*m19-m16*m17)-m12*(m12*m19-m13*m17)
-                                              +m14*(m12*m16-m13*m15)))],
-              [(-m7*(m12*(m16*(m10*m4-m5*m9)+m3*(m19*m9-m10*m18)
-                                            -(m19*m4-m18*m5)*m8)
-                    -m13*(m15*(m10*m4-m5*m9)+m3*(m17*m9-m10*m16)
-                                            -(m17*m4-m16*m5)*m8)
-                    +m2*((-m15*(m19*m9-m10*m18))+m16*(m17*m9-m10*m16)
-                                                +(m16*m19-m17*m18)*m8)
-                    -((-m15*(m19*m4-m18*m5))+m16*(m17*m4-m16*m5)
-                                            +(m16*m19-m17*m18)*m3)
-                     *m7))
-                +m8*(m11*(m16*(m10*m4-m5*m9)+m3*(m19*m9-m10*m18)
-                                            -(m19*m4-m18*m5)*m8)
-                    -m13*(m12*(m10*m4-m5*m9)+m3*(m14*m9-m10*m13)
-                                            -(m14*m4-m13*m5)*m8)
-                    +m2*((-m12*(m19*m9-m10*m18))+m16*(m14*m9-m10*m13)
-                                                +(m13*m19-m14*m18)*m8)
-                    -((-m12*(m19*m4-m18*m5))+m16*(m14*m4-m13*m5)
-                                            +(m13*m19-m14*m18)*m3)
-                     *m7)
-                -m9*(m11*(m15*(m10*m4-m5*m9)+m3*(m17*m9-m10*m16)
-                                            -(m17*m4-m16*m5)*m8)
-                    -m12*(m12*(m10*m4-m5*m9)+m3*(m14*m9-m10*m13)
-                                            -(m14*m4-m13*m5)*m8)
-                    +m2*((-m12*(m17*m9-m10*m16))+m15*(m14*m9-m10*m13)
-                                                +(m13*m17-m14*m16)*m8)
-                    -((-m12*(m17*m4-m16*m5))+m15*(m14*m4-m13*m5)
-                                            +(m13*m17-m14*m16)*m3)
-                     *m7)
-                -m1*((-m11*((-m15*(m19*m9-m10*m18))+m16*(m17*m9-m10*m16)
-                                                   +(m16*m19-m17*m18)*m8))
-                    +m12*((-m12*(m19*m9-m10*m18))+m16*(m14*m9-m10*m13)
-                                                 +(m13*m19-m14*m18)*m8)
-                    -m13*((-m12*(m17*m9-m10*m16))+m15*(m14*m9-m10*m13)
-                                                 +(m13*m17-m14*m16)*m8)
-                    +(m12*(m16*m19-m17*m18)-m15*(m13*m19-m14*m18)
-                                           +m16*(m13*m17-m14*m16))
-                     *m7)
-                +((-m11*((-m15*(m19*m4-m18*m5))+m16*(m17*m4-m16*m5)
-                                               +(m16*m19-m17*m18)*m3))
-                 +m12*((-m12*(m19*m4-m18*m5))+m16*(m14*m4-m13*m5)
-                                             +(m13*m19-m14*m18)*m3)
-                 -m13*((-m12*(m17*m4-m16*m5))+m15*(m14*m4-m13*m5)
-                                             +(m13*m17-m14*m16)*m3)
-                 +(m12*(m16*m19-m17*m18)-m15*(m13*m19-m14*m18)
-                                        +m16*(m13*m17-m14*m16))
-                  *m2)
-                 *m6,
-               m2*(m12*(m16*(m10*m4-m5*m9)+m3*(m19*m9-m10*m18)
-                                          -(m19*m4-m18*m5)*m8)
-                  -m13*(m15*(m10*m4-m5*m9)+m3*(m17*m9-m10*m16)
-                                          -(m17*m4-m16*m5)*m8)
-                  +m2*((-m15*(m19*m9-m10*m18))+m16*(m17*m9-m10*m16)
-                                              +(m16*m19-m17*m18)*m8)
-                  -((-m15*(m19*m4-m18*m5))+m16*(m17*m4-m16*m5)
-                                          +(m16*m19-m17*m18)*m3)
-                   *m7)
-                -m3*(m11*(m16*(m10*m4-m5*m9)+m3*(m19*m9-m10*m18)
-                                            -(m19*m4-m18*m5)*m8)
-                    -m13*(m12*(m10*m4-m5*m9)+m3*(m14*m9-m10*m13)
-                                            -(m14*m4-m13*m5)*m8)
-                    +m2*((-m12*(m19*m9-m10*m18))+m16*(m14*m9-m10*m13)
-                                                +(m13*m19-m14*m18)*m8)
-                    -((-m12*(m19*m4-m18*m5))+m16*(m14*m4-m13*m5)
-                                            +(m13*m19-m14*m18)*m3)
-                     *m7)
-                +m4*(m11*(m15*(m10*m4-m5*m9)+m3*(m17*m9-m10*m16)
-                                            -(m17*m4-m16*m5)*m8)
-                    -m12*(m12*(m10*m4-m5*m9)+m3*(m14*m9-m10*m13)
-                                            -(m14*m4-m13*m5)*m8)
-                    +m2*((-m12*(m17*m9-m10*m16))+m15*(m14*m9-m10*m13)
-                                                +(m13*m17-m14*m16)*m8)
-                    -((-m12*(m17*m4-m16*m5))+m15*(m14*m4-m13*m5)
-                                            +(m13*m17-m14*m16)*m3)
-                     *m7)
-                +m0*((-m11*((-m15*(m19*m9-m10*m18))+m16*(m17*m9-m10*m16)
-                                                   +(m16*m19-m17*m18)*m8))
-                    +m12*((-m12*(m19*m9-m10*m18))+m16*(m14*m9-m10*m13)
-                                                 +(m13*m19-m14*m18)*m8)
-                    -m13*((-m12*(m17*m9-m10*m16))+m15*(m14*m9-m10*m13)
-                                                 +(m13*m17-m14*m16)*m8)
-                    +(m12*(m16*m19-m17*m18)-m15*(m13*m19-m14*m18)
-                                           +m16*(m13*m17-m14*m16))
-                     *m7)
-                -m1*((-m11*((-m15*(m19*m4-m18*m5))+m16*(m17*m4-m16*m5)
-                                                  +(m16*m19-m17*m18)*m3))
-                    +m12*((-m12*(m19*m4-m18*m5))+m16*(m14*m4-m13*m5)
-                                                +(m13*m19-m14*m18)*m3)
-                    -m13*((-m12*(m17*m4-m16*m5))+m15*(m14*m4-m13*m5)
-                                                +(m13*m17-m14*m16)*m3)
-                    +(m12*(m16*m19-m17*m18)-m15*(m13*m19-m14*m18)
-                                           +m16*(m13*m17-m14*m16))
-                     *m2),
-               (-m2*(m8*(m16*(m10*m4-m5*m9)+m3*(m19*m9-m10*m18)
-                                           -(m19*m4-m18*m5)*m8)
-                    -m9*(m15*(m10*m4-m5*m9)+m3*(m17*m9-m10*m16)
-                                           -(m17*m4-m16*m5)*m8)
-                    +m1*((-m15*(m19*m9-m10*m18))+m16*(m17*m9-m10*m16)
-                                                +(m16*m19-m17*m18)*m8)
-                    -((-m15*(m19*m4-m18*m5))+m16*(m17*m4-m16*m5)
-                                            +(m16*m19-m17*m18)*m3)
-                     *m6))
-                +m3*(m7*(m16*(m10*m4-m5*m9)+m3*(m19*m9-m10*m18)
-                                           -(m19*m4-m18*m5)*m8)
-                    -m9*(m12*(m10*m4-m5*m9)+m3*(m14*m9-m10*m13)
-                                           -(m14*m4-m13*m5)*m8)
-                    +m1*((-m12*(m19*m9-m10*m18))+m16*(m14*m9-m10*m13)
-                                                +(m13*m19-m14*m18)*m8)
-                    -((-m12*(m19*m4-m18*m5))+m16*(m14*m4-m13*m5)
-                                            +(m13*m19-m14*m18)*m3)
-                     *m6)
-                -m4*(m7*(m15*(m10*m4-m5*m9)+m3*(m17*m9-m10*m16)
-                                           -(m17*m4-m16*m5)*m8)
-                    -m8*(m12*(m10*m4-m5*m9)+m3*(m14*m9-m10*m13)
-                                           -(m14*m4-m13*m5)*m8)
-                    +m1*((-m12*(m17*m9-m10*m16))+m15*(m14*m9-m10*m13)
-                                                +(m13*m17-m14*m16)*m8)
-                    -((-m12*(m17*m4-m16*m5))+m15*(m14*m4-m13*m5)
-                                            +(m13*m17-m14*m16)*m3)
-                     *m6)
-                -m0*((-m7*((-m15*(m19*m9-m10*m18))+m16*(m17*m9-m10*m16)
-                                                  +(m16*m19-m17*m18)*m8))
-                    +m8*((-m12*(m19*m9-m10*m18))+m16*(m14*m9-m10*m13)
-                                                +(m13*m19-m14*m18)*m8)
-                    -m9*((-m12*(m17*m9-m10*m16))+m15*(m14*m9-m10*m13)
-                                                +(m13*m17-m14*m16)*m8)
-                    +(m12*(m16*m19-m17*m18)-m15*(m13*m19-m14*m18)
-                                           +m16*(m13*m17-m14*m16))
-                     *m6)
-                +m1*((-((-m12*(m17*m4-m16*m5))+m15*(m14*m4-m13*m5)
-                                              +(m13*m17-m14*m16)*m3)
-                    *m9)
-                    +((-m12*(m19*m4-m18*m5))+m16*(m14*m4-m13*m5)
-                                            +(m13*m19-m14*m18)*m3)
-                     *m8
-                    -((-m15*(m19*m4-m18*m5))+m16*(m17*m4-m16*m5)
-                                            +(m16*m19-m17*m18)*m3)
-                     *m7
-                    +m1*(m12*(m16*m19-m17*m18)-m15*(m13*m19-m14*m18)
-                                              +m16*(m13*m17-m14*m16))),
-               m2*(m8*(m13*(m10*m4-m5*m9)+m2*(m19*m9-m10*m18)
-                                         -(m19*m4-m18*m5)*m7)
-                  -m9*(m12*(m10*m4-m5*m9)+m2*(m17*m9-m10*m16)
-                                         -(m17*m4-m16*m5)*m7)
-                  +m1*((-m12*(m19*m9-m10*m18))+m13*(m17*m9-m10*m16)
-                                              +(m16*m19-m17*m18)*m7)
-                  -((-m12*(m19*m4-m18*m5))+m13*(m17*m4-m16*m5)
-                                          +(m16*m19-m17*m18)*m2)
-                   *m6)
-                -m3*(m7*(m13*(m10*m4-m5*m9)+m2*(m19*m9-m10*m18)
-                                           -(m19*m4-m18*m5)*m7)
-                    -m9*(m11*(m10*m4-m5*m9)+m2*(m14*m9-m10*m13)
-                                           -(m14*m4-m13*m5)*m7)
-                    +m1*((-m11*(m19*m9-m10*m18))+m13*(m14*m9-m10*m13)
-                                                +(m13*m19-m14*m18)*m7)
-                    -((-m11*(m19*m4-m18*m5))+m13*(m14*m4-m13*m5)
-                                            +(m13*m19-m14*m18)*m2)
-                     *m6)
-                +m4*(m7*(m12*(m10*m4-m5*m9)+m2*(m17*m9-m10*m16)
-                                           -(m17*m4-m16*m5)*m7)
-                    -m8*(m11*(m10*m4-m5*m9)+m2*(m14*m9-m10*m13)
-                                           -(m14*m4-m13*m5)*m7)
-                    +m1*((-m11*(m17*m9-m10*m16))+m12*(m14*m9-m10*m13)
-                                                +(m13*m17-m14*m16)*m7)
-                    -((-m11*(m17*m4-m16*m5))+m12*(m14*m4-m13*m5)
-                                            +(m13*m17-m14*m16)*m2)
-                     *m6)
-                +m0*((-m7*((-m12*(m19*m9-m10*m18))+m13*(m17*m9-m10*m16)
-                                                  +(m16*m19-m17*m18)*m7))
-                    +m8*((-m11*(m19*m9-m10*m18))+m13*(m14*m9-m10*m13)
-                                                +(m13*m19-m14*m18)*m7)
-                    -m9*((-m11*(m17*m9-m10*m16))+m12*(m14*m9-m10*m13)
-                                                +(m13*m17-m14*m16)*m7)
-                    +(m11*(m16*m19-m17*m18)-m12*(m13*m19-m14*m18)
-                                           +m13*(m13*m17-m14*m16))
-                     *m6)
-                -m1*((-((-m11*(m17*m4-m16*m5))+m12*(m14*m4-m13*m5)
-                                              +(m13*m17-m14*m16)*m2)
-                    *m9)
-                    +((-m11*(m19*m4-m18*m5))+m13*(m14*m4-m13*m5)
-                                            +(m13*m19-m14*m18)*m2)
-                     *m8
-                    -((-m12*(m19*m4-m18*m5))+m13*(m17*m4-m16*m5)
-                                            +(m16*m19-m17*m18)*m2)
-                     *m7
-                    +m1*(m11*(m16*m19-m17*m18)-m12*(m13*m19-m14*m18)
-                                              +m13*(m13*m17-m14*m16))),
-               (-m2*((-(m12*(m10*m3-m5*m8)+m2*(m17*m8-m10*m15)
-                                          -(m17*m3-m15*m5)*m7)
-                    *m9)
-                    +m8*(m13*(m10*m3-m5*m8)+m2*(m19*m8-m10*m16)
-                                           -(m19*m3-m16*m5)*m7)
-                    +m1*((-m12*(m19*m8-m10*m16))+m13*(m17*m8-m10*m15)
-                                                +(m15*m19-m16*m17)*m7)
-                    -((-m12*(m19*m3-m16*m5))+m13*(m17*m3-m15*m5)
-                                            +(m15*m19-m16*m17)*m2)
-                     *m6))
-                +m3*((-(m11*(m10*m3-m5*m8)+m2*(m14*m8-m10*m12)
-                                          -(m14*m3-m12*m5)*m7)
-                    *m9)
-                    +m7*(m13*(m10*m3-m5*m8)+m2*(m19*m8-m10*m16)
-                                           -(m19*m3-m16*m5)*m7)
-                    +m1*((-m11*(m19*m8-m10*m16))+m13*(m14*m8-m10*m12)
-                                                +(m12*m19-m14*m16)*m7)
-                    -((-m11*(m19*m3-m16*m5))+m13*(m14*m3-m12*m5)
-                                            +(m12*m19-m14*m16)*m2)
-                     *m6)
-                -m0*((-((-m11*(m17*m8-m10*m15))+m12*(m14*m8-m10*m12)
-                                               +(m12*m17-m14*m15)*m7)
-                    *m9)
-                    -m7*((-m12*(m19*m8-m10*m16))+m13*(m17*m8-m10*m15)
-                                                +(m15*m19-m16*m17)*m7)
-                    +m8*((-m11*(m19*m8-m10*m16))+m13*(m14*m8-m10*m12)
-                                                +(m12*m19-m14*m16)*m7)
-                    +(m11*(m15*m19-m16*m17)-m12*(m12*m19-m14*m16)
-                                           +m13*(m12*m17-m14*m15))
-                     *m6)
-                +m1*((-((-m11*(m17*m3-m15*m5))+m12*(m14*m3-m12*m5)
-                                              +(m12*m17-m14*m15)*m2)
-                    *m9)
-                    +((-m11*(m19*m3-m16*m5))+m13*(m14*m3-m12*m5)
-                                            +(m12*m19-m14*m16)*m2)
-                     *m8
-                    -((-m12*(m19*m3-m16*m5))+m13*(m17*m3-m15*m5)
-                                            +(m15*m19-m16*m17)*m2)
-                     *m7
-                    +m1*(m11*(m15*m19-m16*m17)-m12*(m12*m19-m14*m16)
-                                              +m13*(m12*m17-m14*m15)))
-                -m4*(m7*(m12*(m10*m3-m5*m8)+m2*(m17*m8-m10*m15)
-                                           -(m17*m3-m15*m5)*m7)
-                    -m8*(m11*(m10*m3-m5*m8)+m2*(m14*m8-m10*m12)
-                                           -(m14*m3-m12*m5)*m7)
-                    +m1*((-m11*(m17*m8-m10*m15))+m12*(m14*m8-m10*m12)
-                                                +(m12*m17-m14*m15)*m7)
-                    -((-m11*(m17*m3-m15*m5))+m12*(m14*m3-m12*m5)
-                                            +(m12*m17-m14*m15)*m2)
-                     *m6),
-               m2*(m8*(m13*(m3*m9-m4*m8)+m2*(m18*m8-m16*m9)
-                                        -(m18*m3-m16*m4)*m7)
-                  -m9*(m12*(m3*m9-m4*m8)+m2*(m16*m8-m15*m9)
-                                        -(m16*m3-m15*m4)*m7)
-                  +m1*((-m12*(m18*m8-m16*m9))+m13*(m16*m8-m15*m9)
-                                             +(m15*m18-m16^2)*m7)
-                  -((-m12*(m18*m3-m16*m4))+m13*(m16*m3-m15*m4)
-                                          +(m15*m18-m16^2)*m2)
-                   *m6)
-                -m3*(m7*(m13*(m3*m9-m4*m8)+m2*(m18*m8-m16*m9)
-                                          -(m18*m3-m16*m4)*m7)
-                    -m9*(m11*(m3*m9-m4*m8)+m2*(m13*m8-m12*m9)
-                                          -(m13*m3-m12*m4)*m7)
-                    +m1*((-m11*(m18*m8-m16*m9))+m13*(m13*m8-m12*m9)
-                                               +(m12*m18-m13*m16)*m7)
-                    -((-m11*(m18*m3-m16*m4))+m13*(m13*m3-m12*m4)
-                                            +(m12*m18-m13*m16)*m2)
-                     *m6)
-                +m4*(m7*(m12*(m3*m9-m4*m8)+m2*(m16*m8-m15*m9)
-                                          -(m16*m3-m15*m4)*m7)
-                    -m8*(m11*(m3*m9-m4*m8)+m2*(m13*m8-m12*m9)
-                                          -(m13*m3-m12*m4)*m7)
-                    +m1*((-m11*(m16*m8-m15*m9))+m12*(m13*m8-m12*m9)
-                                               +(m12*m16-m13*m15)*m7)
-                    -((-m11*(m16*m3-m15*m4))+m12*(m13*m3-m12*m4)
-                                            +(m12*m16-m13*m15)*m2)
-                     *m6)
-                +m0*((-m7*((-m12*(m18*m8-m16*m9))+m13*(m16*m8-m15*m9)
-                                                 +(m15*m18-m16^2)*m7))
-                    +m8*((-m11*(m18*m8-m16*m9))+m13*(m13*m8-m12*m9)
-                                               +(m12*m18-m13*m16)*m7)
-                    -m9*((-m11*(m16*m8-m15*m9))+m12*(m13*m8-m12*m9)
-                                               +(m12*m16-m13*m15)*m7)
-                    +(m11*(m15*m18-m16^2)-m12*(m12*m18-m13*m16)
-                                         +m13*(m12*m16-m13*m15))
-                     *m6)
-                -m1*((-((-m11*(m16*m3-m15*m4))+m12*(m13*m3-m12*m4)
-                                              +(m12*m16-m13*m15)*m2)
-                    *m9)
-                    +((-m11*(m18*m3-m16*m4))+m13*(m13*m3-m12*m4)
-                                            +(m12*m18-m13*m16)*m2)
-                     *m8
-                    -((-m12*(m18*m3-m16*m4))+m13*(m16*m3-m15*m4)
-                                            +(m15*m18-m16^2)*m2)
-                     *m7
-                    +m1*(m11*(m15*m18-m16^2)-m12*(m12*m18-m13*m16)
-                                            +m13*(m12*m16-m13*m15)))])
-
-Test program:
-
-    void main(void)
-    {
-        const double a[] =
-            { 1.9826929 , 0.49539104, 1.21536243, 0.98610923, 1.68623959, 1.0331091 ,
-                          1.96643809, 1.42962549, 0.9336305 , 1.96542156, 0.6086516 ,
-                                      0.81542249, 0.74012536, 0.83940333, 1.58604071,
-                                                  0.1338364 , 1.03314221, 0.44817192,
-                                                              1.97146512, 0.27591278,
-                                                                          1.51474051 };
-
-        double c[21];
-
-        int N=6;
-        double det = cofactors_sym6(a, c);
-
-        printf("det = %f\n", det);
-        printf("\n\n");
-
-        double p[36] = {};
-
-        for(int iout=0; iout<N; iout++)
-        {
-            for(int jout=0; jout<N; jout++)
-            {
-                for(int k=0; k<N; k++)
-                {
-                    p[iout*N + jout] +=
-                        a[index_sym66(iout, k)] *
-                        c[index_sym66(k, jout)];
-                }
-                p[iout*N + jout] /= det;
-
-                printf("%.5f ", p[iout*N + jout]);
-            }
-            printf("\n");
-        }
-    }
-
-     */
-
-    c[ 0] = (-m[ 7]*((-m[12]*((-m[16]*(m[20]*m[ 9]-m[10]*m[19]))+m[17]*(m[19]*m[ 9]-m[10]*m[18])+(m[18]*m[20]-m[19]*m[19])*m[ 8]))+m[13]*((-m[15]*(m[20]*m[ 9]-m[10]*m[19]))+m[17]*(m[17]*m[ 9]-m[10]*m[16])+(m[16]*m[20]-m[17]*m[19])*m[ 8])-m[14]*((-m[15]*(m[19]*m[ 9]-m[10]*m[18]))+m[16]*(m[17]*m[ 9]-m[10]*m[16])+(m[16]*m[19]-m[17]*m[18])*m[ 8])+(m[15]*(m[18]*m[20]-m[19]*m[19])-m[16]*(m[16]*m[20]-m[17]*m[19])+m[17]*(m[16]*m[19]-m[17]*m[18]))*m[ 7]))+m[ 8]*((-m[11]*((-m[16]*(m[20]*m[ 9]-m[10]*m[19]))+m[17]*(m[19]*m[ 9]-m[10]*m[18])+(m[18]*m[20]-m[19]*m[19])*m[ 8]))+m[13]*((-m[12]*(m[20]*m[ 9]-m[10]*m[19]))+m[17]*(m[14]*m[ 9]-m[10]*m[13])+(m[13]*m[20]-m[14]*m[19])*m[ 8])-m[14]*((-m[12]*(m[19]*m[ 9]-m[10]*m[18]))+m[16]*(m[14]*m[ 9]-m[10]*m[13])+(m[13]*m[19]-m[14]*m[18])*m[ 8])+(m[12]*(m[18]*m[20]-m[19]*m[19])-m[16]*(m[13]*m[20]-m[14]*m[19])+m[17]*(m[13]*m[19]-m[14]*m[18]))*m[ 7])-m[ 9]*((-m[11]*((-m[15]*(m[20]*m[ 9]-m[10]*m[19]))+m[17]*(m[17]*m[ 9]-m[10]*m[16])+(m[16]*m[20]-m[17]*m[19])*m[ 8]))+m[12]*((-m[12]*(m[20]*m[ 9]-m[10]*m[19]))+m[17]*(m[14]*m[ 9]-m[10]*m[13])+(m[13]*m[20]-m[14]*m[19])*m[ 8])-m[14]*((-m[12]*(m[17]*m[ 9]-m[10]*m[16]))+m[15]*(m[14]*m[ 9]-m[10]*m[13])+(m[13]*m[17]-m[14]*m[16])*m[ 8])+(m[12]*(m[16]*m[20]-m[17]*m[19])-m[15]*(m[13]*m[20]-m[14]*m[19])+m[17]*(m[13]*m[17]-m[14]*m[16]))*m[ 7])+m[10]*((-m[11]*((-m[15]*(m[19]*m[ 9]-m[10]*m[18]))+m[16]*(m[17]*m[ 9]-m[10]*m[16])+(m[16]*m[19]-m[17]*m[18])*m[ 8]))+m[12]*((-m[12]*(m[19]*m[ 9]-m[10]*m[18]))+m[16]*(m[14]*m[ 9]-m[10]*m[13])+(m[13]*m[19]-m[14]*m[18])*m[ 8])-m[13]*((-m[12]*(m[17]*m[ 9]-m[10]*m[16]))+m[15]*(m[14]*m[ 9]-m[10]*m[13])+(m[13]*m[17]-m[14]*m[16])*m[ 8])+(m[12]*(m[16]*m[19]-m[17]*m[18])-m[15]*(m[13]*m[19]-m[14]*m[18])+m[16]*(m[13]*m[17]-m[14]*m[16]))*m[ 7])+(m[11]*(m[15]*(m[18]*m[20]-m[19]*m[19])-m[16]*(m[16]*m[20]-m[17]*m[19])+m[17]*(m[16]*m[19]-m[17]*m[18]))-m[12]*(m[12]*(m[18]*m[20]-m[19]*m[19])-m[16]*(m[13]*m[20]-m[14]*m[19])+m[17]*(m[13]*m[19]-m[14]*m[18]))+m[13]*(m[12]*(m[16]*m[20]-m[17]*m[19])-m[15]*(m[13]*m[20]-m[14]*m[19])+m[17]*(m[13]*m[17]-m[14]*m[16]))-m[14]*(m[12]*(m[16]*m[19]-m[17]*m[18])-m[15]*(m[13]*m[19]-m[14]*m[18])+m[16]*(m[13]*m[17]-m[14]*m[16])))*m[ 6];
-    c[ 1] = m[ 2]*((-m[12]*((-m[16]*(m[20]*m[ 9]-m[10]*m[19]))+m[17]*(m[19]*m[ 9]-m[10]*m[18])+(m[18]*m[20]-m[19]*m[19])*m[ 8]))+m[13]*((-m[15]*(m[20]*m[ 9]-m[10]*m[19]))+m[17]*(m[17]*m[ 9]-m[10]*m[16])+(m[16]*m[20]-m[17]*m[19])*m[ 8])-m[14]*((-m[15]*(m[19]*m[ 9]-m[10]*m[18]))+m[16]*(m[17]*m[ 9]-m[10]*m[16])+(m[16]*m[19]-m[17]*m[18])*m[ 8])+(m[15]*(m[18]*m[20]-m[19]*m[19])-m[16]*(m[16]*m[20]-m[17]*m[19])+m[17]*(m[16]*m[19]-m[17]*m[18]))*m[ 7])-m[ 3]*((-m[11]*((-m[16]*(m[20]*m[ 9]-m[10]*m[19]))+m[17]*(m[19]*m[ 9]-m[10]*m[18])+(m[18]*m[20]-m[19]*m[19])*m[ 8]))+m[13]*((-m[12]*(m[20]*m[ 9]-m[10]*m[19]))+m[17]*(m[14]*m[ 9]-m[10]*m[13])+(m[13]*m[20]-m[14]*m[19])*m[ 8])-m[14]*((-m[12]*(m[19]*m[ 9]-m[10]*m[18]))+m[16]*(m[14]*m[ 9]-m[10]*m[13])+(m[13]*m[19]-m[14]*m[18])*m[ 8])+(m[12]*(m[18]*m[20]-m[19]*m[19])-m[16]*(m[13]*m[20]-m[14]*m[19])+m[17]*(m[13]*m[19]-m[14]*m[18]))*m[ 7])+m[ 4]*((-m[11]*((-m[15]*(m[20]*m[ 9]-m[10]*m[19]))+m[17]*(m[17]*m[ 9]-m[10]*m[16])+(m[16]*m[20]-m[17]*m[19])*m[ 8]))+m[12]*((-m[12]*(m[20]*m[ 9]-m[10]*m[19]))+m[17]*(m[14]*m[ 9]-m[10]*m[13])+(m[13]*m[20]-m[14]*m[19])*m[ 8])-m[14]*((-m[12]*(m[17]*m[ 9]-m[10]*m[16]))+m[15]*(m[14]*m[ 9]-m[10]*m[13])+(m[13]*m[17]-m[14]*m[16])*m[ 8])+(m[12]*(m[16]*m[20]-m[17]*m[19])-m[15]*(m[13]*m[20]-m[14]*m[19])+m[17]*(m[13]*m[17]-m[14]*m[16]))*m[ 7])-m[ 5]*((-m[11]*((-m[15]*(m[19]*m[ 9]-m[10]*m[18]))+m[16]*(m[17]*m[ 9]-m[10]*m[16])+(m[16]*m[19]-m[17]*m[18])*m[ 8]))+m[12]*((-m[12]*(m[19]*m[ 9]-m[10]*m[18]))+m[16]*(m[14]*m[ 9]-m[10]*m[13])+(m[13]*m[19]-m[14]*m[18])*m[ 8])-m[13]*((-m[12]*(m[17]*m[ 9]-m[10]*m[16]))+m[15]*(m[14]*m[ 9]-m[10]*m[13])+(m[13]*m[17]-m[14]*m[16])*m[ 8])+(m[12]*(m[16]*m[19]-m[17]*m[18])-m[15]*(m[13]*m[19]-m[14]*m[18])+m[16]*(m[13]*m[17]-m[14]*m[16]))*m[ 7])-m[ 1]*(m[11]*(m[15]*(m[18]*m[20]-m[19]*m[19])-m[16]*(m[16]*m[20]-m[17]*m[19])+m[17]*(m[16]*m[19]-m[17]*m[18]))-m[12]*(m[12]*(m[18]*m[20]-m[19]*m[19])-m[16]*(m[13]*m[20]-m[14]*m[19])+m[17]*(m[13]*m[19]-m[14]*m[18]))+m[13]*(m[12]*(m[16]*m[20]-m[17]*m[19])-m[15]*(m[13]*m[20]-m[14]*m[19])+m[17]*(m[13]*m[17]-m[14]*m[16]))-m[14]*(m[12]*(m[16]*m[19]-m[17]*m[18])-m[15]*(m[13]*m[19]-m[14]*m[18])+m[16]*(m[13]*m[17]-m[14]*m[16])));
-    c[ 2] = (-m[ 2]*((-m[ 8]*((-m[16]*(m[20]*m[ 9]-m[10]*m[19]))+m[17]*(m[19]*m[ 9]-m[10]*m[18])+(m[18]*m[20]-m[19]*m[19])*m[ 8]))+m[ 9]*((-m[15]*(m[20]*m[ 9]-m[10]*m[19]))+m[17]*(m[17]*m[ 9]-m[10]*m[16])+(m[16]*m[20]-m[17]*m[19])*m[ 8])-m[10]*((-m[15]*(m[19]*m[ 9]-m[10]*m[18]))+m[16]*(m[17]*m[ 9]-m[10]*m[16])+(m[16]*m[19]-m[17]*m[18])*m[ 8])+(m[15]*(m[18]*m[20]-m[19]*m[19])-m[16]*(m[16]*m[20]-m[17]*m[19])+m[17]*(m[16]*m[19]-m[17]*m[18]))*m[ 6]))+m[ 3]*((-m[ 7]*((-m[16]*(m[20]*m[ 9]-m[10]*m[19]))+m[17]*(m[19]*m[ 9]-m[10]*m[18])+(m[18]*m[20]-m[19]*m[19])*m[ 8]))+m[ 9]*((-m[12]*(m[20]*m[ 9]-m[10]*m[19]))+m[17]*(m[14]*m[ 9]-m[10]*m[13])+(m[13]*m[20]-m[14]*m[19])*m[ 8])-m[10]*((-m[12]*(m[19]*m[ 9]-m[10]*m[18]))+m[16]*(m[14]*m[ 9]-m[10]*m[13])+(m[13]*m[19]-m[14]*m[18])*m[ 8])+(m[12]*(m[18]*m[20]-m[19]*m[19])-m[16]*(m[13]*m[20]-m[14]*m[19])+m[17]*(m[13]*m[19]-m[14]*m[18]))*m[ 6])-m[ 4]*((-m[ 7]*((-m[15]*(m[20]*m[ 9]-m[10]*m[19]))+m[17]*(m[17]*m[ 9]-m[10]*m[16])+(m[16]*m[20]-m[17]*m[19])*m[ 8]))+m[ 8]*((-m[12]*(m[20]*m[ 9]-m[10]*m[19]))+m[17]*(m[14]*m[ 9]-m[10]*m[13])+(m[13]*m[20]-m[14]*m[19])*m[ 8])-m[10]*((-m[12]*(m[17]*m[ 9]-m[10]*m[16]))+m[15]*(m[14]*m[ 9]-m[10]*m[13])+(m[13]*m[17]-m[14]*m[16])*m[ 8])+(m[12]*(m[16]*m[20]-m[17]*m[19])-m[15]*(m[13]*m[20]-m[14]*m[19])+m[17]*(m[13]*m[17]-m[14]*m[16]))*m[ 6])+m[ 5]*((-m[ 7]*((-m[15]*(m[19]*m[ 9]-m[10]*m[18]))+m[16]*(m[17]*m[ 9]-m[10]*m[16])+(m[16]*m[19]-m[17]*m[18])*m[ 8]))+m[ 8]*((-m[12]*(m[19]*m[ 9]-m[10]*m[18]))+m[16]*(m[14]*m[ 9]-m[10]*m[13])+(m[13]*m[19]-m[14]*m[18])*m[ 8])-m[ 9]*((-m[12]*(m[17]*m[ 9]-m[10]*m[16]))+m[15]*(m[14]*m[ 9]-m[10]*m[13])+(m[13]*m[17]-m[14]*m[16])*m[ 8])+(m[12]*(m[16]*m[19]-m[17]*m[18])-m[15]*(m[13]*m[19]-m[14]*m[18])+m[16]*(m[13]*m[17]-m[14]*m[16]))*m[ 6])+m[ 1]*((m[12]*(m[16]*m[20]-m[17]*m[19])-m[15]*(m[13]*m[20]-m[14]*m[19])+m[17]*(m[13]*m[17]-m[14]*m[16]))*m[ 9]-(m[12]*(m[18]*m[20]-m[19]*m[19])-m[16]*(m[13]*m[20]-m[14]*m[19])+m[17]*(m[13]*m[19]-m[14]*m[18]))*m[ 8]+(m[15]*(m[18]*m[20]-m[19]*m[19])-m[16]*(m[16]*m[20]-m[17]*m[19])+m[17]*(m[16]*m[19]-m[17]*m[18]))*m[ 7]-m[10]*(m[12]*(m[16]*m[19]-m[17]*m[18])-m[15]*(m[13]*m[19]-m[14]*m[18])+m[16]*(m[13]*m[17]-m[14]*m[16])));
-    c[ 3] = m[ 2]*((-m[ 8]*((-m[13]*(m[20]*m[ 9]-m[10]*m[19]))+m[14]*(m[19]*m[ 9]-m[10]*m[18])+(m[18]*m[20]-m[19]*m[19])*m[ 7]))+m[ 9]*((-m[12]*(m[20]*m[ 9]-m[10]*m[19]))+m[14]*(m[17]*m[ 9]-m[10]*m[16])+(m[16]*m[20]-m[17]*m[19])*m[ 7])-m[10]*((-m[12]*(m[19]*m[ 9]-m[10]*m[18]))+m[13]*(m[17]*m[ 9]-m[10]*m[16])+(m[16]*m[19]-m[17]*m[18])*m[ 7])+(m[12]*(m[18]*m[20]-m[19]*m[19])-m[13]*(m[16]*m[20]-m[17]*m[19])+m[14]*(m[16]*m[19]-m[17]*m[18]))*m[ 6])-m[ 3]*((-m[ 7]*((-m[13]*(m[20]*m[ 9]-m[10]*m[19]))+m[14]*(m[19]*m[ 9]-m[10]*m[18])+(m[18]*m[20]-m[19]*m[19])*m[ 7]))+m[ 9]*((-m[11]*(m[20]*m[ 9]-m[10]*m[19]))+m[14]*(m[14]*m[ 9]-m[10]*m[13])+(m[13]*m[20]-m[14]*m[19])*m[ 7])-m[10]*((-m[11]*(m[19]*m[ 9]-m[10]*m[18]))+m[13]*(m[14]*m[ 9]-m[10]*m[13])+(m[13]*m[19]-m[14]*m[18])*m[ 7])+(m[11]*(m[18]*m[20]-m[19]*m[19])-m[13]*(m[13]*m[20]-m[14]*m[19])+m[14]*(m[13]*m[19]-m[14]*m[18]))*m[ 6])+m[ 4]*((-m[ 7]*((-m[12]*(m[20]*m[ 9]-m[10]*m[19]))+m[14]*(m[17]*m[ 9]-m[10]*m[16])+(m[16]*m[20]-m[17]*m[19])*m[ 7]))+m[ 8]*((-m[11]*(m[20]*m[ 9]-m[10]*m[19]))+m[14]*(m[14]*m[ 9]-m[10]*m[13])+(m[13]*m[20]-m[14]*m[19])*m[ 7])-m[10]*((-m[11]*(m[17]*m[ 9]-m[10]*m[16]))+m[12]*(m[14]*m[ 9]-m[10]*m[13])+(m[13]*m[17]-m[14]*m[16])*m[ 7])+(m[11]*(m[16]*m[20]-m[17]*m[19])-m[12]*(m[13]*m[20]-m[14]*m[19])+m[14]*(m[13]*m[17]-m[14]*m[16]))*m[ 6])-m[ 5]*((-m[ 7]*((-m[12]*(m[19]*m[ 9]-m[10]*m[18]))+m[13]*(m[17]*m[ 9]-m[10]*m[16])+(m[16]*m[19]-m[17]*m[18])*m[ 7]))+m[ 8]*((-m[11]*(m[19]*m[ 9]-m[10]*m[18]))+m[13]*(m[14]*m[ 9]-m[10]*m[13])+(m[13]*m[19]-m[14]*m[18])*m[ 7])-m[ 9]*((-m[11]*(m[17]*m[ 9]-m[10]*m[16]))+m[12]*(m[14]*m[ 9]-m[10]*m[13])+(m[13]*m[17]-m[14]*m[16])*m[ 7])+(m[11]*(m[16]*m[19]-m[17]*m[18])-m[12]*(m[13]*m[19]-m[14]*m[18])+m[13]*(m[13]*m[17]-m[14]*m[16]))*m[ 6])-m[ 1]*((m[11]*(m[16]*m[20]-m[17]*m[19])-m[12]*(m[13]*m[20]-m[14]*m[19])+m[14]*(m[13]*m[17]-m[14]*m[16]))*m[ 9]-(m[11]*(m[18]*m[20]-m[19]*m[19])-m[13]*(m[13]*m[20]-m[14]*m[19])+m[14]*(m[13]*m[19]-m[14]*m[18]))*m[ 8]+(m[12]*(m[18]*m[20]-m[19]*m[19])-m[13]*(m[16]*m[20]-m[17]*m[19])+m[14]*(m[16]*m[19]-m[17]*m[18]))*m[ 7]-m[10]*(m[11]*(m[16]*m[19]-m[17]*m[18])-m[12]*(m[13]*m[19]-m[14]*m[18])+m[13]*(m[13]*m[17]-m[14]*m[16])));
-    c[ 4] = (-m[ 2]*(((-m[12]*(m[20]*m[ 8]-m[10]*m[17]))+m[14]*(m[17]*m[ 8]-m[10]*m[15])+(m[15]*m[20]-m[17]*m[17])*m[ 7])*m[ 9]-m[ 8]*((-m[13]*(m[20]*m[ 8]-m[10]*m[17]))+m[14]*(m[19]*m[ 8]-m[10]*m[16])+(m[16]*m[20]-m[17]*m[19])*m[ 7])-m[10]*((-m[12]*(m[19]*m[ 8]-m[10]*m[16]))+m[13]*(m[17]*m[ 8]-m[10]*m[15])+(m[15]*m[19]-m[16]*m[17])*m[ 7])+(m[12]*(m[16]*m[20]-m[17]*m[19])-m[13]*(m[15]*m[20]-m[17]*m[17])+m[14]*(m[15]*m[19]-m[16]*m[17]))*m[ 6]))+m[ 3]*(((-m[11]*(m[20]*m[ 8]-m[10]*m[17]))+m[14]*(m[14]*m[ 8]-m[10]*m[12])+(m[12]*m[20]-m[14]*m[17])*m[ 7])*m[ 9]-m[ 7]*((-m[13]*(m[20]*m[ 8]-m[10]*m[17]))+m[14]*(m[19]*m[ 8]-m[10]*m[16])+(m[16]*m[20]-m[17]*m[19])*m[ 7])-m[10]*((-m[11]*(m[19]*m[ 8]-m[10]*m[16]))+m[13]*(m[14]*m[ 8]-m[10]*m[12])+(m[12]*m[19]-m[14]*m[16])*m[ 7])+(m[11]*(m[16]*m[20]-m[17]*m[19])-m[13]*(m[12]*m[20]-m[14]*m[17])+m[14]*(m[12]*m[19]-m[14]*m[16]))*m[ 6])+m[ 5]*((-((-m[11]*(m[17]*m[ 8]-m[10]*m[15]))+m[12]*(m[14]*m[ 8]-m[10]*m[12])+(m[12]*m[17]-m[14]*m[15])*m[ 7])*m[ 9])-m[ 7]*((-m[12]*(m[19]*m[ 8]-m[10]*m[16]))+m[13]*(m[17]*m[ 8]-m[10]*m[15])+(m[15]*m[19]-m[16]*m[17])*m[ 7])+m[ 8]*((-m[11]*(m[19]*m[ 8]-m[10]*m[16]))+m[13]*(m[14]*m[ 8]-m[10]*m[12])+(m[12]*m[19]-m[14]*m[16])*m[ 7])+(m[11]*(m[15]*m[19]-m[16]*m[17])-m[12]*(m[12]*m[19]-m[14]*m[16])+m[13]*(m[12]*m[17]-m[14]*m[15]))*m[ 6])+m[ 1]*((m[11]*(m[15]*m[20]-m[17]*m[17])-m[12]*(m[12]*m[20]-m[14]*m[17])+m[14]*(m[12]*m[17]-m[14]*m[15]))*m[ 9]-(m[11]*(m[16]*m[20]-m[17]*m[19])-m[13]*(m[12]*m[20]-m[14]*m[17])+m[14]*(m[12]*m[19]-m[14]*m[16]))*m[ 8]+(m[12]*(m[16]*m[20]-m[17]*m[19])-m[13]*(m[15]*m[20]-m[17]*m[17])+m[14]*(m[15]*m[19]-m[16]*m[17]))*m[ 7]-m[10]*(m[11]*(m[15]*m[19]-m[16]*m[17])-m[12]*(m[12]*m[19]-m[14]*m[16])+m[13]*(m[12]*m[17]-m[14]*m[15])))-m[ 4]*((-m[ 7]*((-m[12]*(m[20]*m[ 8]-m[10]*m[17]))+m[14]*(m[17]*m[ 8]-m[10]*m[15])+(m[15]*m[20]-m[17]*m[17])*m[ 7]))+m[ 8]*((-m[11]*(m[20]*m[ 8]-m[10]*m[17]))+m[14]*(m[14]*m[ 8]-m[10]*m[12])+(m[12]*m[20]-m[14]*m[17])*m[ 7])-m[10]*((-m[11]*(m[17]*m[ 8]-m[10]*m[15]))+m[12]*(m[14]*m[ 8]-m[10]*m[12])+(m[12]*m[17]-m[14]*m[15])*m[ 7])+(m[11]*(m[15]*m[20]-m[17]*m[17])-m[12]*(m[12]*m[20]-m[14]*m[17])+m[14]*(m[12]*m[17]-m[14]*m[15]))*m[ 6]);
-    c[ 5] = m[ 2]*((-m[ 8]*((-m[13]*(m[19]*m[ 8]-m[17]*m[ 9]))+m[14]*(m[18]*m[ 8]-m[16]*m[ 9])+(m[16]*m[19]-m[17]*m[18])*m[ 7]))+m[ 9]*((-m[12]*(m[19]*m[ 8]-m[17]*m[ 9]))+m[14]*(m[16]*m[ 8]-m[15]*m[ 9])+(m[15]*m[19]-m[16]*m[17])*m[ 7])-m[10]*((-m[12]*(m[18]*m[ 8]-m[16]*m[ 9]))+m[13]*(m[16]*m[ 8]-m[15]*m[ 9])+(m[15]*m[18]-m[16]*m[16])*m[ 7])+(m[12]*(m[16]*m[19]-m[17]*m[18])-m[13]*(m[15]*m[19]-m[16]*m[17])+m[14]*(m[15]*m[18]-m[16]*m[16]))*m[ 6])-m[ 3]*((-m[ 7]*((-m[13]*(m[19]*m[ 8]-m[17]*m[ 9]))+m[14]*(m[18]*m[ 8]-m[16]*m[ 9])+(m[16]*m[19]-m[17]*m[18])*m[ 7]))+m[ 9]*((-m[11]*(m[19]*m[ 8]-m[17]*m[ 9]))+m[14]*(m[13]*m[ 8]-m[12]*m[ 9])+(m[12]*m[19]-m[13]*m[17])*m[ 7])-m[10]*((-m[11]*(m[18]*m[ 8]-m[16]*m[ 9]))+m[13]*(m[13]*m[ 8]-m[12]*m[ 9])+(m[12]*m[18]-m[13]*m[16])*m[ 7])+(m[11]*(m[16]*m[19]-m[17]*m[18])-m[13]*(m[12]*m[19]-m[13]*m[17])+m[14]*(m[12]*m[18]-m[13]*m[16]))*m[ 6])+m[ 4]*((-m[ 7]*((-m[12]*(m[19]*m[ 8]-m[17]*m[ 9]))+m[14]*(m[16]*m[ 8]-m[15]*m[ 9])+(m[15]*m[19]-m[16]*m[17])*m[ 7]))+m[ 8]*((-m[11]*(m[19]*m[ 8]-m[17]*m[ 9]))+m[14]*(m[13]*m[ 8]-m[12]*m[ 9])+(m[12]*m[19]-m[13]*m[17])*m[ 7])-m[10]*((-m[11]*(m[16]*m[ 8]-m[15]*m[ 9]))+m[12]*(m[13]*m[ 8]-m[12]*m[ 9])+(m[12]*m[16]-m[13]*m[15])*m[ 7])+(m[11]*(m[15]*m[19]-m[16]*m[17])-m[12]*(m[12]*m[19]-m[13]*m[17])+m[14]*(m[12]*m[16]-m[13]*m[15]))*m[ 6])-m[ 5]*((-m[ 7]*((-m[12]*(m[18]*m[ 8]-m[16]*m[ 9]))+m[13]*(m[16]*m[ 8]-m[15]*m[ 9])+(m[15]*m[18]-m[16]*m[16])*m[ 7]))+m[ 8]*((-m[11]*(m[18]*m[ 8]-m[16]*m[ 9]))+m[13]*(m[13]*m[ 8]-m[12]*m[ 9])+(m[12]*m[18]-m[13]*m[16])*m[ 7])-m[ 9]*((-m[11]*(m[16]*m[ 8]-m[15]*m[ 9]))+m[12]*(m[13]*m[ 8]-m[12]*m[ 9])+(m[12]*m[16]-m[13]*m[15])*m[ 7])+(m[11]*(m[15]*m[18]-m[16]*m[16])-m[12]*(m[12]*m[18]-m[13]*m[16])+m[13]*(m[12]*m[16]-m[13]*m[15]))*m[ 6])-m[ 1]*((m[11]*(m[15]*m[19]-m[16]*m[17])-m[12]*(m[12]*m[19]-m[13]*m[17])+m[14]*(m[12]*m[16]-m[13]*m[15]))*m[ 9]-(m[11]*(m[16]*m[19]-m[17]*m[18])-m[13]*(m[12]*m[19]-m[13]*m[17])+m[14]*(m[12]*m[18]-m[13]*m[16]))*m[ 8]+(m[12]*(m[16]*m[19]-m[17]*m[18])-m[13]*(m[15]*m[19]-m[16]*m[17])+m[14]*(m[15]*m[18]-m[16]*m[16]))*m[ 7]-m[10]*(m[11]*(m[15]*m[18]-m[16]*m[16])-m[12]*(m[12]*m[18]-m[13]*m[16])+m[13]*(m[12]*m[16]-m[13]*m[15])));
-    c[ 6] = (-m[ 2]*((-m[12]*((-m[16]*(m[20]*m[ 4]-m[19]*m[ 5]))+m[17]*(m[19]*m[ 4]-m[18]*m[ 5])+(m[18]*m[20]-m[19]*m[19])*m[ 3]))+m[13]*((-m[15]*(m[20]*m[ 4]-m[19]*m[ 5]))+m[17]*(m[17]*m[ 4]-m[16]*m[ 5])+(m[16]*m[20]-m[17]*m[19])*m[ 3])-m[14]*((-m[15]*(m[19]*m[ 4]-m[18]*m[ 5]))+m[16]*(m[17]*m[ 4]-m[16]*m[ 5])+(m[16]*m[19]-m[17]*m[18])*m[ 3])+m[ 2]*(m[15]*(m[18]*m[20]-m[19]*m[19])-m[16]*(m[16]*m[20]-m[17]*m[19])+m[17]*(m[16]*m[19]-m[17]*m[18]))))+m[ 3]*((-m[11]*((-m[16]*(m[20]*m[ 4]-m[19]*m[ 5]))+m[17]*(m[19]*m[ 4]-m[18]*m[ 5])+(m[18]*m[20]-m[19]*m[19])*m[ 3]))+m[13]*((-m[12]*(m[20]*m[ 4]-m[19]*m[ 5]))+m[17]*(m[14]*m[ 4]-m[13]*m[ 5])+(m[13]*m[20]-m[14]*m[19])*m[ 3])-m[14]*((-m[12]*(m[19]*m[ 4]-m[18]*m[ 5]))+m[16]*(m[14]*m[ 4]-m[13]*m[ 5])+(m[13]*m[19]-m[14]*m[18])*m[ 3])+m[ 2]*(m[12]*(m[18]*m[20]-m[19]*m[19])-m[16]*(m[13]*m[20]-m[14]*m[19])+m[17]*(m[13]*m[19]-m[14]*m[18])))-m[ 4]*((-m[11]*((-m[15]*(m[20]*m[ 4]-m[19]*m[ 5]))+m[17]*(m[17]*m[ 4]-m[16]*m[ 5])+(m[16]*m[20]-m[17]*m[19])*m[ 3]))+m[12]*((-m[12]*(m[20]*m[ 4]-m[19]*m[ 5]))+m[17]*(m[14]*m[ 4]-m[13]*m[ 5])+(m[13]*m[20]-m[14]*m[19])*m[ 3])-m[14]*((-m[12]*(m[17]*m[ 4]-m[16]*m[ 5]))+m[15]*(m[14]*m[ 4]-m[13]*m[ 5])+(m[13]*m[17]-m[14]*m[16])*m[ 3])+m[ 2]*(m[12]*(m[16]*m[20]-m[17]*m[19])-m[15]*(m[13]*m[20]-m[14]*m[19])+m[17]*(m[13]*m[17]-m[14]*m[16])))+m[ 5]*((-m[11]*((-m[15]*(m[19]*m[ 4]-m[18]*m[ 5]))+m[16]*(m[17]*m[ 4]-m[16]*m[ 5])+(m[16]*m[19]-m[17]*m[18])*m[ 3]))+m[12]*((-m[12]*(m[19]*m[ 4]-m[18]*m[ 5]))+m[16]*(m[14]*m[ 4]-m[13]*m[ 5])+(m[13]*m[19]-m[14]*m[18])*m[ 3])-m[13]*((-m[12]*(m[17]*m[ 4]-m[16]*m[ 5]))+m[15]*(m[14]*m[ 4]-m[13]*m[ 5])+(m[13]*m[17]-m[14]*m[16])*m[ 3])+(m[12]*(m[16]*m[19]-m[17]*m[18])-m[15]*(m[13]*m[19]-m[14]*m[18])+m[16]*(m[13]*m[17]-m[14]*m[16]))*m[ 2])+m[ 0]*(m[11]*(m[15]*(m[18]*m[20]-m[19]*m[19])-m[16]*(m[16]*m[20]-m[17]*m[19])+m[17]*(m[16]*m[19]-m[17]*m[18]))-m[12]*(m[12]*(m[18]*m[20]-m[19]*m[19])-m[16]*(m[13]*m[20]-m[14]*m[19])+m[17]*(m[13]*m[19]-m[14]*m[18]))+m[13]*(m[12]*(m[16]*m[20]-m[17]*m[19])-m[15]*(m[13]*m[20]-m[14]*m[19])+m[17]*(m[13]*m[17]-m[14]*m[16]))-m[14]*(m[12]*(m[16]*m[19]-m[17]*m[18])-m[15]*(m[13]*m[19]-m[14]*m[18])+m[16]*(m[13]*m[17]-m[14]*m[16])));
-    c[ 7] = m[ 2]*(((-m[15]*(m[20]*m[ 4]-m[19]*m[ 5]))+m[17]*(m[17]*m[ 4]-m[16]*m[ 5])+(m[16]*m[20]-m[17]*m[19])*m[ 3])*m[ 9]-((-m[16]*(m[20]*m[ 4]-m[19]*m[ 5]))+m[17]*(m[19]*m[ 4]-m[18]*m[ 5])+(m[18]*m[20]-m[19]*m[19])*m[ 3])*m[ 8]-m[10]*((-m[15]*(m[19]*m[ 4]-m[18]*m[ 5]))+m[16]*(m[17]*m[ 4]-m[16]*m[ 5])+(m[16]*m[19]-m[17]*m[18])*m[ 3])+m[ 1]*(m[15]*(m[18]*m[20]-m[19]*m[19])-m[16]*(m[16]*m[20]-m[17]*m[19])+m[17]*(m[16]*m[19]-m[17]*m[18])))-m[ 3]*(((-m[12]*(m[20]*m[ 4]-m[19]*m[ 5]))+m[17]*(m[14]*m[ 4]-m[13]*m[ 5])+(m[13]*m[20]-m[14]*m[19])*m[ 3])*m[ 9]-((-m[16]*(m[20]*m[ 4]-m[19]*m[ 5]))+m[17]*(m[19]*m[ 4]-m[18]*m[ 5])+(m[18]*m[20]-m[19]*m[19])*m[ 3])*m[ 7]-m[10]*((-m[12]*(m[19]*m[ 4]-m[18]*m[ 5]))+m[16]*(m[14]*m[ 4]-m[13]*m[ 5])+(m[13]*m[19]-m[14]*m[18])*m[ 3])+m[ 1]*(m[12]*(m[18]*m[20]-m[19]*m[19])-m[16]*(m[13]*m[20]-m[14]*m[19])+m[17]*(m[13]*m[19]-m[14]*m[18])))-m[ 5]*((-((-m[12]*(m[17]*m[ 4]-m[16]*m[ 5]))+m[15]*(m[14]*m[ 4]-m[13]*m[ 5])+(m[13]*m[17]-m[14]*m[16])*m[ 3])*m[ 9])+((-m[12]*(m[19]*m[ 4]-m[18]*m[ 5]))+m[16]*(m[14]*m[ 4]-m[13]*m[ 5])+(m[13]*m[19]-m[14]*m[18])*m[ 3])*m[ 8]-((-m[15]*(m[19]*m[ 4]-m[18]*m[ 5]))+m[16]*(m[17]*m[ 4]-m[16]*m[ 5])+(m[16]*m[19]-m[17]*m[18])*m[ 3])*m[ 7]+m[ 1]*(m[12]*(m[16]*m[19]-m[17]*m[18])-m[15]*(m[13]*m[19]-m[14]*m[18])+m[16]*(m[13]*m[17]-m[14]*m[16])))-m[ 0]*((m[12]*(m[16]*m[20]-m[17]*m[19])-m[15]*(m[13]*m[20]-m[14]*m[19])+m[17]*(m[13]*m[17]-m[14]*m[16]))*m[ 9]-(m[12]*(m[18]*m[20]-m[19]*m[19])-m[16]*(m[13]*m[20]-m[14]*m[19])+m[17]*(m[13]*m[19]-m[14]*m[18]))*m[ 8]+(m[15]*(m[18]*m[20]-m[19]*m[19])-m[16]*(m[16]*m[20]-m[17]*m[19])+m[17]*(m[16]*m[19]-m[17]*m[18]))*m[ 7]-m[10]*(m[12]*(m[16]*m[19]-m[17]*m[18])-m[15]*(m[13]*m[19]-m[14]*m[18])+m[16]*(m[13]*m[17]-m[14]*m[16])))+m[ 4]*(((-m[12]*(m[20]*m[ 4]-m[19]*m[ 5]))+m[17]*(m[14]*m[ 4]-m[13]*m[ 5])+(m[13]*m[20]-m[14]*m[19])*m[ 3])*m[ 8]-((-m[15]*(m[20]*m[ 4]-m[19]*m[ 5]))+m[17]*(m[17]*m[ 4]-m[16]*m[ 5])+(m[16]*m[20]-m[17]*m[19])*m[ 3])*m[ 7]-m[10]*((-m[12]*(m[17]*m[ 4]-m[16]*m[ 5]))+m[15]*(m[14]*m[ 4]-m[13]*m[ 5])+(m[13]*m[17]-m[14]*m[16])*m[ 3])+m[ 1]*(m[12]*(m[16]*m[20]-m[17]*m[19])-m[15]*(m[13]*m[20]-m[14]*m[19])+m[17]*(m[13]*m[17]-m[14]*m[16])));
-    c[ 8] = (-m[ 2]*(((-m[12]*(m[20]*m[ 4]-m[19]*m[ 5]))+m[14]*(m[17]*m[ 4]-m[16]*m[ 5])+m[ 2]*(m[16]*m[20]-m[17]*m[19]))*m[ 9]-((-m[13]*(m[20]*m[ 4]-m[19]*m[ 5]))+m[14]*(m[19]*m[ 4]-m[18]*m[ 5])+m[ 2]*(m[18]*m[20]-m[19]*m[19]))*m[ 8]-m[10]*((-m[12]*(m[19]*m[ 4]-m[18]*m[ 5]))+m[13]*(m[17]*m[ 4]-m[16]*m[ 5])+(m[16]*m[19]-m[17]*m[18])*m[ 2])+m[ 1]*(m[12]*(m[18]*m[20]-m[19]*m[19])-m[13]*(m[16]*m[20]-m[17]*m[19])+m[14]*(m[16]*m[19]-m[17]*m[18]))))+m[ 3]*(((-m[11]*(m[20]*m[ 4]-m[19]*m[ 5]))+m[14]*(m[14]*m[ 4]-m[13]*m[ 5])+m[ 2]*(m[13]*m[20]-m[14]*m[19]))*m[ 9]-((-m[13]*(m[20]*m[ 4]-m[19]*m[ 5]))+m[14]*(m[19]*m[ 4]-m[18]*m[ 5])+m[ 2]*(m[18]*m[20]-m[19]*m[19]))*m[ 7]-m[10]*((-m[11]*(m[19]*m[ 4]-m[18]*m[ 5]))+m[13]*(m[14]*m[ 4]-m[13]*m[ 5])+(m[13]*m[19]-m[14]*m[18])*m[ 2])+m[ 1]*(m[11]*(m[18]*m[20]-m[19]*m[19])-m[13]*(m[13]*m[20]-m[14]*m[19])+m[14]*(m[13]*m[19]-m[14]*m[18])))+m[ 5]*((-((-m[11]*(m[17]*m[ 4]-m[16]*m[ 5]))+m[12]*(m[14]*m[ 4]-m[13]*m[ 5])+(m[13]*m[17]-m[14]*m[16])*m[ 2])*m[ 9])+((-m[11]*(m[19]*m[ 4]-m[18]*m[ 5]))+m[13]*(m[14]*m[ 4]-m[13]*m[ 5])+(m[13]*m[19]-m[14]*m[18])*m[ 2])*m[ 8]-((-m[12]*(m[19]*m[ 4]-m[18]*m[ 5]))+m[13]*(m[17]*m[ 4]-m[16]*m[ 5])+(m[16]*m[19]-m[17]*m[18])*m[ 2])*m[ 7]+m[ 1]*(m[11]*(m[16]*m[19]-m[17]*m[18])-m[12]*(m[13]*m[19]-m[14]*m[18])+m[13]*(m[13]*m[17]-m[14]*m[16])))+m[ 0]*((m[11]*(m[16]*m[20]-m[17]*m[19])-m[12]*(m[13]*m[20]-m[14]*m[19])+m[14]*(m[13]*m[17]-m[14]*m[16]))*m[ 9]-(m[11]*(m[18]*m[20]-m[19]*m[19])-m[13]*(m[13]*m[20]-m[14]*m[19])+m[14]*(m[13]*m[19]-m[14]*m[18]))*m[ 8]+(m[12]*(m[18]*m[20]-m[19]*m[19])-m[13]*(m[16]*m[20]-m[17]*m[19])+m[14]*(m[16]*m[19]-m[17]*m[18]))*m[ 7]-m[10]*(m[11]*(m[16]*m[19]-m[17]*m[18])-m[12]*(m[13]*m[19]-m[14]*m[18])+m[13]*(m[13]*m[17]-m[14]*m[16])))-m[ 4]*(((-m[11]*(m[20]*m[ 4]-m[19]*m[ 5]))+m[14]*(m[14]*m[ 4]-m[13]*m[ 5])+m[ 2]*(m[13]*m[20]-m[14]*m[19]))*m[ 8]-((-m[12]*(m[20]*m[ 4]-m[19]*m[ 5]))+m[14]*(m[17]*m[ 4]-m[16]*m[ 5])+m[ 2]*(m[16]*m[20]-m[17]*m[19]))*m[ 7]-m[10]*((-m[11]*(m[17]*m[ 4]-m[16]*m[ 5]))+m[12]*(m[14]*m[ 4]-m[13]*m[ 5])+(m[13]*m[17]-m[14]*m[16])*m[ 2])+m[ 1]*(m[11]*(m[16]*m[20]-m[17]*m[19])-m[12]*(m[13]*m[20]-m[14]*m[19])+m[14]*(m[13]*m[17]-m[14]*m[16])));
-    c[ 9] = m[ 2]*(((-m[12]*(m[20]*m[ 3]-m[17]*m[ 5]))+m[14]*(m[17]*m[ 3]-m[15]*m[ 5])+m[ 2]*(m[15]*m[20]-m[17]*m[17]))*m[ 9]-((-m[13]*(m[20]*m[ 3]-m[17]*m[ 5]))+m[14]*(m[19]*m[ 3]-m[16]*m[ 5])+m[ 2]*(m[16]*m[20]-m[17]*m[19]))*m[ 8]-m[10]*((-m[12]*(m[19]*m[ 3]-m[16]*m[ 5]))+m[13]*(m[17]*m[ 3]-m[15]*m[ 5])+(m[15]*m[19]-m[16]*m[17])*m[ 2])+m[ 1]*(m[12]*(m[16]*m[20]-m[17]*m[19])-m[13]*(m[15]*m[20]-m[17]*m[17])+m[14]*(m[15]*m[19]-m[16]*m[17])))-m[ 3]*(((-m[11]*(m[20]*m[ 3]-m[17]*m[ 5]))+m[14]*(m[14]*m[ 3]-m[12]*m[ 5])+m[ 2]*(m[12]*m[20]-m[14]*m[17]))*m[ 9]-((-m[13]*(m[20]*m[ 3]-m[17]*m[ 5]))+m[14]*(m[19]*m[ 3]-m[16]*m[ 5])+m[ 2]*(m[16]*m[20]-m[17]*m[19]))*m[ 7]-m[10]*((-m[11]*(m[19]*m[ 3]-m[16]*m[ 5]))+m[13]*(m[14]*m[ 3]-m[12]*m[ 5])+(m[12]*m[19]-m[14]*m[16])*m[ 2])+m[ 1]*(m[11]*(m[16]*m[20]-m[17]*m[19])-m[13]*(m[12]*m[20]-m[14]*m[17])+m[14]*(m[12]*m[19]-m[14]*m[16])))-m[ 5]*((-((-m[11]*(m[17]*m[ 3]-m[15]*m[ 5]))+m[12]*(m[14]*m[ 3]-m[12]*m[ 5])+(m[12]*m[17]-m[14]*m[15])*m[ 2])*m[ 9])+((-m[11]*(m[19]*m[ 3]-m[16]*m[ 5]))+m[13]*(m[14]*m[ 3]-m[12]*m[ 5])+(m[12]*m[19]-m[14]*m[16])*m[ 2])*m[ 8]-((-m[12]*(m[19]*m[ 3]-m[16]*m[ 5]))+m[13]*(m[17]*m[ 3]-m[15]*m[ 5])+(m[15]*m[19]-m[16]*m[17])*m[ 2])*m[ 7]+m[ 1]*(m[11]*(m[15]*m[19]-m[16]*m[17])-m[12]*(m[12]*m[19]-m[14]*m[16])+m[13]*(m[12]*m[17]-m[14]*m[15])))-m[ 0]*((m[11]*(m[15]*m[20]-m[17]*m[17])-m[12]*(m[12]*m[20]-m[14]*m[17])+m[14]*(m[12]*m[17]-m[14]*m[15]))*m[ 9]-(m[11]*(m[16]*m[20]-m[17]*m[19])-m[13]*(m[12]*m[20]-m[14]*m[17])+m[14]*(m[12]*m[19]-m[14]*m[16]))*m[ 8]+(m[12]*(m[16]*m[20]-m[17]*m[19])-m[13]*(m[15]*m[20]-m[17]*m[17])+m[14]*(m[15]*m[19]-m[16]*m[17]))*m[ 7]-m[10]*(m[11]*(m[15]*m[19]-m[16]*m[17])-m[12]*(m[12]*m[19]-m[14]*m[16])+m[13]*(m[12]*m[17]-m[14]*m[15])))+m[ 4]*(((-m[11]*(m[20]*m[ 3]-m[17]*m[ 5]))+m[14]*(m[14]*m[ 3]-m[12]*m[ 5])+m[ 2]*(m[12]*m[20]-m[14]*m[17]))*m[ 8]-((-m[12]*(m[20]*m[ 3]-m[17]*m[ 5]))+m[14]*(m[17]*m[ 3]-m[15]*m[ 5])+m[ 2]*(m[15]*m[20]-m[17]*m[17]))*m[ 7]-m[10]*((-m[11]*(m[17]*m[ 3]-m[15]*m[ 5]))+m[12]*(m[14]*m[ 3]-m[12]*m[ 5])+(m[12]*m[17]-m[14]*m[15])*m[ 2])+m[ 1]*(m[11]*(m[15]*m[20]-m[17]*m[17])-m[12]*(m[12]*m[20]-m[14]*m[17])+m[14]*(m[12]*m[17]-m[14]*m[15])));
-    c[10] = (-m[ 2]*(((-m[12]*(m[19]*m[ 3]-m[17]*m[ 4]))+m[14]*(m[16]*m[ 3]-m[15]*m[ 4])+(m[15]*m[19]-m[16]*m[17])*m[ 2])*m[ 9]-((-m[13]*(m[19]*m[ 3]-m[17]*m[ 4]))+m[14]*(m[18]*m[ 3]-m[16]*m[ 4])+(m[16]*m[19]-m[17]*m[18])*m[ 2])*m[ 8]-m[10]*((-m[12]*(m[18]*m[ 3]-m[16]*m[ 4]))+m[13]*(m[16]*m[ 3]-m[15]*m[ 4])+(m[15]*m[18]-m[16]*m[16])*m[ 2])+m[ 1]*(m[12]*(m[16]*m[19]-m[17]*m[18])-m[13]*(m[15]*m[19]-m[16]*m[17])+m[14]*(m[15]*m[18]-m[16]*m[16]))))+m[ 3]*(((-m[11]*(m[19]*m[ 3]-m[17]*m[ 4]))+m[14]*(m[13]*m[ 3]-m[12]*m[ 4])+(m[12]*m[19]-m[13]*m[17])*m[ 2])*m[ 9]-((-m[13]*(m[19]*m[ 3]-m[17]*m[ 4]))+m[14]*(m[18]*m[ 3]-m[16]*m[ 4])+(m[16]*m[19]-m[17]*m[18])*m[ 2])*m[ 7]-m[10]*((-m[11]*(m[18]*m[ 3]-m[16]*m[ 4]))+m[13]*(m[13]*m[ 3]-m[12]*m[ 4])+(m[12]*m[18]-m[13]*m[16])*m[ 2])+m[ 1]*(m[11]*(m[16]*m[19]-m[17]*m[18])-m[13]*(m[12]*m[19]-m[13]*m[17])+m[14]*(m[12]*m[18]-m[13]*m[16])))+m[ 5]*((-((-m[11]*(m[16]*m[ 3]-m[15]*m[ 4]))+m[12]*(m[13]*m[ 3]-m[12]*m[ 4])+(m[12]*m[16]-m[13]*m[15])*m[ 2])*m[ 9])+((-m[11]*(m[18]*m[ 3]-m[16]*m[ 4]))+m[13]*(m[13]*m[ 3]-m[12]*m[ 4])+(m[12]*m[18]-m[13]*m[16])*m[ 2])*m[ 8]-((-m[12]*(m[18]*m[ 3]-m[16]*m[ 4]))+m[13]*(m[16]*m[ 3]-m[15]*m[ 4])+(m[15]*m[18]-m[16]*m[16])*m[ 2])*m[ 7]+m[ 1]*(m[11]*(m[15]*m[18]-m[16]*m[16])-m[12]*(m[12]*m[18]-m[13]*m[16])+m[13]*(m[12]*m[16]-m[13]*m[15])))+m[ 0]*((m[11]*(m[15]*m[19]-m[16]*m[17])-m[12]*(m[12]*m[19]-m[13]*m[17])+m[14]*(m[12]*m[16]-m[13]*m[15]))*m[ 9]-(m[11]*(m[16]*m[19]-m[17]*m[18])-m[13]*(m[12]*m[19]-m[13]*m[17])+m[14]*(m[12]*m[18]-m[13]*m[16]))*m[ 8]+(m[12]*(m[16]*m[19]-m[17]*m[18])-m[13]*(m[15]*m[19]-m[16]*m[17])+m[14]*(m[15]*m[18]-m[16]*m[16]))*m[ 7]-m[10]*(m[11]*(m[15]*m[18]-m[16]*m[16])-m[12]*(m[12]*m[18]-m[13]*m[16])+m[13]*(m[12]*m[16]-m[13]*m[15])))-m[ 4]*(((-m[11]*(m[19]*m[ 3]-m[17]*m[ 4]))+m[14]*(m[13]*m[ 3]-m[12]*m[ 4])+(m[12]*m[19]-m[13]*m[17])*m[ 2])*m[ 8]-((-m[12]*(m[19]*m[ 3]-m[17]*m[ 4]))+m[14]*(m[16]*m[ 3]-m[15]*m[ 4])+(m[15]*m[19]-m[16]*m[17])*m[ 2])*m[ 7]-m[10]*((-m[11]*(m[16]*m[ 3]-m[15]*m[ 4]))+m[12]*(m[13]*m[ 3]-m[12]*m[ 4])+(m[12]*m[16]-m[13]*m[15])*m[ 2])+m[ 1]*(m[11]*(m[15]*m[19]-m[16]*m[17])-m[12]*(m[12]*m[19]-m[13]*m[17])+m[14]*(m[12]*m[16]-m[13]*m[15])));
-    c[11] = m[ 3]*(m[ 9]*(m[17]*(m[10]*m[ 4]-m[ 5]*m[ 9])+m[ 3]*(m[20]*m[ 9]-m[10]*m[19])-(m[20]*m[ 4]-m[19]*m[ 5])*m[ 8])-m[10]*(m[16]*(m[10]*m[ 4]-m[ 5]*m[ 9])+m[ 3]*(m[19]*m[ 9]-m[10]*m[18])-(m[19]*m[ 4]-m[18]*m[ 5])*m[ 8])+m[ 1]*((-m[16]*(m[20]*m[ 9]-m[10]*m[19]))+m[17]*(m[19]*m[ 9]-m[10]*m[18])+(m[18]*m[20]-m[19]*m[19])*m[ 8])-((-m[16]*(m[20]*m[ 4]-m[19]*m[ 5]))+m[17]*(m[19]*m[ 4]-m[18]*m[ 5])+(m[18]*m[20]-m[19]*m[19])*m[ 3])*m[ 6])-m[ 4]*(m[ 8]*(m[17]*(m[10]*m[ 4]-m[ 5]*m[ 9])+m[ 3]*(m[20]*m[ 9]-m[10]*m[19])-(m[20]*m[ 4]-m[19]*m[ 5])*m[ 8])-m[10]*(m[15]*(m[10]*m[ 4]-m[ 5]*m[ 9])+m[ 3]*(m[17]*m[ 9]-m[10]*m[16])-(m[17]*m[ 4]-m[16]*m[ 5])*m[ 8])+m[ 1]*((-m[15]*(m[20]*m[ 9]-m[10]*m[19]))+m[17]*(m[17]*m[ 9]-m[10]*m[16])+(m[16]*m[20]-m[17]*m[19])*m[ 8])-((-m[15]*(m[20]*m[ 4]-m[19]*m[ 5]))+m[17]*(m[17]*m[ 4]-m[16]*m[ 5])+(m[16]*m[20]-m[17]*m[19])*m[ 3])*m[ 6])+m[ 5]*(m[ 8]*(m[16]*(m[10]*m[ 4]-m[ 5]*m[ 9])+m[ 3]*(m[19]*m[ 9]-m[10]*m[18])-(m[19]*m[ 4]-m[18]*m[ 5])*m[ 8])-m[ 9]*(m[15]*(m[10]*m[ 4]-m[ 5]*m[ 9])+m[ 3]*(m[17]*m[ 9]-m[10]*m[16])-(m[17]*m[ 4]-m[16]*m[ 5])*m[ 8])+m[ 1]*((-m[15]*(m[19]*m[ 9]-m[10]*m[18]))+m[16]*(m[17]*m[ 9]-m[10]*m[16])+(m[16]*m[19]-m[17]*m[18])*m[ 8])-((-m[15]*(m[19]*m[ 4]-m[18]*m[ 5]))+m[16]*(m[17]*m[ 4]-m[16]*m[ 5])+(m[16]*m[19]-m[17]*m[18])*m[ 3])*m[ 6])+m[ 0]*((-m[ 8]*((-m[16]*(m[20]*m[ 9]-m[10]*m[19]))+m[17]*(m[19]*m[ 9]-m[10]*m[18])+(m[18]*m[20]-m[19]*m[19])*m[ 8]))+m[ 9]*((-m[15]*(m[20]*m[ 9]-m[10]*m[19]))+m[17]*(m[17]*m[ 9]-m[10]*m[16])+(m[16]*m[20]-m[17]*m[19])*m[ 8])-m[10]*((-m[15]*(m[19]*m[ 9]-m[10]*m[18]))+m[16]*(m[17]*m[ 9]-m[10]*m[16])+(m[16]*m[19]-m[17]*m[18])*m[ 8])+(m[15]*(m[18]*m[20]-m[19]*m[19])-m[16]*(m[16]*m[20]-m[17]*m[19])+m[17]*(m[16]*m[19]-m[17]*m[18]))*m[ 6])-m[ 1]*(((-m[15]*(m[20]*m[ 4]-m[19]*m[ 5]))+m[17]*(m[17]*m[ 4]-m[16]*m[ 5])+(m[16]*m[20]-m[17]*m[19])*m[ 3])*m[ 9]-((-m[16]*(m[20]*m[ 4]-m[19]*m[ 5]))+m[17]*(m[19]*m[ 4]-m[18]*m[ 5])+(m[18]*m[20]-m[19]*m[19])*m[ 3])*m[ 8]-m[10]*((-m[15]*(m[19]*m[ 4]-m[18]*m[ 5]))+m[16]*(m[17]*m[ 4]-m[16]*m[ 5])+(m[16]*m[19]-m[17]*m[18])*m[ 3])+m[ 1]*(m[15]*(m[18]*m[20]-m[19]*m[19])-m[16]*(m[16]*m[20]-m[17]*m[19])+m[17]*(m[16]*m[19]-m[17]*m[18])));
-    c[12] = (-m[ 3]*(m[ 9]*(m[14]*(m[10]*m[ 4]-m[ 5]*m[ 9])+m[ 2]*(m[20]*m[ 9]-m[10]*m[19])-(m[20]*m[ 4]-m[19]*m[ 5])*m[ 7])-m[10]*(m[13]*(m[10]*m[ 4]-m[ 5]*m[ 9])+m[ 2]*(m[19]*m[ 9]-m[10]*m[18])-(m[19]*m[ 4]-m[18]*m[ 5])*m[ 7])+m[ 1]*((-m[13]*(m[20]*m[ 9]-m[10]*m[19]))+m[14]*(m[19]*m[ 9]-m[10]*m[18])+(m[18]*m[20]-m[19]*m[19])*m[ 7])-((-m[13]*(m[20]*m[ 4]-m[19]*m[ 5]))+m[14]*(m[19]*m[ 4]-m[18]*m[ 5])+m[ 2]*(m[18]*m[20]-m[19]*m[19]))*m[ 6]))+m[ 4]*(m[ 8]*(m[14]*(m[10]*m[ 4]-m[ 5]*m[ 9])+m[ 2]*(m[20]*m[ 9]-m[10]*m[19])-(m[20]*m[ 4]-m[19]*m[ 5])*m[ 7])-m[10]*(m[12]*(m[10]*m[ 4]-m[ 5]*m[ 9])+m[ 2]*(m[17]*m[ 9]-m[10]*m[16])-(m[17]*m[ 4]-m[16]*m[ 5])*m[ 7])+m[ 1]*((-m[12]*(m[20]*m[ 9]-m[10]*m[19]))+m[14]*(m[17]*m[ 9]-m[10]*m[16])+(m[16]*m[20]-m[17]*m[19])*m[ 7])-((-m[12]*(m[20]*m[ 4]-m[19]*m[ 5]))+m[14]*(m[17]*m[ 4]-m[16]*m[ 5])+m[ 2]*(m[16]*m[20]-m[17]*m[19]))*m[ 6])-m[ 5]*(m[ 8]*(m[13]*(m[10]*m[ 4]-m[ 5]*m[ 9])+m[ 2]*(m[19]*m[ 9]-m[10]*m[18])-(m[19]*m[ 4]-m[18]*m[ 5])*m[ 7])-m[ 9]*(m[12]*(m[10]*m[ 4]-m[ 5]*m[ 9])+m[ 2]*(m[17]*m[ 9]-m[10]*m[16])-(m[17]*m[ 4]-m[16]*m[ 5])*m[ 7])+m[ 1]*((-m[12]*(m[19]*m[ 9]-m[10]*m[18]))+m[13]*(m[17]*m[ 9]-m[10]*m[16])+(m[16]*m[19]-m[17]*m[18])*m[ 7])-((-m[12]*(m[19]*m[ 4]-m[18]*m[ 5]))+m[13]*(m[17]*m[ 4]-m[16]*m[ 5])+(m[16]*m[19]-m[17]*m[18])*m[ 2])*m[ 6])-m[ 0]*((-m[ 8]*((-m[13]*(m[20]*m[ 9]-m[10]*m[19]))+m[14]*(m[19]*m[ 9]-m[10]*m[18])+(m[18]*m[20]-m[19]*m[19])*m[ 7]))+m[ 9]*((-m[12]*(m[20]*m[ 9]-m[10]*m[19]))+m[14]*(m[17]*m[ 9]-m[10]*m[16])+(m[16]*m[20]-m[17]*m[19])*m[ 7])-m[10]*((-m[12]*(m[19]*m[ 9]-m[10]*m[18]))+m[13]*(m[17]*m[ 9]-m[10]*m[16])+(m[16]*m[19]-m[17]*m[18])*m[ 7])+(m[12]*(m[18]*m[20]-m[19]*m[19])-m[13]*(m[16]*m[20]-m[17]*m[19])+m[14]*(m[16]*m[19]-m[17]*m[18]))*m[ 6])+m[ 1]*(((-m[12]*(m[20]*m[ 4]-m[19]*m[ 5]))+m[14]*(m[17]*m[ 4]-m[16]*m[ 5])+m[ 2]*(m[16]*m[20]-m[17]*m[19]))*m[ 9]-((-m[13]*(m[20]*m[ 4]-m[19]*m[ 5]))+m[14]*(m[19]*m[ 4]-m[18]*m[ 5])+m[ 2]*(m[18]*m[20]-m[19]*m[19]))*m[ 8]-m[10]*((-m[12]*(m[19]*m[ 4]-m[18]*m[ 5]))+m[13]*(m[17]*m[ 4]-m[16]*m[ 5])+(m[16]*m[19]-m[17]*m[18])*m[ 2])+m[ 1]*(m[12]*(m[18]*m[20]-m[19]*m[19])-m[13]*(m[16]*m[20]-m[17]*m[19])+m[14]*(m[16]*m[19]-m[17]*m[18])));
-    c[13] = m[ 3]*((m[14]*(m[10]*m[ 3]-m[ 5]*m[ 8])+m[ 2]*(m[20]*m[ 8]-m[10]*m[17])-(m[20]*m[ 3]-m[17]*m[ 5])*m[ 7])*m[ 9]-m[10]*(m[13]*(m[10]*m[ 3]-m[ 5]*m[ 8])+m[ 2]*(m[19]*m[ 8]-m[10]*m[16])-(m[19]*m[ 3]-m[16]*m[ 5])*m[ 7])+m[ 1]*((-m[13]*(m[20]*m[ 8]-m[10]*m[17]))+m[14]*(m[19]*m[ 8]-m[10]*m[16])+(m[16]*m[20]-m[17]*m[19])*m[ 7])-((-m[13]*(m[20]*m[ 3]-m[17]*m[ 5]))+m[14]*(m[19]*m[ 3]-m[16]*m[ 5])+m[ 2]*(m[16]*m[20]-m[17]*m[19]))*m[ 6])+m[ 5]*((-(m[12]*(m[10]*m[ 3]-m[ 5]*m[ 8])+m[ 2]*(m[17]*m[ 8]-m[10]*m[15])-(m[17]*m[ 3]-m[15]*m[ 5])*m[ 7])*m[ 9])+m[ 8]*(m[13]*(m[10]*m[ 3]-m[ 5]*m[ 8])+m[ 2]*(m[19]*m[ 8]-m[10]*m[16])-(m[19]*m[ 3]-m[16]*m[ 5])*m[ 7])+m[ 1]*((-m[12]*(m[19]*m[ 8]-m[10]*m[16]))+m[13]*(m[17]*m[ 8]-m[10]*m[15])+(m[15]*m[19]-m[16]*m[17])*m[ 7])-((-m[12]*(m[19]*m[ 3]-m[16]*m[ 5]))+m[13]*(m[17]*m[ 3]-m[15]*m[ 5])+(m[15]*m[19]-m[16]*m[17])*m[ 2])*m[ 6])+m[ 0]*(((-m[12]*(m[20]*m[ 8]-m[10]*m[17]))+m[14]*(m[17]*m[ 8]-m[10]*m[15])+(m[15]*m[20]-m[17]*m[17])*m[ 7])*m[ 9]-m[ 8]*((-m[13]*(m[20]*m[ 8]-m[10]*m[17]))+m[14]*(m[19]*m[ 8]-m[10]*m[16])+(m[16]*m[20]-m[17]*m[19])*m[ 7])-m[10]*((-m[12]*(m[19]*m[ 8]-m[10]*m[16]))+m[13]*(m[17]*m[ 8]-m[10]*m[15])+(m[15]*m[19]-m[16]*m[17])*m[ 7])+(m[12]*(m[16]*m[20]-m[17]*m[19])-m[13]*(m[15]*m[20]-m[17]*m[17])+m[14]*(m[15]*m[19]-m[16]*m[17]))*m[ 6])-m[ 1]*(((-m[12]*(m[20]*m[ 3]-m[17]*m[ 5]))+m[14]*(m[17]*m[ 3]-m[15]*m[ 5])+m[ 2]*(m[15]*m[20]-m[17]*m[17]))*m[ 9]-((-m[13]*(m[20]*m[ 3]-m[17]*m[ 5]))+m[14]*(m[19]*m[ 3]-m[16]*m[ 5])+m[ 2]*(m[16]*m[20]-m[17]*m[19]))*m[ 8]-m[10]*((-m[12]*(m[19]*m[ 3]-m[16]*m[ 5]))+m[13]*(m[17]*m[ 3]-m[15]*m[ 5])+(m[15]*m[19]-m[16]*m[17])*m[ 2])+m[ 1]*(m[12]*(m[16]*m[20]-m[17]*m[19])-m[13]*(m[15]*m[20]-m[17]*m[17])+m[14]*(m[15]*m[19]-m[16]*m[17])))-m[ 4]*(m[ 8]*(m[14]*(m[10]*m[ 3]-m[ 5]*m[ 8])+m[ 2]*(m[20]*m[ 8]-m[10]*m[17])-(m[20]*m[ 3]-m[17]*m[ 5])*m[ 7])-m[10]*(m[12]*(m[10]*m[ 3]-m[ 5]*m[ 8])+m[ 2]*(m[17]*m[ 8]-m[10]*m[15])-(m[17]*m[ 3]-m[15]*m[ 5])*m[ 7])+m[ 1]*((-m[12]*(m[20]*m[ 8]-m[10]*m[17]))+m[14]*(m[17]*m[ 8]-m[10]*m[15])+(m[15]*m[20]-m[17]*m[17])*m[ 7])-((-m[12]*(m[20]*m[ 3]-m[17]*m[ 5]))+m[14]*(m[17]*m[ 3]-m[15]*m[ 5])+m[ 2]*(m[15]*m[20]-m[17]*m[17]))*m[ 6]);
-    c[14] = (-m[ 3]*(m[ 9]*(m[14]*(m[ 3]*m[ 9]-m[ 4]*m[ 8])+m[ 2]*(m[19]*m[ 8]-m[17]*m[ 9])-(m[19]*m[ 3]-m[17]*m[ 4])*m[ 7])-m[10]*(m[13]*(m[ 3]*m[ 9]-m[ 4]*m[ 8])+m[ 2]*(m[18]*m[ 8]-m[16]*m[ 9])-(m[18]*m[ 3]-m[16]*m[ 4])*m[ 7])+m[ 1]*((-m[13]*(m[19]*m[ 8]-m[17]*m[ 9]))+m[14]*(m[18]*m[ 8]-m[16]*m[ 9])+(m[16]*m[19]-m[17]*m[18])*m[ 7])-((-m[13]*(m[19]*m[ 3]-m[17]*m[ 4]))+m[14]*(m[18]*m[ 3]-m[16]*m[ 4])+(m[16]*m[19]-m[17]*m[18])*m[ 2])*m[ 6]))+m[ 4]*(m[ 8]*(m[14]*(m[ 3]*m[ 9]-m[ 4]*m[ 8])+m[ 2]*(m[19]*m[ 8]-m[17]*m[ 9])-(m[19]*m[ 3]-m[17]*m[ 4])*m[ 7])-m[10]*(m[12]*(m[ 3]*m[ 9]-m[ 4]*m[ 8])+m[ 2]*(m[16]*m[ 8]-m[15]*m[ 9])-(m[16]*m[ 3]-m[15]*m[ 4])*m[ 7])+m[ 1]*((-m[12]*(m[19]*m[ 8]-m[17]*m[ 9]))+m[14]*(m[16]*m[ 8]-m[15]*m[ 9])+(m[15]*m[19]-m[16]*m[17])*m[ 7])-((-m[12]*(m[19]*m[ 3]-m[17]*m[ 4]))+m[14]*(m[16]*m[ 3]-m[15]*m[ 4])+(m[15]*m[19]-m[16]*m[17])*m[ 2])*m[ 6])-m[ 5]*(m[ 8]*(m[13]*(m[ 3]*m[ 9]-m[ 4]*m[ 8])+m[ 2]*(m[18]*m[ 8]-m[16]*m[ 9])-(m[18]*m[ 3]-m[16]*m[ 4])*m[ 7])-m[ 9]*(m[12]*(m[ 3]*m[ 9]-m[ 4]*m[ 8])+m[ 2]*(m[16]*m[ 8]-m[15]*m[ 9])-(m[16]*m[ 3]-m[15]*m[ 4])*m[ 7])+m[ 1]*((-m[12]*(m[18]*m[ 8]-m[16]*m[ 9]))+m[13]*(m[16]*m[ 8]-m[15]*m[ 9])+(m[15]*m[18]-m[16]*m[16])*m[ 7])-((-m[12]*(m[18]*m[ 3]-m[16]*m[ 4]))+m[13]*(m[16]*m[ 3]-m[15]*m[ 4])+(m[15]*m[18]-m[16]*m[16])*m[ 2])*m[ 6])-m[ 0]*((-m[ 8]*((-m[13]*(m[19]*m[ 8]-m[17]*m[ 9]))+m[14]*(m[18]*m[ 8]-m[16]*m[ 9])+(m[16]*m[19]-m[17]*m[18])*m[ 7]))+m[ 9]*((-m[12]*(m[19]*m[ 8]-m[17]*m[ 9]))+m[14]*(m[16]*m[ 8]-m[15]*m[ 9])+(m[15]*m[19]-m[16]*m[17])*m[ 7])-m[10]*((-m[12]*(m[18]*m[ 8]-m[16]*m[ 9]))+m[13]*(m[16]*m[ 8]-m[15]*m[ 9])+(m[15]*m[18]-m[16]*m[16])*m[ 7])+(m[12]*(m[16]*m[19]-m[17]*m[18])-m[13]*(m[15]*m[19]-m[16]*m[17])+m[14]*(m[15]*m[18]-m[16]*m[16]))*m[ 6])+m[ 1]*(((-m[12]*(m[19]*m[ 3]-m[17]*m[ 4]))+m[14]*(m[16]*m[ 3]-m[15]*m[ 4])+(m[15]*m[19]-m[16]*m[17])*m[ 2])*m[ 9]-((-m[13]*(m[19]*m[ 3]-m[17]*m[ 4]))+m[14]*(m[18]*m[ 3]-m[16]*m[ 4])+(m[16]*m[19]-m[17]*m[18])*m[ 2])*m[ 8]-m[10]*((-m[12]*(m[18]*m[ 3]-m[16]*m[ 4]))+m[13]*(m[16]*m[ 3]-m[15]*m[ 4])+(m[15]*m[18]-m[16]*m[16])*m[ 2])+m[ 1]*(m[12]*(m[16]*m[19]-m[17]*m[18])-m[13]*(m[15]*m[19]-m[16]*m[17])+m[14]*(m[15]*m[18]-m[16]*m[16])));
-    c[15] = m[ 2]*(m[ 9]*(m[14]*(m[10]*m[ 4]-m[ 5]*m[ 9])+m[ 2]*(m[20]*m[ 9]-m[10]*m[19])-(m[20]*m[ 4]-m[19]*m[ 5])*m[ 7])-m[10]*(m[13]*(m[10]*m[ 4]-m[ 5]*m[ 9])+m[ 2]*(m[19]*m[ 9]-m[10]*m[18])-(m[19]*m[ 4]-m[18]*m[ 5])*m[ 7])+m[ 1]*((-m[13]*(m[20]*m[ 9]-m[10]*m[19]))+m[14]*(m[19]*m[ 9]-m[10]*m[18])+(m[18]*m[20]-m[19]*m[19])*m[ 7])-((-m[13]*(m[20]*m[ 4]-m[19]*m[ 5]))+m[14]*(m[19]*m[ 4]-m[18]*m[ 5])+m[ 2]*(m[18]*m[20]-m[19]*m[19]))*m[ 6])-m[ 4]*(m[ 7]*(m[14]*(m[10]*m[ 4]-m[ 5]*m[ 9])+m[ 2]*(m[20]*m[ 9]-m[10]*m[19])-(m[20]*m[ 4]-m[19]*m[ 5])*m[ 7])-m[10]*(m[11]*(m[10]*m[ 4]-m[ 5]*m[ 9])+m[ 2]*(m[14]*m[ 9]-m[10]*m[13])-(m[14]*m[ 4]-m[13]*m[ 5])*m[ 7])+m[ 1]*((-m[11]*(m[20]*m[ 9]-m[10]*m[19]))+m[14]*(m[14]*m[ 9]-m[10]*m[13])+(m[13]*m[20]-m[14]*m[19])*m[ 7])-((-m[11]*(m[20]*m[ 4]-m[19]*m[ 5]))+m[14]*(m[14]*m[ 4]-m[13]*m[ 5])+m[ 2]*(m[13]*m[20]-m[14]*m[19]))*m[ 6])+m[ 5]*(m[ 7]*(m[13]*(m[10]*m[ 4]-m[ 5]*m[ 9])+m[ 2]*(m[19]*m[ 9]-m[10]*m[18])-(m[19]*m[ 4]-m[18]*m[ 5])*m[ 7])-m[ 9]*(m[11]*(m[10]*m[ 4]-m[ 5]*m[ 9])+m[ 2]*(m[14]*m[ 9]-m[10]*m[13])-(m[14]*m[ 4]-m[13]*m[ 5])*m[ 7])+m[ 1]*((-m[11]*(m[19]*m[ 9]-m[10]*m[18]))+m[13]*(m[14]*m[ 9]-m[10]*m[13])+(m[13]*m[19]-m[14]*m[18])*m[ 7])-((-m[11]*(m[19]*m[ 4]-m[18]*m[ 5]))+m[13]*(m[14]*m[ 4]-m[13]*m[ 5])+(m[13]*m[19]-m[14]*m[18])*m[ 2])*m[ 6])+m[ 0]*((-m[ 7]*((-m[13]*(m[20]*m[ 9]-m[10]*m[19]))+m[14]*(m[19]*m[ 9]-m[10]*m[18])+(m[18]*m[20]-m[19]*m[19])*m[ 7]))+m[ 9]*((-m[11]*(m[20]*m[ 9]-m[10]*m[19]))+m[14]*(m[14]*m[ 9]-m[10]*m[13])+(m[13]*m[20]-m[14]*m[19])*m[ 7])-m[10]*((-m[11]*(m[19]*m[ 9]-m[10]*m[18]))+m[13]*(m[14]*m[ 9]-m[10]*m[13])+(m[13]*m[19]-m[14]*m[18])*m[ 7])+(m[11]*(m[18]*m[20]-m[19]*m[19])-m[13]*(m[13]*m[20]-m[14]*m[19])+m[14]*(m[13]*m[19]-m[14]*m[18]))*m[ 6])-m[ 1]*(((-m[11]*(m[20]*m[ 4]-m[19]*m[ 5]))+m[14]*(m[14]*m[ 4]-m[13]*m[ 5])+m[ 2]*(m[13]*m[20]-m[14]*m[19]))*m[ 9]-((-m[13]*(m[20]*m[ 4]-m[19]*m[ 5]))+m[14]*(m[19]*m[ 4]-m[18]*m[ 5])+m[ 2]*(m[18]*m[20]-m[19]*m[19]))*m[ 7]-m[10]*((-m[11]*(m[19]*m[ 4]-m[18]*m[ 5]))+m[13]*(m[14]*m[ 4]-m[13]*m[ 5])+(m[13]*m[19]-m[14]*m[18])*m[ 2])+m[ 1]*(m[11]*(m[18]*m[20]-m[19]*m[19])-m[13]*(m[13]*m[20]-m[14]*m[19])+m[14]*(m[13]*m[19]-m[14]*m[18])));
-    c[16] = (-m[ 2]*((m[14]*(m[10]*m[ 3]-m[ 5]*m[ 8])+m[ 2]*(m[20]*m[ 8]-m[10]*m[17])-(m[20]*m[ 3]-m[17]*m[ 5])*m[ 7])*m[ 9]-m[10]*(m[13]*(m[10]*m[ 3]-m[ 5]*m[ 8])+m[ 2]*(m[19]*m[ 8]-m[10]*m[16])-(m[19]*m[ 3]-m[16]*m[ 5])*m[ 7])+m[ 1]*((-m[13]*(m[20]*m[ 8]-m[10]*m[17]))+m[14]*(m[19]*m[ 8]-m[10]*m[16])+(m[16]*m[20]-m[17]*m[19])*m[ 7])-((-m[13]*(m[20]*m[ 3]-m[17]*m[ 5]))+m[14]*(m[19]*m[ 3]-m[16]*m[ 5])+m[ 2]*(m[16]*m[20]-m[17]*m[19]))*m[ 6]))-m[ 5]*((-(m[11]*(m[10]*m[ 3]-m[ 5]*m[ 8])+m[ 2]*(m[14]*m[ 8]-m[10]*m[12])-(m[14]*m[ 3]-m[12]*m[ 5])*m[ 7])*m[ 9])+m[ 7]*(m[13]*(m[10]*m[ 3]-m[ 5]*m[ 8])+m[ 2]*(m[19]*m[ 8]-m[10]*m[16])-(m[19]*m[ 3]-m[16]*m[ 5])*m[ 7])+m[ 1]*((-m[11]*(m[19]*m[ 8]-m[10]*m[16]))+m[13]*(m[14]*m[ 8]-m[10]*m[12])+(m[12]*m[19]-m[14]*m[16])*m[ 7])-((-m[11]*(m[19]*m[ 3]-m[16]*m[ 5]))+m[13]*(m[14]*m[ 3]-m[12]*m[ 5])+(m[12]*m[19]-m[14]*m[16])*m[ 2])*m[ 6])-m[ 0]*(((-m[11]*(m[20]*m[ 8]-m[10]*m[17]))+m[14]*(m[14]*m[ 8]-m[10]*m[12])+(m[12]*m[20]-m[14]*m[17])*m[ 7])*m[ 9]-m[ 7]*((-m[13]*(m[20]*m[ 8]-m[10]*m[17]))+m[14]*(m[19]*m[ 8]-m[10]*m[16])+(m[16]*m[20]-m[17]*m[19])*m[ 7])-m[10]*((-m[11]*(m[19]*m[ 8]-m[10]*m[16]))+m[13]*(m[14]*m[ 8]-m[10]*m[12])+(m[12]*m[19]-m[14]*m[16])*m[ 7])+(m[11]*(m[16]*m[20]-m[17]*m[19])-m[13]*(m[12]*m[20]-m[14]*m[17])+m[14]*(m[12]*m[19]-m[14]*m[16]))*m[ 6])+m[ 1]*(((-m[11]*(m[20]*m[ 3]-m[17]*m[ 5]))+m[14]*(m[14]*m[ 3]-m[12]*m[ 5])+m[ 2]*(m[12]*m[20]-m[14]*m[17]))*m[ 9]-((-m[13]*(m[20]*m[ 3]-m[17]*m[ 5]))+m[14]*(m[19]*m[ 3]-m[16]*m[ 5])+m[ 2]*(m[16]*m[20]-m[17]*m[19]))*m[ 7]-m[10]*((-m[11]*(m[19]*m[ 3]-m[16]*m[ 5]))+m[13]*(m[14]*m[ 3]-m[12]*m[ 5])+(m[12]*m[19]-m[14]*m[16])*m[ 2])+m[ 1]*(m[11]*(m[16]*m[20]-m[17]*m[19])-m[13]*(m[12]*m[20]-m[14]*m[17])+m[14]*(m[12]*m[19]-m[14]*m[16])))+m[ 4]*(m[ 7]*(m[14]*(m[10]*m[ 3]-m[ 5]*m[ 8])+m[ 2]*(m[20]*m[ 8]-m[10]*m[17])-(m[20]*m[ 3]-m[17]*m[ 5])*m[ 7])-m[10]*(m[11]*(m[10]*m[ 3]-m[ 5]*m[ 8])+m[ 2]*(m[14]*m[ 8]-m[10]*m[12])-(m[14]*m[ 3]-m[12]*m[ 5])*m[ 7])+m[ 1]*((-m[11]*(m[20]*m[ 8]-m[10]*m[17]))+m[14]*(m[14]*m[ 8]-m[10]*m[12])+(m[12]*m[20]-m[14]*m[17])*m[ 7])-((-m[11]*(m[20]*m[ 3]-m[17]*m[ 5]))+m[14]*(m[14]*m[ 3]-m[12]*m[ 5])+m[ 2]*(m[12]*m[20]-m[14]*m[17]))*m[ 6]);
-    c[17] = m[ 2]*(m[ 9]*(m[14]*(m[ 3]*m[ 9]-m[ 4]*m[ 8])+m[ 2]*(m[19]*m[ 8]-m[17]*m[ 9])-(m[19]*m[ 3]-m[17]*m[ 4])*m[ 7])-m[10]*(m[13]*(m[ 3]*m[ 9]-m[ 4]*m[ 8])+m[ 2]*(m[18]*m[ 8]-m[16]*m[ 9])-(m[18]*m[ 3]-m[16]*m[ 4])*m[ 7])+m[ 1]*((-m[13]*(m[19]*m[ 8]-m[17]*m[ 9]))+m[14]*(m[18]*m[ 8]-m[16]*m[ 9])+(m[16]*m[19]-m[17]*m[18])*m[ 7])-((-m[13]*(m[19]*m[ 3]-m[17]*m[ 4]))+m[14]*(m[18]*m[ 3]-m[16]*m[ 4])+(m[16]*m[19]-m[17]*m[18])*m[ 2])*m[ 6])-m[ 4]*(m[ 7]*(m[14]*(m[ 3]*m[ 9]-m[ 4]*m[ 8])+m[ 2]*(m[19]*m[ 8]-m[17]*m[ 9])-(m[19]*m[ 3]-m[17]*m[ 4])*m[ 7])-m[10]*(m[11]*(m[ 3]*m[ 9]-m[ 4]*m[ 8])+m[ 2]*(m[13]*m[ 8]-m[12]*m[ 9])-(m[13]*m[ 3]-m[12]*m[ 4])*m[ 7])+m[ 1]*((-m[11]*(m[19]*m[ 8]-m[17]*m[ 9]))+m[14]*(m[13]*m[ 8]-m[12]*m[ 9])+(m[12]*m[19]-m[13]*m[17])*m[ 7])-((-m[11]*(m[19]*m[ 3]-m[17]*m[ 4]))+m[14]*(m[13]*m[ 3]-m[12]*m[ 4])+(m[12]*m[19]-m[13]*m[17])*m[ 2])*m[ 6])+m[ 5]*(m[ 7]*(m[13]*(m[ 3]*m[ 9]-m[ 4]*m[ 8])+m[ 2]*(m[18]*m[ 8]-m[16]*m[ 9])-(m[18]*m[ 3]-m[16]*m[ 4])*m[ 7])-m[ 9]*(m[11]*(m[ 3]*m[ 9]-m[ 4]*m[ 8])+m[ 2]*(m[13]*m[ 8]-m[12]*m[ 9])-(m[13]*m[ 3]-m[12]*m[ 4])*m[ 7])+m[ 1]*((-m[11]*(m[18]*m[ 8]-m[16]*m[ 9]))+m[13]*(m[13]*m[ 8]-m[12]*m[ 9])+(m[12]*m[18]-m[13]*m[16])*m[ 7])-((-m[11]*(m[18]*m[ 3]-m[16]*m[ 4]))+m[13]*(m[13]*m[ 3]-m[12]*m[ 4])+(m[12]*m[18]-m[13]*m[16])*m[ 2])*m[ 6])+m[ 0]*((-m[ 7]*((-m[13]*(m[19]*m[ 8]-m[17]*m[ 9]))+m[14]*(m[18]*m[ 8]-m[16]*m[ 9])+(m[16]*m[19]-m[17]*m[18])*m[ 7]))+m[ 9]*((-m[11]*(m[19]*m[ 8]-m[17]*m[ 9]))+m[14]*(m[13]*m[ 8]-m[12]*m[ 9])+(m[12]*m[19]-m[13]*m[17])*m[ 7])-m[10]*((-m[11]*(m[18]*m[ 8]-m[16]*m[ 9]))+m[13]*(m[13]*m[ 8]-m[12]*m[ 9])+(m[12]*m[18]-m[13]*m[16])*m[ 7])+(m[11]*(m[16]*m[19]-m[17]*m[18])-m[13]*(m[12]*m[19]-m[13]*m[17])+m[14]*(m[12]*m[18]-m[13]*m[16]))*m[ 6])-m[ 1]*(((-m[11]*(m[19]*m[ 3]-m[17]*m[ 4]))+m[14]*(m[13]*m[ 3]-m[12]*m[ 4])+(m[12]*m[19]-m[13]*m[17])*m[ 2])*m[ 9]-((-m[13]*(m[19]*m[ 3]-m[17]*m[ 4]))+m[14]*(m[18]*m[ 3]-m[16]*m[ 4])+(m[16]*m[19]-m[17]*m[18])*m[ 2])*m[ 7]-m[10]*((-m[11]*(m[18]*m[ 3]-m[16]*m[ 4]))+m[13]*(m[13]*m[ 3]-m[12]*m[ 4])+(m[12]*m[18]-m[13]*m[16])*m[ 2])+m[ 1]*(m[11]*(m[16]*m[19]-m[17]*m[18])-m[13]*(m[12]*m[19]-m[13]*m[17])+m[14]*(m[12]*m[18]-m[13]*m[16])));
-    c[18] = m[ 2]*(m[ 8]*(m[14]*(m[10]*m[ 3]-m[ 5]*m[ 8])+m[ 2]*(m[20]*m[ 8]-m[10]*m[17])-(m[20]*m[ 3]-m[17]*m[ 5])*m[ 7])-m[10]*(m[12]*(m[10]*m[ 3]-m[ 5]*m[ 8])+m[ 2]*(m[17]*m[ 8]-m[10]*m[15])-(m[17]*m[ 3]-m[15]*m[ 5])*m[ 7])+m[ 1]*((-m[12]*(m[20]*m[ 8]-m[10]*m[17]))+m[14]*(m[17]*m[ 8]-m[10]*m[15])+(m[15]*m[20]-m[17]*m[17])*m[ 7])-((-m[12]*(m[20]*m[ 3]-m[17]*m[ 5]))+m[14]*(m[17]*m[ 3]-m[15]*m[ 5])+m[ 2]*(m[15]*m[20]-m[17]*m[17]))*m[ 6])-m[ 3]*(m[ 7]*(m[14]*(m[10]*m[ 3]-m[ 5]*m[ 8])+m[ 2]*(m[20]*m[ 8]-m[10]*m[17])-(m[20]*m[ 3]-m[17]*m[ 5])*m[ 7])-m[10]*(m[11]*(m[10]*m[ 3]-m[ 5]*m[ 8])+m[ 2]*(m[14]*m[ 8]-m[10]*m[12])-(m[14]*m[ 3]-m[12]*m[ 5])*m[ 7])+m[ 1]*((-m[11]*(m[20]*m[ 8]-m[10]*m[17]))+m[14]*(m[14]*m[ 8]-m[10]*m[12])+(m[12]*m[20]-m[14]*m[17])*m[ 7])-((-m[11]*(m[20]*m[ 3]-m[17]*m[ 5]))+m[14]*(m[14]*m[ 3]-m[12]*m[ 5])+m[ 2]*(m[12]*m[20]-m[14]*m[17]))*m[ 6])+m[ 5]*(m[ 7]*(m[12]*(m[10]*m[ 3]-m[ 5]*m[ 8])+m[ 2]*(m[17]*m[ 8]-m[10]*m[15])-(m[17]*m[ 3]-m[15]*m[ 5])*m[ 7])-m[ 8]*(m[11]*(m[10]*m[ 3]-m[ 5]*m[ 8])+m[ 2]*(m[14]*m[ 8]-m[10]*m[12])-(m[14]*m[ 3]-m[12]*m[ 5])*m[ 7])+m[ 1]*((-m[11]*(m[17]*m[ 8]-m[10]*m[15]))+m[12]*(m[14]*m[ 8]-m[10]*m[12])+(m[12]*m[17]-m[14]*m[15])*m[ 7])-((-m[11]*(m[17]*m[ 3]-m[15]*m[ 5]))+m[12]*(m[14]*m[ 3]-m[12]*m[ 5])+(m[12]*m[17]-m[14]*m[15])*m[ 2])*m[ 6])+m[ 0]*((-m[ 7]*((-m[12]*(m[20]*m[ 8]-m[10]*m[17]))+m[14]*(m[17]*m[ 8]-m[10]*m[15])+(m[15]*m[20]-m[17]*m[17])*m[ 7]))+m[ 8]*((-m[11]*(m[20]*m[ 8]-m[10]*m[17]))+m[14]*(m[14]*m[ 8]-m[10]*m[12])+(m[12]*m[20]-m[14]*m[17])*m[ 7])-m[10]*((-m[11]*(m[17]*m[ 8]-m[10]*m[15]))+m[12]*(m[14]*m[ 8]-m[10]*m[12])+(m[12]*m[17]-m[14]*m[15])*m[ 7])+(m[11]*(m[15]*m[20]-m[17]*m[17])-m[12]*(m[12]*m[20]-m[14]*m[17])+m[14]*(m[12]*m[17]-m[14]*m[15]))*m[ 6])-m[ 1]*(((-m[11]*(m[20]*m[ 3]-m[17]*m[ 5]))+m[14]*(m[14]*m[ 3]-m[12]*m[ 5])+m[ 2]*(m[12]*m[20]-m[14]*m[17]))*m[ 8]-((-m[12]*(m[20]*m[ 3]-m[17]*m[ 5]))+m[14]*(m[17]*m[ 3]-m[15]*m[ 5])+m[ 2]*(m[15]*m[20]-m[17]*m[17]))*m[ 7]-m[10]*((-m[11]*(m[17]*m[ 3]-m[15]*m[ 5]))+m[12]*(m[14]*m[ 3]-m[12]*m[ 5])+(m[12]*m[17]-m[14]*m[15])*m[ 2])+m[ 1]*(m[11]*(m[15]*m[20]-m[17]*m[17])-m[12]*(m[12]*m[20]-m[14]*m[17])+m[14]*(m[12]*m[17]-m[14]*m[15])));
-    c[19] = (-m[ 2]*(m[ 8]*(m[14]*(m[ 3]*m[ 9]-m[ 4]*m[ 8])+m[ 2]*(m[19]*m[ 8]-m[17]*m[ 9])-(m[19]*m[ 3]-m[17]*m[ 4])*m[ 7])-m[10]*(m[12]*(m[ 3]*m[ 9]-m[ 4]*m[ 8])+m[ 2]*(m[16]*m[ 8]-m[15]*m[ 9])-(m[16]*m[ 3]-m[15]*m[ 4])*m[ 7])+m[ 1]*((-m[12]*(m[19]*m[ 8]-m[17]*m[ 9]))+m[14]*(m[16]*m[ 8]-m[15]*m[ 9])+(m[15]*m[19]-m[16]*m[17])*m[ 7])-((-m[12]*(m[19]*m[ 3]-m[17]*m[ 4]))+m[14]*(m[16]*m[ 3]-m[15]*m[ 4])+(m[15]*m[19]-m[16]*m[17])*m[ 2])*m[ 6]))+m[ 3]*(m[ 7]*(m[14]*(m[ 3]*m[ 9]-m[ 4]*m[ 8])+m[ 2]*(m[19]*m[ 8]-m[17]*m[ 9])-(m[19]*m[ 3]-m[17]*m[ 4])*m[ 7])-m[10]*(m[11]*(m[ 3]*m[ 9]-m[ 4]*m[ 8])+m[ 2]*(m[13]*m[ 8]-m[12]*m[ 9])-(m[13]*m[ 3]-m[12]*m[ 4])*m[ 7])+m[ 1]*((-m[11]*(m[19]*m[ 8]-m[17]*m[ 9]))+m[14]*(m[13]*m[ 8]-m[12]*m[ 9])+(m[12]*m[19]-m[13]*m[17])*m[ 7])-((-m[11]*(m[19]*m[ 3]-m[17]*m[ 4]))+m[14]*(m[13]*m[ 3]-m[12]*m[ 4])+(m[12]*m[19]-m[13]*m[17])*m[ 2])*m[ 6])-m[ 5]*(m[ 7]*(m[12]*(m[ 3]*m[ 9]-m[ 4]*m[ 8])+m[ 2]*(m[16]*m[ 8]-m[15]*m[ 9])-(m[16]*m[ 3]-m[15]*m[ 4])*m[ 7])-m[ 8]*(m[11]*(m[ 3]*m[ 9]-m[ 4]*m[ 8])+m[ 2]*(m[13]*m[ 8]-m[12]*m[ 9])-(m[13]*m[ 3]-m[12]*m[ 4])*m[ 7])+m[ 1]*((-m[11]*(m[16]*m[ 8]-m[15]*m[ 9]))+m[12]*(m[13]*m[ 8]-m[12]*m[ 9])+(m[12]*m[16]-m[13]*m[15])*m[ 7])-((-m[11]*(m[16]*m[ 3]-m[15]*m[ 4]))+m[12]*(m[13]*m[ 3]-m[12]*m[ 4])+(m[12]*m[16]-m[13]*m[15])*m[ 2])*m[ 6])-m[ 0]*((-m[ 7]*((-m[12]*(m[19]*m[ 8]-m[17]*m[ 9]))+m[14]*(m[16]*m[ 8]-m[15]*m[ 9])+(m[15]*m[19]-m[16]*m[17])*m[ 7]))+m[ 8]*((-m[11]*(m[19]*m[ 8]-m[17]*m[ 9]))+m[14]*(m[13]*m[ 8]-m[12]*m[ 9])+(m[12]*m[19]-m[13]*m[17])*m[ 7])-m[10]*((-m[11]*(m[16]*m[ 8]-m[15]*m[ 9]))+m[12]*(m[13]*m[ 8]-m[12]*m[ 9])+(m[12]*m[16]-m[13]*m[15])*m[ 7])+(m[11]*(m[15]*m[19]-m[16]*m[17])-m[12]*(m[12]*m[19]-m[13]*m[17])+m[14]*(m[12]*m[16]-m[13]*m[15]))*m[ 6])+m[ 1]*(((-m[11]*(m[19]*m[ 3]-m[17]*m[ 4]))+m[14]*(m[13]*m[ 3]-m[12]*m[ 4])+(m[12]*m[19]-m[13]*m[17])*m[ 2])*m[ 8]-((-m[12]*(m[19]*m[ 3]-m[17]*m[ 4]))+m[14]*(m[16]*m[ 3]-m[15]*m[ 4])+(m[15]*m[19]-m[16]*m[17])*m[ 2])*m[ 7]-m[10]*((-m[11]*(m[16]*m[ 3]-m[15]*m[ 4]))+m[12]*(m[13]*m[ 3]-m[12]*m[ 4])+(m[12]*m[16]-m[13]*m[15])*m[ 2])+m[ 1]*(m[11]*(m[15]*m[19]-m[16]*m[17])-m[12]*(m[12]*m[19]-m[13]*m[17])+m[14]*(m[12]*m[16]-m[13]*m[15])));
-    c[20] = m[ 2]*(m[ 8]*(m[13]*(m[ 3]*m[ 9]-m[ 4]*m[ 8])+m[ 2]*(m[18]*m[ 8]-m[16]*m[ 9])-(m[18]*m[ 3]-m[16]*m[ 4])*m[ 7])-m[ 9]*(m[12]*(m[ 3]*m[ 9]-m[ 4]*m[ 8])+m[ 2]*(m[16]*m[ 8]-m[15]*m[ 9])-(m[16]*m[ 3]-m[15]*m[ 4])*m[ 7])+m[ 1]*((-m[12]*(m[18]*m[ 8]-m[16]*m[ 9]))+m[13]*(m[16]*m[ 8]-m[15]*m[ 9])+(m[15]*m[18]-m[16]*m[16])*m[ 7])-((-m[12]*(m[18]*m[ 3]-m[16]*m[ 4]))+m[13]*(m[16]*m[ 3]-m[15]*m[ 4])+(m[15]*m[18]-m[16]*m[16])*m[ 2])*m[ 6])-m[ 3]*(m[ 7]*(m[13]*(m[ 3]*m[ 9]-m[ 4]*m[ 8])+m[ 2]*(m[18]*m[ 8]-m[16]*m[ 9])-(m[18]*m[ 3]-m[16]*m[ 4])*m[ 7])-m[ 9]*(m[11]*(m[ 3]*m[ 9]-m[ 4]*m[ 8])+m[ 2]*(m[13]*m[ 8]-m[12]*m[ 9])-(m[13]*m[ 3]-m[12]*m[ 4])*m[ 7])+m[ 1]*((-m[11]*(m[18]*m[ 8]-m[16]*m[ 9]))+m[13]*(m[13]*m[ 8]-m[12]*m[ 9])+(m[12]*m[18]-m[13]*m[16])*m[ 7])-((-m[11]*(m[18]*m[ 3]-m[16]*m[ 4]))+m[13]*(m[13]*m[ 3]-m[12]*m[ 4])+(m[12]*m[18]-m[13]*m[16])*m[ 2])*m[ 6])+m[ 4]*(m[ 7]*(m[12]*(m[ 3]*m[ 9]-m[ 4]*m[ 8])+m[ 2]*(m[16]*m[ 8]-m[15]*m[ 9])-(m[16]*m[ 3]-m[15]*m[ 4])*m[ 7])-m[ 8]*(m[11]*(m[ 3]*m[ 9]-m[ 4]*m[ 8])+m[ 2]*(m[13]*m[ 8]-m[12]*m[ 9])-(m[13]*m[ 3]-m[12]*m[ 4])*m[ 7])+m[ 1]*((-m[11]*(m[16]*m[ 8]-m[15]*m[ 9]))+m[12]*(m[13]*m[ 8]-m[12]*m[ 9])+(m[12]*m[16]-m[13]*m[15])*m[ 7])-((-m[11]*(m[16]*m[ 3]-m[15]*m[ 4]))+m[12]*(m[13]*m[ 3]-m[12]*m[ 4])+(m[12]*m[16]-m[13]*m[15])*m[ 2])*m[ 6])+m[ 0]*((-m[ 7]*((-m[12]*(m[18]*m[ 8]-m[16]*m[ 9]))+m[13]*(m[16]*m[ 8]-m[15]*m[ 9])+(m[15]*m[18]-m[16]*m[16])*m[ 7]))+m[ 8]*((-m[11]*(m[18]*m[ 8]-m[16]*m[ 9]))+m[13]*(m[13]*m[ 8]-m[12]*m[ 9])+(m[12]*m[18]-m[13]*m[16])*m[ 7])-m[ 9]*((-m[11]*(m[16]*m[ 8]-m[15]*m[ 9]))+m[12]*(m[13]*m[ 8]-m[12]*m[ 9])+(m[12]*m[16]-m[13]*m[15])*m[ 7])+(m[11]*(m[15]*m[18]-m[16]*m[16])-m[12]*(m[12]*m[18]-m[13]*m[16])+m[13]*(m[12]*m[16]-m[13]*m[15]))*m[ 6])-m[ 1]*((-((-m[11]*(m[16]*m[ 3]-m[15]*m[ 4]))+m[12]*(m[13]*m[ 3]-m[12]*m[ 4])+(m[12]*m[16]-m[13]*m[15])*m[ 2])*m[ 9])+((-m[11]*(m[18]*m[ 3]-m[16]*m[ 4]))+m[13]*(m[13]*m[ 3]-m[12]*m[ 4])+(m[12]*m[18]-m[13]*m[16])*m[ 2])*m[ 8]-((-m[12]*(m[18]*m[ 3]-m[16]*m[ 4]))+m[13]*(m[16]*m[ 3]-m[15]*m[ 4])+(m[15]*m[18]-m[16]*m[16])*m[ 2])*m[ 7]+m[ 1]*(m[11]*(m[15]*m[18]-m[16]*m[16])-m[12]*(m[12]*m[18]-m[13]*m[16])+m[13]*(m[12]*m[16]-m[13]*m[15])));
-
-    return m[0]*c[0]+m[1]*c[1]+m[2]*c[2]+m[3]*c[3]+m[4]*c[4]+m[5]*c[5];
+    accum_block33_sym66(Psym66, P_i0, P_j0,
+                        M, M_strideelems0, M_strideelems1, scale);
 }
 
 #define _MUL_CORE(doreset) do {                                         \
@@ -1912,17 +99,20 @@ Test program:
     {                                                                   \
         for(int jout=0; jout<L; jout++)                                 \
         {                                                               \
-            if(doreset) P[iout*P_strideelems0 + jout*P_strideelems1] = 0.0; \
+            double sum = 0.0;                                           \
             for(int k=0; k<M; k++)                                      \
-                P[iout*P_strideelems0 + jout*P_strideelems1] +=         \
+                sum +=                                                  \
                     A[iout*A_strideelems0 + k   *A_strideelems1] *      \
-                    B[k   *B_strideelems0 + jout*B_strideelems1] *      \
-                    scale;                                              \
+                    B[k   *B_strideelems0 + jout*B_strideelems1];       \
+            if(doreset) P[iout*P_strideelems0 + jout*P_strideelems1]  = sum*scale; \
+            else        P[iout*P_strideelems0 + jout*P_strideelems1] += sum*scale; \
         }                                                               \
     }                                                                   \
 } while(0)
 
-// Matrix multiplication. Dimensions (N,L) <- (N,M) * (M,L)
+// Matrix multiplication. Dimensions (N,L) <- (N,M) * (M,L). If the sizes are
+// known at compile time, the fully-unrolled mul_genNM_genML... functions in
+// minimath_generated.h are faster
 __attribute__((unused))
 static
 void mul_genNM_genML(// output
@@ -1949,15 +139,18 @@ void mul_genNM_genML_accum(// output
 }
 #undef _MUL_CORE
 
-// Some common cases into convenient macros
-#define mul_gen23_gen33(P,A,B,scale,ACCUM)  mul_genNM_genML ## ACCUM(P,3,1, 2,3,3, A,3,1, B,3,1, scale)
-#define mul_gen33_gen33(P,A,B,scale,ACCUM)  mul_genNM_genML ## ACCUM(P,3,1, 3,3,3, A,3,1, B,3,1, scale)
-#define mul_gen33t_gen33(P,A,B,scale,ACCUM) mul_genNM_genML ## ACCUM(P,3,1, 3,3,3, A,1,3, B,3,1, scale)
-#define mul_gen33_gen33t(P,A,B,scale,ACCUM) mul_genNM_genML ## ACCUM(P,3,1, 3,3,3, A,3,1, B,1,3, scale)
-#define mul_gen33_vec3(P,A,v,scale,ACCUM)   mul_genNM_genML ## ACCUM(P,1,1, 3,3,1, A,3,1, v,1,1, scale)
-#define mul_gen33t_vec3(P,A,v,scale,ACCUM)  mul_genNM_genML ## ACCUM(P,1,1, 3,3,1, A,1,3, v,1,1, scale)
-#define mul_vec3t_gen33(P,v,A,scale,ACCUM)  mul_genNM_genML ## ACCUM(P,3,1, 1,3,3, v,3,1, A,3,1, scale)
-#define mul_vec3t_gen33t(P,v,A,scale,ACCUM) mul_genNM_genML ## ACCUM(P,3,1, 1,3,3, v,3,1, A,1,3, scale)
+// Some common cases into convenient macros. These use the fully-unrolled
+// fixed-size kernels in minimath_generated.h. ACCUM is either empty or _accum
+#define _MUL_FIXED(vout,vaccum, ...)       vout  (__VA_ARGS__)
+#define _MUL_FIXED_accum(vout,vaccum, ...) vaccum(__VA_ARGS__)
+#define mul_gen23_gen33(P,A,B,scale,ACCUM)  _MUL_FIXED ## ACCUM(mul_gen23_gen33_vout_scaled,  mul_gen23_gen33_vaccum_scaled,  A,B,P,scale)
+#define mul_gen33_gen33(P,A,B,scale,ACCUM)  _MUL_FIXED ## ACCUM(mul_gen33_gen33_vout_scaled,  mul_gen33_gen33_vaccum_scaled,  A,B,P,scale)
+#define mul_gen33t_gen33(P,A,B,scale,ACCUM) _MUL_FIXED ## ACCUM(mul_gen33t_gen33_vout_scaled, mul_gen33t_gen33_vaccum_scaled, A,B,P,scale)
+#define mul_gen33_gen33t(P,A,B,scale,ACCUM) _MUL_FIXED ## ACCUM(mul_gen33_gen33t_vout_scaled, mul_gen33_gen33t_vaccum_scaled, A,B,P,scale)
+#define mul_gen33_vec3(P,A,v,scale,ACCUM)   _MUL_FIXED ## ACCUM(mul_vec3_gen33t_vout_scaled,  mul_vec3_gen33t_vaccum_scaled,  v,A,P,scale)
+#define mul_gen33t_vec3(P,A,v,scale,ACCUM)  _MUL_FIXED ## ACCUM(mul_vec3_gen33_vout_scaled,   mul_vec3_gen33_vaccum_scaled,   v,A,P,scale)
+#define mul_vec3t_gen33(P,v,A,scale,ACCUM)  _MUL_FIXED ## ACCUM(mul_vec3_gen33_vout_scaled,   mul_vec3_gen33_vaccum_scaled,   v,A,P,scale)
+#define mul_vec3t_gen33t(P,v,A,scale,ACCUM) _MUL_FIXED ## ACCUM(mul_vec3_gen33t_vout_scaled,  mul_vec3_gen33t_vaccum_scaled,  v,A,P,scale)
 
 
 __attribute__((unused))
@@ -1985,3 +178,197 @@ static inline void mul_genN6_sym66_scaled_strided(int n,
                                     s,
                                     scale);
 }
+
+
+// OpenMP pragmas, if we're building with -fopenmp. Nothing otherwise
+#ifdef _OPENMP
+#define MINIMATH_OMP(x) _Pragma(#x)
+#else
+#define MINIMATH_OMP(x)
+#endif
+
+// In-place Cholesky factorization S = Ut*U of a packed symmetric NxN matrix, and
+// the solution of S*x = v, for N known only at runtime. v is overwritten by x.
+// Returns 0 if S isn't positive-definite. Used for the reduced systems of the
+// arrowhead solver
+__attribute__((unused))
+static int minimath_chol_solve_symN(int N,
+                                    // input and output
+                                    double* restrict s, double* restrict v)
+{
+#define _IDX(i,j) ((2*N-(i)-1)*(i)/2 + (j))
+    for(int i=0; i<N; i++)
+    {
+        double d = s[_IDX(i,i)];
+        for(int k=0; k<i; k++)
+            d -= s[_IDX(k,i)]*s[_IDX(k,i)];
+        if(d <= 0.0)
+            return 0;
+        d = sqrt(d);
+        s[_IDX(i,i)] = d;
+
+        const double invd = 1.0/d;
+        for(int j=i+1; j<N; j++)
+        {
+            double sum = s[_IDX(i,j)];
+            for(int k=0; k<i; k++)
+                sum -= s[_IDX(k,i)]*s[_IDX(k,j)];
+            s[_IDX(i,j)] = sum*invd;
+        }
+    }
+
+    // Ut*y = v, then U*x = y
+    for(int i=0; i<N; i++)
+    {
+        for(int k=0; k<i; k++)
+            v[i] -= s[_IDX(k,i)]*v[k];
+        v[i] /= s[_IDX(i,i)];
+    }
+    for(int i=N-1; i>=0; i--)
+    {
+        for(int k=i+1; k<N; k++)
+            v[i] -= s[_IDX(i,k)]*v[k];
+        v[i] /= s[_IDX(i,i)];
+    }
+#undef _IDX
+    return 1;
+}
+
+// Arrowhead (bundle-adjustment-shaped) systems:
+//
+//   [ U   W  ] [xc]   [bc]
+//   [ Wt  V  ] [xp] = [bp]
+//
+// U is block-diagonal, with a packed sym66 block for each of Ncams cameras. V is
+// block-diagonal, with a packed sym33 block for each of Npoints points. W is
+// block-sparse: each observation k of a point by a camera contributes a general
+// 6x3 block W[18*k .. 18*k+17] at (camera obs_cam[k], point). The observations
+// are grouped by point: those of point p are point_obs_start[p] ..
+// point_obs_start[p+1]-1.
+//
+// The point blocks are eliminated: xc is the solution of the reduced camera
+// system (U - W V^-1 Wt) xc = bc - W V^-1 bp, and then xp = V^-1 (bp - Wt xc).
+// The point-block inversions and the back-substitution are independent for each
+// point, and the reduced system is accumulated with a reduction across points.
+// All these run in parallel across points if built with -fopenmp. The reduced
+// system is solved with a dense Cholesky factorization, so this is meant for
+// few cameras, and any number of points
+//
+// The caller provides the workspace: arrowhead_sym66_sym33_workspace_size()
+// doubles. Returns 0 if a point block is singular or the reduced system isn't
+// positive-definite
+__attribute__((unused))
+static inline int arrowhead_sym66_sym33_workspace_size(int Ncams, int Npoints, int Nobs)
+{
+    const int Nc = 6*Ncams;
+    return Nc*(Nc+1)/2 + 6*Npoints + 3*Npoints + 18*Nobs;
+}
+__attribute__((unused))
+static int solve_arrowhead_sym66_sym33(// output
+                                       double* restrict xc, double* restrict xp,
+                                       // workspace
+                                       double* restrict work,
+                                       // input
+                                       int Ncams, int Npoints,
+                                       const double* restrict U, const double* restrict V,
+                                       const int* restrict point_obs_start, const int* restrict obs_cam,
+                                       const double* restrict W,
+                                       const double* restrict bc, const double* restrict bp)
+{
+    const int Nc   = 6*Ncams;
+    const int Ns   = Nc*(Nc+1)/2;
+#define _IDX(i,j) ((2*Nc-(i)-1)*(i)/2 + (j))
+
+    double* restrict S    = work;                 // reduced system, packed
+    double* restrict Vinv = &S[Ns];               // sym33 for each point
+    double* restrict ep   = &Vinv[6*Npoints];     // V^-1 bp for each point
+    double* restrict Y    = &ep[3*Npoints];       // W V^-1 for each observation
+
+    // Invert the point blocks
+    int ok = 1;
+    MINIMATH_OMP(omp parallel for reduction(&&:ok))
+    for(int p=0; p<Npoints; p++)
+    {
+        if(inverse_sym3_robust(&V[6*p], &Vinv[6*p], 1e-12) == 0.0)
+        {
+            ok = 0;
+            continue;
+        }
+        mul_vec3_sym33_vout(&bp[3*p], &Vinv[6*p], &ep[3*p]);
+        for(int k=point_obs_start[p]; k<point_obs_start[p+1]; k++)
+            mul_genN3_sym33_vout(6, &W[18*k], &Vinv[6*p], &Y[18*k]);
+    }
+    if(!ok)
+        return 0;
+
+    // The reduced system. S starts with U on the block diagonal, and xc with bc.
+    // Then I subtract the contribution of each point
+    for(int i=0; i<Ns; i++) S[i] = 0.0;
+    for(int c=0; c<Ncams; c++)
+        for(int i=0; i<6; i++)
+            for(int j=i; j<6; j++)
+                S[_IDX(6*c+i, 6*c+j)] = U[21*c + index_sym66_assume_upper(i,j)];
+    for(int i=0; i<Nc; i++) xc[i] = bc[i];
+
+    MINIMATH_OMP(omp parallel for reduction(+:S[:Ns]) reduction(+:xc[:Nc]))
+    for(int p=0; p<Npoints; p++)
+    {
+        for(int a=point_obs_start[p]; a<point_obs_start[p+1]; a++)
+        {
+            const int ca = obs_cam[a];
+            double t[21], t6[6];
+
+            // xc -= W V^-1 bp
+            mul_vec3_gen63t_vout(&ep[3*p], &W[18*a], t6);
+            for(int i=0; i<6; i++) xc[6*ca + i] -= t6[i];
+
+            // diagonal block: W V^-1 Wt
+            mul_gen63_sym33_gen63t_vout(&W[18*a], &Vinv[6*p], t);
+            for(int i=0; i<6; i++)
+                for(int j=i; j<6; j++)
+                    S[_IDX(6*ca+i, 6*ca+j)] -= t[index_sym66_assume_upper(i,j)];
+
+            // off-diagonal blocks: Y_a Wt_b. If both observations come from
+            // the same camera, this is a diagonal block, and the products
+            // for (a,b) and (b,a) are both added
+            for(int b=a+1; b<point_obs_start[p+1]; b++)
+            {
+                const int cb = obs_cam[b];
+                double T[36];
+                mul_gen63_gen63t_vout(&Y[18*a], &W[18*b], T);
+                if(ca < cb)
+                    for(int i=0; i<6; i++)
+                        for(int j=0; j<6; j++)
+                            S[_IDX(6*ca+i, 6*cb+j)] -= T[i*6 + j];
+                else if(ca > cb)
+                    for(int i=0; i<6; i++)
+                        for(int j=0; j<6; j++)
+                            S[_IDX(6*cb+j, 6*ca+i)] -= T[i*6 + j];
+                else
+                    for(int i=0; i<6; i++)
+                        for(int j=i; j<6; j++)
+                            S[_IDX(6*ca+i, 6*ca+j)] -= T[i*6 + j] + T[j*6 + i];
+            }
+        }
+    }
+#undef _IDX
+
+    if(!minimath_chol_solve_symN(Nc, S, xc))
+        return 0;
+
+    // Back-substitution: xp = V^-1 (bp - Wt xc)
+    MINIMATH_OMP(omp parallel for)
+    for(int p=0; p<Npoints; p++)
+    {
+        double r[3] = {bp[3*p + 0], bp[3*p + 1], bp[3*p + 2]};
+        for(int k=point_obs_start[p]; k<point_obs_start[p+1]; k++)
+        {
+            double t3[3];
+            mul_vec6_gen63_vout(&xc[6*obs_cam[k]], &W[18*k], t3);
+            for(int i=0; i<3; i++) r[i] -= t3[i];
+        }
+        mul_vec3_sym33_vout(r, &Vinv[6*p], &xp[3*p]);
+    }
+
+    return 1;
+}
@@ -0,0 +1,376 @@
+// THIS IS AUTO-GENERATED BY ./minimath_generate.pl FROM minimath-extra.h. DO NOT EDIT BY HAND
+
+#pragma once
+
+// Extra functions I'm using in mrcal. I'm going to replace this whole library
+// eventually, to make things nicer. These new functions will be a part of the
+// replacement, and I'm not going to be thorough and I'm not going to add tests
+// until I do that.
+
+#include "minimath_f.h"
+
+
+// Upper triangle is stored, in the usual row-major order. These are lookups in
+// the minimath_index_symNN tables from minimath_generated.h: no branches, and
+// the compiler folds them away when i,j are known
+__attribute__((unused))
+static inline
+int index_sym33_f(int i, int j)
+{
+    return minimath_index_sym33[i*3 + j];
+}
+__attribute__((unused))
+static inline
+int index_sym33_assume_upper_f(int i, int j)
+{
+    return minimath_index_sym33[i*3 + j];
+}
+
+// Upper triangle is stored, in the usual row-major order.
+__attribute__((unused))
+static inline
+int index_sym66_f(int i, int j)
+{
+    return minimath_index_sym66[i*6 + j];
+}
+__attribute__((unused))
+static inline
+int index_sym66_assume_upper_f(int i, int j)
+{
+    return minimath_index_sym66[i*6 + j];
+}
+// The 3x3-block-in-sym66 helpers. These are wrappers around the unrolled
+// block kernels in minimath_generated.h, which are available for other block
+// and matrix sizes also
+__attribute__((unused))
+static inline
+void mul_gen33_gen33insym66_f(// output
+                            float* restrict P, int P_strideelems0, int P_strideelems1,
+                            // input
+                            const float* A, int A_strideelems0, int A_strideelems1,
+                            const float* Bsym66, int B_i0, int B_j0,
+                            const float scale)
+{
+    mul_gen33_block33_sym66_f(P, P_strideelems0, P_strideelems1,
+                            A, A_strideelems0, A_strideelems1,
+                            Bsym66, B_i0, B_j0, scale);
+}
+// Assumes the output is symmetric, and only computes the upper triangle. To
+// accumulate normal equations from whole rows of a Jacobian, the unrolled
+// normal_accum_genK6() in minimath_generated.h is much faster
+__attribute__((unused))
+static inline
+void mul_gen33_gen33_into33insym66_accum_f(// output
+                                         float* restrict Psym66, int P_i0, int P_j0,
+                                         // input
+                                         const float* A, int A_strideelems0, int A_strideelems1,
+                                         const float* B, int B_strideelems0, int B_strideelems1,
+                                         const float scale)
+{
+    mul_gen33_gen33_accum_block33_sym66_f(Psym66, P_i0, P_j0,
+                                        A, A_strideelems0, A_strideelems1,
+                                        B, B_strideelems0, B_strideelems1,
+                                        scale);
+}
+__attribute__((unused))
+static inline
+void set_gen33_from_gen33insym66_f(// output
+                                 float* restrict P, int P_strideelems0, int P_strideelems1,
+                                 // input
+                                 const float* Msym66, int M_i0, int M_j0,
+                                 const float scale)
+{
+    get_block33_sym66_f(P, P_strideelems0, P_strideelems1,
+                      Msym66, M_i0, M_j0, scale);
+}
+// Assumes the output is symmetric, and only computes the upper triangle
+__attribute__((unused))
+static inline
+void set_33insym66_from_gen33_accum_f(// output
+                                    float* restrict Psym66, int P_i0, int P_j0,
+                                    // input
+                                    const float* M, int M_strideelems0, int M_strideelems1,
+                                    const float scale)
+{
+    accum_block33_sym66_f(Psym66, P_i0, P_j0,
+                        M, M_strideelems0, M_strideelems1, scale);
+}
+
+#define _MUL_CORE_f(doreset) do {                                         \
+    for(int iout=0; iout<N; iout++)                                     \
+    {                                                                   \
+        for(int jout=0; jout<L; jout++)                                 \
+        {                                                               \
+            float sum = 0.0f;                                           \
+            for(int k=0; k<M; k++)                                      \
+                sum +=                                                  \
+                    A[iout*A_strideelems0 + k   *A_strideelems1] *      \
+                    B[k   *B_strideelems0 + jout*B_strideelems1];       \
+            if(doreset) P[iout*P_strideelems0 + jout*P_strideelems1]  = sum*scale; \
+            else        P[iout*P_strideelems0 + jout*P_strideelems1] += sum*scale; \
+        }                                                               \
+    }                                                                   \
+} while(0)
+
+// Matrix multiplication. Dimensions (N,L) <- (N,M) * (M,L). If the sizes are
+// known at compile time, the fully-unrolled mul_genNM_genML_f... functions in
+// minimath_generated.h are faster
+__attribute__((unused))
+static
+void mul_genNM_genML_f(// output
+                     float* restrict P, int P_strideelems0, int P_strideelems1,
+                     // input
+                     int N, int M, int L,
+                     const float* restrict A, int A_strideelems0, int A_strideelems1,
+                     const float* restrict B, int B_strideelems0, int B_strideelems1,
+                     const float scale)
+{
+    _MUL_CORE_f(1);
+}
+__attribute__((unused))
+static
+void mul_genNM_genML_accum_f(// output
+                           float* restrict P, int P_strideelems0, int P_strideelems1,
+                           // input
+                           int N, int M, int L,
+                           const float* restrict A, int A_strideelems0, int A_strideelems1,
+                           const float* restrict B, int B_strideelems0, int B_strideelems1,
+                           const float scale)
+{
+    _MUL_CORE_f(0);
+}
+#undef _MUL_CORE_f
+
+// Some common cases into convenient macros. These use the fully-unrolled
+// fixed-size kernels in minimath_generated.h. ACCUM is either empty or _accum
+#define _MUL_FIXED_f(vout,vaccum, ...)       vout  (__VA_ARGS__)
+#define _MUL_FIXED_accum_f(vout,vaccum, ...) vaccum(__VA_ARGS__)
+#define mul_gen23_gen33_f(P,A,B,scale,ACCUM)  _MUL_FIXED ## ACCUM ## _f(mul_gen23_gen33_vout_scaled_f,  mul_gen23_gen33_vaccum_scaled_f,  A,B,P,scale)
+#define mul_gen33_gen33_f(P,A,B,scale,ACCUM)  _MUL_FIXED ## ACCUM ## _f(mul_gen33_gen33_vout_scaled_f,  mul_gen33_gen33_vaccum_scaled_f,  A,B,P,scale)
+#define mul_gen33t_gen33_f(P,A,B,scale,ACCUM) _MUL_FIXED ## ACCUM ## _f(mul_gen33t_gen33_vout_scaled_f, mul_gen33t_gen33_vaccum_scaled_f, A,B,P,scale)
+#define mul_gen33_gen33t_f(P,A,B,scale,ACCUM) _MUL_FIXED ## ACCUM ## _f(mul_gen33_gen33t_vout_scaled_f, mul_gen33_gen33t_vaccum_scaled_f, A,B,P,scale)
+#define mul_gen33_vec3_f(P,A,v,scale,ACCUM)   _MUL_FIXED ## ACCUM ## _f(mul_vec3_gen33t_vout_scaled_f,  mul_vec3_gen33t_vaccum_scaled_f,  v,A,P,scale)
+#define mul_gen33t_vec3_f(P,A,v,scale,ACCUM)  _MUL_FIXED ## ACCUM ## _f(mul_vec3_gen33_vout_scaled_f,   mul_vec3_gen33_vaccum_scaled_f,   v,A,P,scale)
+#define mul_vec3t_gen33_f(P,v,A,scale,ACCUM)  _MUL_FIXED ## ACCUM ## _f(mul_vec3_gen33_vout_scaled_f,   mul_vec3_gen33_vaccum_scaled_f,   v,A,P,scale)
+#define mul_vec3t_gen33t_f(P,v,A,scale,ACCUM) _MUL_FIXED ## ACCUM ## _f(mul_vec3_gen33t_vout_scaled_f,  mul_vec3_gen33t_vaccum_scaled_f,  v,A,P,scale)
+
+
+__attribute__((unused))
+static inline void mul_vec6_sym66_scaled_strided_f(float* restrict v, int v_strideelems,
+                                                 const float* restrict s,
+                                                 const float scale)
+{
+  float t[5] = {v[0*v_strideelems], v[1*v_strideelems], v[2*v_strideelems], v[3*v_strideelems], v[4*v_strideelems]};
+  v[0*v_strideelems] = (s[0]*t[0] + s[1]*t[1] + s[2]*t[2] + s[3]*t[3] + s[4]*t[4] + s[5]*v[5*v_strideelems]) * scale;
+  v[1*v_strideelems] = (s[1]*t[0] + s[6]*t[1] + s[7]*t[2] + s[8]*t[3] + s[9]*t[4] + s[10]*v[5*v_strideelems]) * scale;
+  v[2*v_strideelems] = (s[2]*t[0] + s[7]*t[1] + s[11]*t[2] + s[12]*t[3] + s[13]*t[4] + s[14]*v[5*v_strideelems]) * scale;
+  v[3*v_strideelems] = (s[3]*t[0] + s[8]*t[1] + s[12]*t[2] + s[15]*t[3] + s[16]*t[4] + s[17]*v[5*v_strideelems]) * scale;
+  v[4*v_strideelems] = (s[4]*t[0] + s[9]*t[1] + s[13]*t[2] + s[16]*t[3] + s[18]*t[4] + s[19]*v[5*v_strideelems]) * scale;
+  v[5*v_strideelems] = (s[5]*t[0] + s[10]*t[1] + s[14]*t[2] + s[17]*t[3] + s[19]*t[4] + s[20]*v[5*v_strideelems]) * scale;
+}
+
+__attribute__((unused))
+static inline void mul_genN6_sym66_scaled_strided_f(int n,
+                                                  float* restrict v, int v_strideelems0, int v_strideelems1,
+                                                  const float* restrict s,
+                                                  const float scale)
+{
+  for(int i=0; i<n; i++)
+      mul_vec6_sym66_scaled_strided_f(v + v_strideelems0*i, v_strideelems1,
+                                    s,
+                                    scale);
+}
+
+
+// OpenMP pragmas, if we're building with -fopenmp. Nothing otherwise
+#ifdef _OPENMP
+#define MINIMATH_OMP_f(x) _Pragma(#x)
+#else
+#define MINIMATH_OMP_f(x)
+#endif
+
+// In-place Cholesky factorization S = Ut*U of a packed symmetric NxN matrix, and
+// the solution of S*x = v, for N known only at runtime. v is overwritten by x.
+// Returns 0 if S isn't positive-definite. Used for the reduced systems of the
+// arrowhead solver
+__attribute__((unused))
+static int minimath_chol_solve_symN_f(int N,
+                                    // input and output
+                                    float* restrict s, float* restrict v)
+{
+#define _IDX_f(i,j) ((2*N-(i)-1)*(i)/2 + (j))
+    for(int i=0; i<N; i++)
+    {
+        float d = s[_IDX_f(i,i)];
+        for(int k=0; k<i; k++)
+            d -= s[_IDX_f(k,i)]*s[_IDX_f(k,i)];
+        if(d <= 0.0f)
+            return 0;
+        d = sqrtf(d);
+        s[_IDX_f(i,i)] = d;
+
+        const float invd = 1.0f/d;
+        for(int j=i+1; j<N; j++)
+        {
+            float sum = s[_IDX_f(i,j)];
+            for(int k=0; k<i; k++)
+                sum -= s[_IDX_f(k,i)]*s[_IDX_f(k,j)];
+            s[_IDX_f(i,j)] = sum*invd;
+        }
+    }
+
+    // Ut*y = v, then U*x = y
+    for(int i=0; i<N; i++)
+    {
+        for(int k=0; k<i; k++)
+            v[i] -= s[_IDX_f(k,i)]*v[k];
+        v[i] /= s[_IDX_f(i,i)];
+    }
+    for(int i=N-1; i>=0; i--)
+    {
+        for(int k=i+1; k<N; k++)
+            v[i] -= s[_IDX_f(i,k)]*v[k];
+        v[i] /= s[_IDX_f(i,i)];
+    }
+#undef _IDX_f
+    return 1;
+}
+
+// Arrowhead (bundle-adjustment-shaped) systems:
+//
+//   [ U   W  ] [xc]   [bc]
+//   [ Wt  V  ] [xp] = [bp]
+//
+// U is block-diagonal, with a packed sym66 block for each of Ncams cameras. V is
+// block-diagonal, with a packed sym33 block for each of Npoints points. W is
+// block-sparse: each observation k of a point by a camera contributes a general
+// 6x3 block W[18*k .. 18*k+17] at (camera obs_cam[k], point). The observations
+// are grouped by point: those of point p are point_obs_start[p] ..
+// point_obs_start[p+1]-1.f
+//
+// The point blocks are eliminated: xc is the solution of the reduced camera
+// system (U - W V^-1 Wt) xc = bc - W V^-1 bp, and then xp = V^-1 (bp - Wt xc).
+// The point-block inversions and the back-substitution are independent for each
+// point, and the reduced system is accumulated with a reduction across points.
+// All these run in parallel across points if built with -fopenmp. The reduced
+// system is solved with a dense Cholesky factorization, so this is meant for
+// few cameras, and any number of points
+//
+// The caller provides the workspace: arrowhead_sym66_sym33_workspace_size_f()
+// doubles. Returns 0 if a point block is singular or the reduced system isn't
+// positive-definite
+__attribute__((unused))
+static inline int arrowhead_sym66_sym33_workspace_size_f(int Ncams, int Npoints, int Nobs)
+{
+    const int Nc = 6*Ncams;
+    return Nc*(Nc+1)/2 + 6*Npoints + 3*Npoints + 18*Nobs;
+}
+__attribute__((unused))
+static int solve_arrowhead_sym66_sym33_f(// output
+                                       float* restrict xc, float* restrict xp,
+                                       // workspace
+                                       float* restrict work,
+                                       // input
+                                       int Ncams, int Npoints,
+                                       const float* restrict U, const float* restrict V,
+                                       const int* restrict point_obs_start, const int* restrict obs_cam,
+                                       const float* restrict W,
+                                       const float* restrict bc, const float* restrict bp)
+{
+    const int Nc   = 6*Ncams;
+    const int Ns   = Nc*(Nc+1)/2;
+#define _IDX_f(i,j) ((2*Nc-(i)-1)*(i)/2 + (j))
+
+    float* restrict S    = work;                 // reduced system, packed
+    float* restrict Vinv = &S[Ns];               // sym33 for each point
+    float* restrict ep   = &Vinv[6*Npoints];     // V^-1 bp for each point
+    float* restrict Y    = &ep[3*Npoints];       // W V^-1 for each observation
+
+    // Invert the point blocks
+    int ok = 1;
+    MINIMATH_OMP_f(omp parallel for reduction(&&:ok))
+    for(int p=0; p<Npoints; p++)
+    {
+        if(inverse_sym3_robust_f(&V[6*p], &Vinv[6*p], 1e-12) == 0.0f)
+        {
+            ok = 0;
+            continue;
+        }
+        mul_vec3_sym33_vout_f(&bp[3*p], &Vinv[6*p], &ep[3*p]);
+        for(int k=point_obs_start[p]; k<point_obs_start[p+1]; k++)
+            mul_genN3_sym33_vout_f(6, &W[18*k], &Vinv[6*p], &Y[18*k]);
+    }
+    if(!ok)
+        return 0;
+
+    // The reduced system. S starts with U on the block diagonal, and xc with bc.
+    // Then I subtract the contribution of each point
+    for(int i=0; i<Ns; i++) S[i] = 0.0f;
+    for(int c=0; c<Ncams; c++)
+        for(int i=0; i<6; i++)
+            for(int j=i; j<6; j++)
+                S[_IDX_f(6*c+i, 6*c+j)] = U[21*c + index_sym66_assume_upper_f(i,j)];
+    for(int i=0; i<Nc; i++) xc[i] = bc[i];
+
+    MINIMATH_OMP_f(omp parallel for reduction(+:S[:Ns]) reduction(+:xc[:Nc]))
+    for(int p=0; p<Npoints; p++)
+    {
+        for(int a=point_obs_start[p]; a<point_obs_start[p+1]; a++)
+        {
+            const int ca = obs_cam[a];
+            float t[21], t6[6];
+
+            // xc -= W V^-1 bp
+            mul_vec3_gen63t_vout_f(&ep[3*p], &W[18*a], t6);
+            for(int i=0; i<6; i++) xc[6*ca + i] -= t6[i];
+
+            // diagonal block: W V^-1 Wt
+            mul_gen63_sym33_gen63t_vout_f(&W[18*a], &Vinv[6*p], t);
+            for(int i=0; i<6; i++)
+                for(int j=i; j<6; j++)
+                    S[_IDX_f(6*ca+i, 6*ca+j)] -= t[index_sym66_assume_upper_f(i,j)];
+
+            // off-diagonal blocks: Y_a Wt_b. If both observations come from
+            // the same camera, this is a diagonal block, and the products
+            // for (a,b) and (b,a) are both added
+            for(int b=a+1; b<point_obs_start[p+1]; b++)
+            {
+                const int cb = obs_cam[b];
+                float T[36];
+                mul_gen63_gen63t_vout_f(&Y[18*a], &W[18*b], T);
+                if(ca < cb)
+                    for(int i=0; i<6; i++)
+                        for(int j=0; j<6; j++)
+                            S[_IDX_f(6*ca+i, 6*cb+j)] -= T[i*6 + j];
+                else if(ca > cb)
+                    for(int i=0; i<6; i++)
+                        for(int j=0; j<6; j++)
+                            S[_IDX_f(6*cb+j, 6*ca+i)] -= T[i*6 + j];
+                else
+                    for(int i=0; i<6; i++)
+                        for(int j=i; j<6; j++)
+                            S[_IDX_f(6*ca+i, 6*ca+j)] -= T[i*6 + j] + T[j*6 + i];
+            }
+        }
+    }
+#undef _IDX_f
+
+    if(!minimath_chol_solve_symN_f(Nc, S, xc))
+        return 0;
+
+    // Back-substitution: xp = V^-1 (bp - Wt xc)
+    MINIMATH_OMP_f(omp parallel for)
+    for(int p=0; p<Npoints; p++)
+    {
+        float r[3] = {bp[3*p + 0], bp[3*p + 1], bp[3*p + 2]};
+        for(int k=point_obs_start[p]; k<point_obs_start[p+1]; k++)
+        {
+            float t3[3];
+            mul_vec6_gen63_vout_f(&xc[6*obs_cam[k]], &W[18*k], t3);
+            for(int i=0; i<3; i++) r[i] -= t3[i];
+        }
+        mul_vec3_sym33_vout_f(r, &Vinv[6*p], &xp[3*p]);
+    }
+
+    return 1;
+}
@@ -5,6 +5,9 @@
 #endif
 
 
+#include <math.h>
+#include <stddef.h>
+
 #include "minimath_generated.h"
 
 // In all the following computations I use the expression obtained before a
@@ -174,192 +177,10 @@ Session:
 (%o65) matrix([m3*m5-m4^2,m2*m4-m1*m5,m1*m4-m2*m3],
               [m2*m4-m1*m5,m0*m5-m2^2,m1*m2-m0*m4],
               [m1*m4-m2*m3,m1*m2-m0*m4,m0*m3-m1^2])
-(%i66) num( ev(invert(sym4),detout) );
-
-(%o66) matrix([m4*(m7*m9-m8^2)-m5*(m5*m9-m6*m8)+m6*(m5*m8-m6*m7),
-               -m1*(m7*m9-m8^2)+m2*(m5*m9-m6*m8)-m3*(m5*m8-m6*m7),
-               m1*(m5*m9-m6*m8)-m2*(m4*m9-m6^2)+m3*(m4*m8-m5*m6),
-               -m1*(m5*m8-m6*m7)+m2*(m4*m8-m5*m6)-m3*(m4*m7-m5^2)],
-              [-m1*(m7*m9-m8^2)+m5*(m2*m9-m3*m8)-m6*(m2*m8-m3*m7),
-               m0*(m7*m9-m8^2)-m2*(m2*m9-m3*m8)+m3*(m2*m8-m3*m7),
-               -m0*(m5*m9-m6*m8)+m2*(m1*m9-m3*m6)-m3*(m1*m8-m3*m5),
-               m0*(m5*m8-m6*m7)-m2*(m1*m8-m2*m6)+m3*(m1*m7-m2*m5)],
-              [m1*(m5*m9-m6*m8)-m4*(m2*m9-m3*m8)+m6*(m2*m6-m3*m5),
-               -m0*(m5*m9-m6*m8)+m1*(m2*m9-m3*m8)-m3*(m2*m6-m3*m5),
-               m0*(m4*m9-m6^2)-m1*(m1*m9-m3*m6)+m3*(m1*m6-m3*m4),
-               -m0*(m4*m8-m5*m6)+m1*(m1*m8-m2*m6)-m3*(m1*m5-m2*m4)],
-              [-m1*(m5*m8-m6*m7)+m4*(m2*m8-m3*m7)-m5*(m2*m6-m3*m5),
-               m0*(m5*m8-m6*m7)-m1*(m2*m8-m3*m7)+m2*(m2*m6-m3*m5),
-               -m0*(m4*m8-m5*m6)+m1*(m1*m8-m3*m5)-m2*(m1*m6-m3*m4),
-               m0*(m4*m7-m5^2)-m1*(m1*m7-m2*m5)+m2*(m1*m5-m2*m4)])
-(%i103) num( ev(invert(sym5),detout) );
-
-(%o103) matrix([m7*(-(m14*m7-m13*m8)*m9+m11*(m11*m7-m10*m8)
-                                       +(m10*m14-m11*m13)*m6)
-                 -m8*(-(m13*m7-m12*m8)*m9+m10*(m11*m7-m10*m8)
-                                         +(m10*m13-m11*m12)*m6)
-                 +m5*((m12*m14-m13^2)*m9-m10*(m10*m14-m11*m13)
-                                        +m11*(m10*m13-m11*m12))
-                 -m6*(-m10*(m14*m7-m13*m8)+m11*(m13*m7-m12*m8)
-                                          +(m12*m14-m13^2)*m6),
-                -m3*(-(m14*m7-m13*m8)*m9+m11*(m11*m7-m10*m8)
-                                        +(m10*m14-m11*m13)*m6)
-                 +m4*(-(m13*m7-m12*m8)*m9+m10*(m11*m7-m10*m8)
-                                         +(m10*m13-m11*m12)*m6)
-                 -m1*((m12*m14-m13^2)*m9-m10*(m10*m14-m11*m13)
-                                        +m11*(m10*m13-m11*m12))
-                 +m2*(-m10*(m14*m7-m13*m8)+m11*(m13*m7-m12*m8)
-                                          +(m12*m14-m13^2)*m6),
-                -m2*(-m7*(m14*m7-m13*m8)+m8*(m13*m7-m12*m8)
-                                        +(m12*m14-m13^2)*m5)
-                 +m3*(-m6*(m14*m7-m13*m8)+m8*(m11*m7-m10*m8)
-                                         +(m10*m14-m11*m13)*m5)
-                 -m4*(-m6*(m13*m7-m12*m8)+m7*(m11*m7-m10*m8)
-                                         +(m10*m13-m11*m12)*m5)
-                 +m1*((m10*m13-m11*m12)*m8-(m10*m14-m11*m13)*m7
-                                          +(m12*m14-m13^2)*m6),
-                -m3*(m8*(m11*m6-m8*m9)+m5*(m14*m9-m11^2)-m6*(m14*m6-m11*m8))
-                 +m4*(m7*(m11*m6-m8*m9)+m5*(m13*m9-m10*m11)
-                                       -m6*(m13*m6-m10*m8))
-                 -m1*(-m7*(m14*m9-m11^2)+m8*(m13*m9-m10*m11)
-                                        +(m10*m14-m11*m13)*m6)
-                 +m2*(-m7*(m14*m6-m11*m8)+m8*(m13*m6-m10*m8)
-                                         +(m10*m14-m11*m13)*m5),
-                m3*(m8*(m10*m6-m7*m9)+m5*(m13*m9-m10*m11)-m6*(m13*m6-m11*m7))
-                 -m4*(m7*(m10*m6-m7*m9)+m5*(m12*m9-m10^2)-m6*(m12*m6-m10*m7))
-                 +m1*(-m7*(m13*m9-m10*m11)+m8*(m12*m9-m10^2)
-                                          +(m10*m13-m11*m12)*m6)
-                 -m2*((m12*m6-m10*m7)*m8-m7*(m13*m6-m11*m7)
-                                        +(m10*m13-m11*m12)*m5)],
-               [-m7*(-(m14*m3-m13*m4)*m9+m11*(m11*m3-m10*m4)
-                                        +(m10*m14-m11*m13)*m2)
-                 +m8*(-(m13*m3-m12*m4)*m9+m10*(m11*m3-m10*m4)
-                                         +(m10*m13-m11*m12)*m2)
-                 -m1*((m12*m14-m13^2)*m9-m10*(m10*m14-m11*m13)
-                                        +m11*(m10*m13-m11*m12))
-                 +(-m10*(m14*m3-m13*m4)+m11*(m13*m3-m12*m4)
-                                       +(m12*m14-m13^2)*m2)
-                  *m6,
-                m3*(-(m14*m3-m13*m4)*m9+m11*(m11*m3-m10*m4)
-                                       +(m10*m14-m11*m13)*m2)
-                 -m4*(-(m13*m3-m12*m4)*m9+m10*(m11*m3-m10*m4)
-                                         +(m10*m13-m11*m12)*m2)
-                 +m0*((m12*m14-m13^2)*m9-m10*(m10*m14-m11*m13)
-                                        +m11*(m10*m13-m11*m12))
-                 -m2*(-m10*(m14*m3-m13*m4)+m11*(m13*m3-m12*m4)
-                                          +(m12*m14-m13^2)*m2),
-                m2*((m13*m3-m12*m4)*m8-(m14*m3-m13*m4)*m7+m1*(m12*m14-m13^2))
-                 -m3*((m11*m3-m10*m4)*m8-(m14*m3-m13*m4)*m6
-                                        +m1*(m10*m14-m11*m13))
-                 -m0*((m10*m13-m11*m12)*m8-(m10*m14-m11*m13)*m7
-                                          +(m12*m14-m13^2)*m6)
-                 +m4*((m11*m3-m10*m4)*m7-(m13*m3-m12*m4)*m6
-                                        +m1*(m10*m13-m11*m12)),
-                m3*(m8*(m11*m2-m4*m9)+m1*(m14*m9-m11^2)-(m14*m2-m11*m4)*m6)
-                 -m4*(m7*(m11*m2-m4*m9)+m1*(m13*m9-m10*m11)
-                                       -(m13*m2-m10*m4)*m6)
-                 +m0*(-m7*(m14*m9-m11^2)+m8*(m13*m9-m10*m11)
-                                        +(m10*m14-m11*m13)*m6)
-                 -m2*((m13*m2-m10*m4)*m8-(m14*m2-m11*m4)*m7
-                                        +m1*(m10*m14-m11*m13)),
-                -m3*(m8*(m10*m2-m3*m9)+m1*(m13*m9-m10*m11)-(m13*m2-m11*m3)*m6)
-                 +m4*(m7*(m10*m2-m3*m9)+m1*(m12*m9-m10^2)-(m12*m2-m10*m3)*m6)
-                 -m0*(-m7*(m13*m9-m10*m11)+m8*(m12*m9-m10^2)
-                                          +(m10*m13-m11*m12)*m6)
-                 +m2*((m12*m2-m10*m3)*m8-(m13*m2-m11*m3)*m7
-                                        +m1*(m10*m13-m11*m12))],
-               [m7*(m11*(m3*m8-m4*m7)+m2*(m14*m7-m13*m8)-(m14*m3-m13*m4)*m6)
-                 -m8*(m10*(m3*m8-m4*m7)+m2*(m13*m7-m12*m8)-(m13*m3-m12*m4)*m6)
-                 +m1*(-m10*(m14*m7-m13*m8)+m11*(m13*m7-m12*m8)
-                                          +(m12*m14-m13^2)*m6)
-                 -(-m10*(m14*m3-m13*m4)+m11*(m13*m3-m12*m4)
-                                       +(m12*m14-m13^2)*m2)
-                  *m5,
-                -m3*(m11*(m3*m8-m4*m7)+m2*(m14*m7-m13*m8)-(m14*m3-m13*m4)*m6)
-                 +m4*(m10*(m3*m8-m4*m7)+m2*(m13*m7-m12*m8)-(m13*m3-m12*m4)*m6)
-                 -m0*(-m10*(m14*m7-m13*m8)+m11*(m13*m7-m12*m8)
-                                          +(m12*m14-m13^2)*m6)
-                 +m1*(-m10*(m14*m3-m13*m4)+m11*(m13*m3-m12*m4)
-                                          +(m12*m14-m13^2)*m2),
-                m3*(m8*(m3*m8-m4*m7)+m1*(m14*m7-m13*m8)-(m14*m3-m13*m4)*m5)
-                 -m4*(m7*(m3*m8-m4*m7)+m1*(m13*m7-m12*m8)-(m13*m3-m12*m4)*m5)
-                 +m0*(-m7*(m14*m7-m13*m8)+m8*(m13*m7-m12*m8)
-                                         +(m12*m14-m13^2)*m5)
-                 -m1*((m13*m3-m12*m4)*m8-(m14*m3-m13*m4)*m7
-                                        +m1*(m12*m14-m13^2)),
-                -m3*(m8*(m2*m8-m4*m6)+m1*(m14*m6-m11*m8)-(m14*m2-m11*m4)*m5)
-                 +m4*(m7*(m2*m8-m4*m6)+m1*(m13*m6-m10*m8)-(m13*m2-m10*m4)*m5)
-                 -m0*(-m7*(m14*m6-m11*m8)+m8*(m13*m6-m10*m8)
-                                         +(m10*m14-m11*m13)*m5)
-                 +m1*((m13*m2-m10*m4)*m8-(m14*m2-m11*m4)*m7
-                                        +m1*(m10*m14-m11*m13)),
-                m3*((m2*m7-m3*m6)*m8+m1*(m13*m6-m11*m7)-(m13*m2-m11*m3)*m5)
-                 +m0*((m12*m6-m10*m7)*m8-m7*(m13*m6-m11*m7)
-                                        +(m10*m13-m11*m12)*m5)
-                 -m1*((m12*m2-m10*m3)*m8-(m13*m2-m11*m3)*m7
-                                        +m1*(m10*m13-m11*m12))
-                 -m4*(m7*(m2*m7-m3*m6)+m1*(m12*m6-m10*m7)
-                                      -(m12*m2-m10*m3)*m5)],
-               [m8*((m3*m8-m4*m7)*m9+m2*(m11*m7-m10*m8)-(m11*m3-m10*m4)*m6)
-                 -m1*(-(m14*m7-m13*m8)*m9+m11*(m11*m7-m10*m8)
-                                         +(m10*m14-m11*m13)*m6)
-                 +m5*(-(m14*m3-m13*m4)*m9+m11*(m11*m3-m10*m4)
-                                         +(m10*m14-m11*m13)*m2)
-                 -m6*(m11*(m3*m8-m4*m7)+m2*(m14*m7-m13*m8)
-                                       -(m14*m3-m13*m4)*m6),
-                -m4*((m3*m8-m4*m7)*m9+m2*(m11*m7-m10*m8)-(m11*m3-m10*m4)*m6)
-                 +m0*(-(m14*m7-m13*m8)*m9+m11*(m11*m7-m10*m8)
-                                         +(m10*m14-m11*m13)*m6)
-                 -m1*(-(m14*m3-m13*m4)*m9+m11*(m11*m3-m10*m4)
-                                         +(m10*m14-m11*m13)*m2)
-                 +m2*(m11*(m3*m8-m4*m7)+m2*(m14*m7-m13*m8)
-                                       -(m14*m3-m13*m4)*m6),
-                -m2*(m8*(m3*m8-m4*m7)+m1*(m14*m7-m13*m8)-(m14*m3-m13*m4)*m5)
-                 +m4*(m6*(m3*m8-m4*m7)+m1*(m11*m7-m10*m8)-(m11*m3-m10*m4)*m5)
-                 -m0*(-m6*(m14*m7-m13*m8)+m8*(m11*m7-m10*m8)
-                                         +(m10*m14-m11*m13)*m5)
-                 +m1*((m11*m3-m10*m4)*m8-(m14*m3-m13*m4)*m6
-                                        +m1*(m10*m14-m11*m13)),
-                m0*(m8*(m11*m6-m8*m9)+m5*(m14*m9-m11^2)-m6*(m14*m6-m11*m8))
-                 -m4*(m1*(m11*m6-m8*m9)-m5*(m11*m2-m4*m9)+m6*(m2*m8-m4*m6))
-                 -m1*(m8*(m11*m2-m4*m9)+m1*(m14*m9-m11^2)-(m14*m2-m11*m4)*m6)
-                 +m2*(m8*(m2*m8-m4*m6)+m1*(m14*m6-m11*m8)-(m14*m2-m11*m4)*m5),
-                -m0*(m8*(m10*m6-m7*m9)+m5*(m13*m9-m10*m11)-m6*(m13*m6-m11*m7))
-                 +m4*(m1*(m10*m6-m7*m9)-m5*(m10*m2-m3*m9)+m6*(m2*m7-m3*m6))
-                 +m1*(m8*(m10*m2-m3*m9)+m1*(m13*m9-m10*m11)
-                                       -(m13*m2-m11*m3)*m6)
-                 -m2*((m2*m7-m3*m6)*m8+m1*(m13*m6-m11*m7)
-                                      -(m13*m2-m11*m3)*m5)],
-               [-m7*((m3*m8-m4*m7)*m9+m2*(m11*m7-m10*m8)-(m11*m3-m10*m4)*m6)
-                 +m1*(-(m13*m7-m12*m8)*m9+m10*(m11*m7-m10*m8)
-                                         +(m10*m13-m11*m12)*m6)
-                 -m5*(-(m13*m3-m12*m4)*m9+m10*(m11*m3-m10*m4)
-                                         +(m10*m13-m11*m12)*m2)
-                 +m6*(m10*(m3*m8-m4*m7)+m2*(m13*m7-m12*m8)
-                                       -(m13*m3-m12*m4)*m6),
-                m3*((m3*m8-m4*m7)*m9+m2*(m11*m7-m10*m8)-(m11*m3-m10*m4)*m6)
-                 -m0*(-(m13*m7-m12*m8)*m9+m10*(m11*m7-m10*m8)
-                                         +(m10*m13-m11*m12)*m6)
-                 +m1*(-(m13*m3-m12*m4)*m9+m10*(m11*m3-m10*m4)
-                                         +(m10*m13-m11*m12)*m2)
-                 -m2*(m10*(m3*m8-m4*m7)+m2*(m13*m7-m12*m8)
-                                       -(m13*m3-m12*m4)*m6),
-                m2*(m7*(m3*m8-m4*m7)+m1*(m13*m7-m12*m8)-(m13*m3-m12*m4)*m5)
-                 -m3*(m6*(m3*m8-m4*m7)+m1*(m11*m7-m10*m8)-(m11*m3-m10*m4)*m5)
-                 +m0*(-m6*(m13*m7-m12*m8)+m7*(m11*m7-m10*m8)
-                                         +(m10*m13-m11*m12)*m5)
-                 -m1*((m11*m3-m10*m4)*m7-(m13*m3-m12*m4)*m6
-                                        +m1*(m10*m13-m11*m12)),
-                -m0*(m7*(m11*m6-m8*m9)+m5*(m13*m9-m10*m11)-m6*(m13*m6-m10*m8))
-                 +m3*(m1*(m11*m6-m8*m9)-m5*(m11*m2-m4*m9)+m6*(m2*m8-m4*m6))
-                 +m1*(m7*(m11*m2-m4*m9)+m1*(m13*m9-m10*m11)
-                                       -(m13*m2-m10*m4)*m6)
-                 -m2*(m7*(m2*m8-m4*m6)+m1*(m13*m6-m10*m8)-(m13*m2-m10*m4)*m5),
-                m0*(m7*(m10*m6-m7*m9)+m5*(m12*m9-m10^2)-m6*(m12*m6-m10*m7))
-                 -m3*(m1*(m10*m6-m7*m9)-m5*(m10*m2-m3*m9)+m6*(m2*m7-m3*m6))
-                 -m1*(m7*(m10*m2-m3*m9)+m1*(m12*m9-m10^2)-(m12*m2-m10*m3)*m6)
-                 +m2*(m7*(m2*m7-m3*m6)+m1*(m12*m6-m10*m7)
-                                      -(m12*m2-m10*m3)*m5)])
+
+The 4x4, 5x5 and 6x6 versions are generated by minimath_generate.pl. The
+expressions that maxima produces for those recompute the same small minors many
+times; the generated versions compute each minor only once
 */
 
 static inline double cofactors_sym2(const double* restrict m, double* restrict c)
@@ -383,43 +204,6 @@ static inline double cofactors_sym3(const double* restrict m, double* restrict c
   return m[0]*c[0] + m[1]*c[1] + m[2]*c[2];
 }
 
-static inline double cofactors_sym4(const double* restrict m, double* restrict c)
-{
-  c[0] = m[4]*(m[7]*m[9]-m[8]*m[8])-m[5]*(m[5]*m[9]-m[6]*m[8])+m[6]*(m[5]*m[8]-m[6]*m[7]);
-  c[1] = -m[1]*(m[7]*m[9]-m[8]*m[8])+m[2]*(m[5]*m[9]-m[6]*m[8])-m[3]*(m[5]*m[8]-m[6]*m[7]);
-  c[2] = m[1]*(m[5]*m[9]-m[6]*m[8])-m[2]*(m[4]*m[9]-m[6]*m[6])+m[3]*(m[4]*m[8]-m[5]*m[6]);
-  c[3] = -m[1]*(m[5]*m[8]-m[6]*m[7])+m[2]*(m[4]*m[8]-m[5]*m[6])-m[3]*(m[4]*m[7]-m[5]*m[5]);
-  c[4] = m[0]*(m[7]*m[9]-m[8]*m[8])-m[2]*(m[2]*m[9]-m[3]*m[8])+m[3]*(m[2]*m[8]-m[3]*m[7]);
-  c[5] = -m[0]*(m[5]*m[9]-m[6]*m[8])+m[2]*(m[1]*m[9]-m[3]*m[6])-m[3]*(m[1]*m[8]-m[3]*m[5]);
-  c[6] = m[0]*(m[5]*m[8]-m[6]*m[7])-m[2]*(m[1]*m[8]-m[2]*m[6])+m[3]*(m[1]*m[7]-m[2]*m[5]);
-  c[7] = m[0]*(m[4]*m[9]-m[6]*m[6])-m[1]*(m[1]*m[9]-m[3]*m[6])+m[3]*(m[1]*m[6]-m[3]*m[4]);
-  c[8] = -m[0]*(m[4]*m[8]-m[5]*m[6])+m[1]*(m[1]*m[8]-m[2]*m[6])-m[3]*(m[1]*m[5]-m[2]*m[4]);
-  c[9] = m[0]*(m[4]*m[7]-m[5]*m[5])-m[1]*(m[1]*m[7]-m[2]*m[5])+m[2]*(m[1]*m[5]-m[2]*m[4]);
-
-  return m[0]*c[0] + m[1]*c[1] + m[2]*c[2] + m[3]*c[3];
-}
-
-static inline double cofactors_sym5(const double* restrict m, double* restrict c)
-{
-  c[0] =   m[7]*(-(m[14]*m[7]-m[13]*m[8])*m[9]+m[11]*(m[11]*m[7]-m[10]*m[8])+(m[10]*m[14]-m[11]*m[13])*m[6])-m[8]*(-(m[13]*m[7]-m[12]*m[8])*m[9]+m[10]*(m[11]*m[7]-m[10]*m[8])+(m[10]*m[13]-m[11]*m[12])*m[6])+m[5]*((m[12]*m[14]-m[13]*m[13])*m[9]-m[10]*(m[10]*m[14]-m[11]*m[13])+m[11]*(m[10]*m[13]-m[11]*m[12]))-m[6]*(-m[10]*(m[14]*m[7]-m[13]*m[8])+m[11]*(m[13]*m[7]-m[12]*m[8])+(m[12]*m[14]-m[13]*m[13])*m[6]);
-  c[1] =   -m[3]*(-(m[14]*m[7]-m[13]*m[8])*m[9]+m[11]*(m[11]*m[7]-m[10]*m[8])+(m[10]*m[14]-m[11]*m[13])*m[6])+m[4]*(-(m[13]*m[7]-m[12]*m[8])*m[9]+m[10]*(m[11]*m[7]-m[10]*m[8])+(m[10]*m[13]-m[11]*m[12])*m[6])-m[1]*((m[12]*m[14]-m[13]*m[13])*m[9]-m[10]*(m[10]*m[14]-m[11]*m[13])+m[11]*(m[10]*m[13]-m[11]*m[12]))+m[2]*(-m[10]*(m[14]*m[7]-m[13]*m[8])+m[11]*(m[13]*m[7]-m[12]*m[8])+(m[12]*m[14]-m[13]*m[13])*m[6]);
-  c[2] =   -m[2]*(-m[7]*(m[14]*m[7]-m[13]*m[8])+m[8]*(m[13]*m[7]-m[12]*m[8])+(m[12]*m[14]-m[13]*m[13])*m[5])+m[3]*(-m[6]*(m[14]*m[7]-m[13]*m[8])+m[8]*(m[11]*m[7]-m[10]*m[8])+(m[10]*m[14]-m[11]*m[13])*m[5])-m[4]*(-m[6]*(m[13]*m[7]-m[12]*m[8])+m[7]*(m[11]*m[7]-m[10]*m[8])+(m[10]*m[13]-m[11]*m[12])*m[5])+m[1]*((m[10]*m[13]-m[11]*m[12])*m[8]-(m[10]*m[14]-m[11]*m[13])*m[7]+(m[12]*m[14]-m[13]*m[13])*m[6]);
-  c[3] =   -m[3]*(m[8]*(m[11]*m[6]-m[8]*m[9])+m[5]*(m[14]*m[9]-m[11]*m[11])-m[6]*(m[14]*m[6]-m[11]*m[8]))+m[4]*(m[7]*(m[11]*m[6]-m[8]*m[9])+m[5]*(m[13]*m[9]-m[10]*m[11])-m[6]*(m[13]*m[6]-m[10]*m[8]))-m[1]*(-m[7]*(m[14]*m[9]-m[11]*m[11])+m[8]*(m[13]*m[9]-m[10]*m[11])+(m[10]*m[14]-m[11]*m[13])*m[6])+m[2]*(-m[7]*(m[14]*m[6]-m[11]*m[8])+m[8]*(m[13]*m[6]-m[10]*m[8])+(m[10]*m[14]-m[11]*m[13])*m[5]);
-  c[4] =   m[3]*(m[8]*(m[10]*m[6]-m[7]*m[9])+m[5]*(m[13]*m[9]-m[10]*m[11])-m[6]*(m[13]*m[6]-m[11]*m[7]))-m[4]*(m[7]*(m[10]*m[6]-m[7]*m[9])+m[5]*(m[12]*m[9]-m[10]*m[10])-m[6]*(m[12]*m[6]-m[10]*m[7]))+m[1]*(-m[7]*(m[13]*m[9]-m[10]*m[11])+m[8]*(m[12]*m[9]-m[10]*m[10])+(m[10]*m[13]-m[11]*m[12])*m[6])-m[2]*((m[12]*m[6]-m[10]*m[7])*m[8]-m[7]*(m[13]*m[6]-m[11]*m[7])+(m[10]*m[13]-m[11]*m[12])*m[5]);
-  c[5] =   m[3]*(-(m[14]*m[3]-m[13]*m[4])*m[9]+m[11]*(m[11]*m[3]-m[10]*m[4])+(m[10]*m[14]-m[11]*m[13])*m[2])-m[4]*(-(m[13]*m[3]-m[12]*m[4])*m[9]+m[10]*(m[11]*m[3]-m[10]*m[4])+(m[10]*m[13]-m[11]*m[12])*m[2])+m[0]*((m[12]*m[14]-m[13]*m[13])*m[9]-m[10]*(m[10]*m[14]-m[11]*m[13])+m[11]*(m[10]*m[13]-m[11]*m[12]))-m[2]*(-m[10]*(m[14]*m[3]-m[13]*m[4])+m[11]*(m[13]*m[3]-m[12]*m[4])+(m[12]*m[14]-m[13]*m[13])*m[2]);
-  c[6] =   m[2]*((m[13]*m[3]-m[12]*m[4])*m[8]-(m[14]*m[3]-m[13]*m[4])*m[7]+m[1]*(m[12]*m[14]-m[13]*m[13]))-m[3]*((m[11]*m[3]-m[10]*m[4])*m[8]-(m[14]*m[3]-m[13]*m[4])*m[6]+m[1]*(m[10]*m[14]-m[11]*m[13]))-m[0]*((m[10]*m[13]-m[11]*m[12])*m[8]-(m[10]*m[14]-m[11]*m[13])*m[7]+(m[12]*m[14]-m[13]*m[13])*m[6])+m[4]*((m[11]*m[3]-m[10]*m[4])*m[7]-(m[13]*m[3]-m[12]*m[4])*m[6]+m[1]*(m[10]*m[13]-m[11]*m[12]));
-  c[7] =   m[3]*(m[8]*(m[11]*m[2]-m[4]*m[9])+m[1]*(m[14]*m[9]-m[11]*m[11])-(m[14]*m[2]-m[11]*m[4])*m[6])-m[4]*(m[7]*(m[11]*m[2]-m[4]*m[9])+m[1]*(m[13]*m[9]-m[10]*m[11])-(m[13]*m[2]-m[10]*m[4])*m[6])+m[0]*(-m[7]*(m[14]*m[9]-m[11]*m[11])+m[8]*(m[13]*m[9]-m[10]*m[11])+(m[10]*m[14]-m[11]*m[13])*m[6])-m[2]*((m[13]*m[2]-m[10]*m[4])*m[8]-(m[14]*m[2]-m[11]*m[4])*m[7]+m[1]*(m[10]*m[14]-m[11]*m[13]));
-  c[8] =   -m[3]*(m[8]*(m[10]*m[2]-m[3]*m[9])+m[1]*(m[13]*m[9]-m[10]*m[11])-(m[13]*m[2]-m[11]*m[3])*m[6])+m[4]*(m[7]*(m[10]*m[2]-m[3]*m[9])+m[1]*(m[12]*m[9]-m[10]*m[10])-(m[12]*m[2]-m[10]*m[3])*m[6])-m[0]*(-m[7]*(m[13]*m[9]-m[10]*m[11])+m[8]*(m[12]*m[9]-m[10]*m[10])+(m[10]*m[13]-m[11]*m[12])*m[6])+m[2]*((m[12]*m[2]-m[10]*m[3])*m[8]-(m[13]*m[2]-m[11]*m[3])*m[7]+m[1]*(m[10]*m[13]-m[11]*m[12]));
-  c[9] =   m[3]*(m[8]*(m[3]*m[8]-m[4]*m[7])+m[1]*(m[14]*m[7]-m[13]*m[8])-(m[14]*m[3]-m[13]*m[4])*m[5])-m[4]*(m[7]*(m[3]*m[8]-m[4]*m[7])+m[1]*(m[13]*m[7]-m[12]*m[8])-(m[13]*m[3]-m[12]*m[4])*m[5])+m[0]*(-m[7]*(m[14]*m[7]-m[13]*m[8])+m[8]*(m[13]*m[7]-m[12]*m[8])+(m[12]*m[14]-m[13]*m[13])*m[5])-m[1]*((m[13]*m[3]-m[12]*m[4])*m[8]-(m[14]*m[3]-m[13]*m[4])*m[7]+m[1]*(m[12]*m[14]-m[13]*m[13]));
-  c[10] =   -m[3]*(m[8]*(m[2]*m[8]-m[4]*m[6])+m[1]*(m[14]*m[6]-m[11]*m[8])-(m[14]*m[2]-m[11]*m[4])*m[5])+m[4]*(m[7]*(m[2]*m[8]-m[4]*m[6])+m[1]*(m[13]*m[6]-m[10]*m[8])-(m[13]*m[2]-m[10]*m[4])*m[5])-m[0]*(-m[7]*(m[14]*m[6]-m[11]*m[8])+m[8]*(m[13]*m[6]-m[10]*m[8])+(m[10]*m[14]-m[11]*m[13])*m[5])+m[1]*((m[13]*m[2]-m[10]*m[4])*m[8]-(m[14]*m[2]-m[11]*m[4])*m[7]+m[1]*(m[10]*m[14]-m[11]*m[13]));
-  c[11] =   m[3]*((m[2]*m[7]-m[3]*m[6])*m[8]+m[1]*(m[13]*m[6]-m[11]*m[7])-(m[13]*m[2]-m[11]*m[3])*m[5])+m[0]*((m[12]*m[6]-m[10]*m[7])*m[8]-m[7]*(m[13]*m[6]-m[11]*m[7])+(m[10]*m[13]-m[11]*m[12])*m[5])-m[1]*((m[12]*m[2]-m[10]*m[3])*m[8]-(m[13]*m[2]-m[11]*m[3])*m[7]+m[1]*(m[10]*m[13]-m[11]*m[12]))-m[4]*(m[7]*(m[2]*m[7]-m[3]*m[6])+m[1]*(m[12]*m[6]-m[10]*m[7])-(m[12]*m[2]-m[10]*m[3])*m[5]);
-  c[12] =   m[0]*(m[8]*(m[11]*m[6]-m[8]*m[9])+m[5]*(m[14]*m[9]-m[11]*m[11])-m[6]*(m[14]*m[6]-m[11]*m[8]))-m[4]*(m[1]*(m[11]*m[6]-m[8]*m[9])-m[5]*(m[11]*m[2]-m[4]*m[9])+m[6]*(m[2]*m[8]-m[4]*m[6]))-m[1]*(m[8]*(m[11]*m[2]-m[4]*m[9])+m[1]*(m[14]*m[9]-m[11]*m[11])-(m[14]*m[2]-m[11]*m[4])*m[6])+m[2]*(m[8]*(m[2]*m[8]-m[4]*m[6])+m[1]*(m[14]*m[6]-m[11]*m[8])-(m[14]*m[2]-m[11]*m[4])*m[5]);
-  c[13] =   -m[0]*(m[8]*(m[10]*m[6]-m[7]*m[9])+m[5]*(m[13]*m[9]-m[10]*m[11])-m[6]*(m[13]*m[6]-m[11]*m[7]))+m[4]*(m[1]*(m[10]*m[6]-m[7]*m[9])-m[5]*(m[10]*m[2]-m[3]*m[9])+m[6]*(m[2]*m[7]-m[3]*m[6]))+m[1]*(m[8]*(m[10]*m[2]-m[3]*m[9])+m[1]*(m[13]*m[9]-m[10]*m[11])-(m[13]*m[2]-m[11]*m[3])*m[6])-m[2]*((m[2]*m[7]-m[3]*m[6])*m[8]+m[1]*(m[13]*m[6]-m[11]*m[7])-(m[13]*m[2]-m[11]*m[3])*m[5]);
-  c[14] =   m[0]*(m[7]*(m[10]*m[6]-m[7]*m[9])+m[5]*(m[12]*m[9]-m[10]*m[10])-m[6]*(m[12]*m[6]-m[10]*m[7]))-m[3]*(m[1]*(m[10]*m[6]-m[7]*m[9])-m[5]*(m[10]*m[2]-m[3]*m[9])+m[6]*(m[2]*m[7]-m[3]*m[6]))-m[1]*(m[7]*(m[10]*m[2]-m[3]*m[9])+m[1]*(m[12]*m[9]-m[10]*m[10])-(m[12]*m[2]-m[10]*m[3])*m[6])+m[2]*(m[7]*(m[2]*m[7]-m[3]*m[6])+m[1]*(m[12]*m[6]-m[10]*m[7])-(m[12]*m[2]-m[10]*m[3])*m[5]);
-
-  return m[0]*c[0] + m[1]*c[1] + m[2]*c[2] + m[3]*c[3] + m[4]*c[4];
-}
-
 /*
 The upper-triangular and lower-triangular routines have a similar API to the
 symmetric ones. Note that as with symmetric matrices, we don't store redundant
@@ -815,6 +599,1324 @@ static inline double cofactors_gen33(// output
     return det;
 }
 
+// Robust inverses. The inverse is computed from the cofactors, as usual. The
+// cofactors also give the exact 1-norm of the inverse, so the reciprocal
+// condition number rcond = 1/(|M|_1 |M^-1|_1) is available almost for free. If
+// rcond < rcond_min, the cofactor expansion isn't trusted, and the inverse is
+// recomputed with a Gauss-Jordan elimination with partial pivoting. This
+// fallback is out-of-line, so the common well-conditioned path stays small and
+// predictable. The inverse is stored in the same packed format as the input.
+// Returns rcond. If the matrix is exactly singular, 0 is returned, and the
+// inverse is set to 0
+
+// index of element (i,j) in a packed matrix: 's'ymmetric (upper triangle
+// stored), 'u'pper-triangular, 'l'ower-triangular or 'g'eneral. Returns -1 for
+// the elements that are not stored
+static inline int minimath_packed_index(char kind, int n, int i, int j)
+{
+    if(kind == 's' && i > j)
+    {
+        int t = i; i = j; j = t;
+    }
+    if(kind == 's' || kind == 'u') return i <= j ? (2*n-i-1)*i/2 + j : -1;
+    if(kind == 'l')                return j <= i ? i*(i+1)/2 + j     : -1;
+    return i*n + j;
+}
+
+// 1-norm (max column sum) of a packed matrix
+static inline double minimath_norm1_packed(char kind, int n, const double* restrict m)
+{
+    double norm = 0.0;
+    for(int j=0; j<n; j++)
+    {
+        double sum = 0.0;
+        for(int i=0; i<n; i++)
+        {
+            const int k = minimath_packed_index(kind, n, i, j);
+            if(k >= 0) sum += fabs(m[k]);
+        }
+        norm = fmax(norm, sum);
+    }
+    return norm;
+}
+
+// The slow path of the robust inverses: Gauss-Jordan elimination with partial
+// pivoting on an unpacked copy of m. n <= 6
+__attribute__((noinline, unused))
+static double minimath_inverse_pivoted(char kind, int n,
+                                       // output
+                                       double* restrict inv,
+                                       // input
+                                       const double* restrict m, double norm_m)
+{
+    double a[6*6], b[6*6];
+    for(int i=0; i<n; i++)
+        for(int j=0; j<n; j++)
+        {
+            const int k = minimath_packed_index(kind, n, i, j);
+            a[i*n + j] = k >= 0 ? m[k] : 0.0;
+            b[i*n + j] = i == j ? 1.0 : 0.0;
+        }
+
+    for(int col=0; col<n; col++)
+    {
+        int p = col;
+        for(int i=col+1; i<n; i++)
+            if(fabs(a[i*n + col]) > fabs(a[p*n + col]))
+                p = i;
+        if(a[p*n + col] == 0.0)
+        {
+            for(int i=0; i<n; i++)
+                for(int j=0; j<n; j++)
+                {
+                    const int k = minimath_packed_index(kind, n, i, j);
+                    if(k >= 0) inv[k] = 0.0;
+                }
+            return 0.0;
+        }
+        if(p != col)
+            for(int j=0; j<n; j++)
+            {
+                double t;
+                t = a[p*n + j]; a[p*n + j] = a[col*n + j]; a[col*n + j] = t;
+                t = b[p*n + j]; b[p*n + j] = b[col*n + j]; b[col*n + j] = t;
+            }
+
+        const double s = 1.0 / a[col*n + col];
+        for(int j=0; j<n; j++)
+        {
+            a[col*n + j] *= s;
+            b[col*n + j] *= s;
+        }
+        for(int i=0; i<n; i++)
+        {
+            if(i == col) continue;
+            const double f = a[i*n + col];
+            for(int j=0; j<n; j++)
+            {
+                a[i*n + j] -= f*a[col*n + j];
+                b[i*n + j] -= f*b[col*n + j];
+            }
+        }
+    }
+
+    // Pack. A symmetric inverse is symmetrized to clean up the round-off
+    double norm_inv = 0.0;
+    for(int j=0; j<n; j++)
+    {
+        double sum = 0.0;
+        for(int i=0; i<n; i++)
+        {
+            const int k = minimath_packed_index(kind, n, i, j);
+            if(k < 0) continue;
+            sum += fabs(b[i*n + j]);
+            if(kind != 's')  inv[k] = b[i*n + j];
+            else if(i <= j)  inv[k] = (b[i*n + j] + b[j*n + i]) / 2.0;
+        }
+        norm_inv = fmax(norm_inv, sum);
+    }
+    return 1.0 / (norm_m * norm_inv);
+}
+
+// Takes the cofactors c and determinant from cofactors_...(). Scales the
+// cofactors into the inverse in-place, or calls the fallback
+static inline double minimath_inverse_robust(char kind, int n,
+                                             // output
+                                             double* restrict c,
+                                             // input
+                                             const double* restrict m, double det, double rcond_min)
+{
+    const double norm_m = minimath_norm1_packed(kind, n, m);
+    const double norm_c = minimath_norm1_packed(kind, n, c);
+
+    if(__builtin_expect(det != 0.0 && fabs(det) >= rcond_min * norm_m * norm_c, 1))
+    {
+        const int N = kind == 'g' ? n*n : n*(n+1)/2;
+        const double s = 1.0 / det;
+        for(int i=0; i<N; i++) c[i] *= s;
+        return fabs(det) / (norm_m * norm_c);
+    }
+    return minimath_inverse_pivoted(kind, n, c, m, norm_m);
+}
+
+static inline double inverse_sym2_robust(const double* restrict m, double* restrict inv, double rcond_min)
+{
+    return minimath_inverse_robust('s', 2, inv, m, cofactors_sym2(m, inv), rcond_min);
+}
+static inline double inverse_sym3_robust(const double* restrict m, double* restrict inv, double rcond_min)
+{
+    return minimath_inverse_robust('s', 3, inv, m, cofactors_sym3(m, inv), rcond_min);
+}
+static inline double inverse_sym4_robust(const double* restrict m, double* restrict inv, double rcond_min)
+{
+    return minimath_inverse_robust('s', 4, inv, m, cofactors_sym4(m, inv), rcond_min);
+}
+static inline double inverse_sym5_robust(const double* restrict m, double* restrict inv, double rcond_min)
+{
+    return minimath_inverse_robust('s', 5, inv, m, cofactors_sym5(m, inv), rcond_min);
+}
+static inline double inverse_sym6_robust(const double* restrict m, double* restrict inv, double rcond_min)
+{
+    return minimath_inverse_robust('s', 6, inv, m, cofactors_sym6(m, inv), rcond_min);
+}
+static inline double inverse_ut2_robust(const double* restrict m, double* restrict inv, double rcond_min)
+{
+    return minimath_inverse_robust('u', 2, inv, m, cofactors_ut2(m, inv), rcond_min);
+}
+static inline double inverse_ut3_robust(const double* restrict m, double* restrict inv, double rcond_min)
+{
+    return minimath_inverse_robust('u', 3, inv, m, cofactors_ut3(m, inv), rcond_min);
+}
+static inline double inverse_ut4_robust(const double* restrict m, double* restrict inv, double rcond_min)
+{
+    return minimath_inverse_robust('u', 4, inv, m, cofactors_ut4(m, inv), rcond_min);
+}
+static inline double inverse_ut5_robust(const double* restrict m, double* restrict inv, double rcond_min)
+{
+    return minimath_inverse_robust('u', 5, inv, m, cofactors_ut5(m, inv), rcond_min);
+}
+static inline double inverse_lt2_robust(const double* restrict m, double* restrict inv, double rcond_min)
+{
+    return minimath_inverse_robust('l', 2, inv, m, cofactors_lt2(m, inv), rcond_min);
+}
+static inline double inverse_lt3_robust(const double* restrict m, double* restrict inv, double rcond_min)
+{
+    return minimath_inverse_robust('l', 3, inv, m, cofactors_lt3(m, inv), rcond_min);
+}
+static inline double inverse_lt4_robust(const double* restrict m, double* restrict inv, double rcond_min)
+{
+    return minimath_inverse_robust('l', 4, inv, m, cofactors_lt4(m, inv), rcond_min);
+}
+static inline double inverse_lt5_robust(const double* restrict m, double* restrict inv, double rcond_min)
+{
+    return minimath_inverse_robust('l', 5, inv, m, cofactors_lt5(m, inv), rcond_min);
+}
+static inline double inverse_gen33_robust(const double* restrict m, double* restrict inv, double rcond_min)
+{
+    return minimath_inverse_robust('g', 3, inv, m, cofactors_gen33(inv, m), rcond_min);
+}
+
+// cross product of two 3-vectors: vout = a x b
+static inline void cross3_vout(const double* restrict a, const double* restrict b, double* restrict vout)
+{
+    vout[0] = a[1]*b[2] - a[2]*b[1];
+    vout[1] = a[2]*b[0] - a[0]*b[2];
+    vout[2] = a[0]*b[1] - a[1]*b[0];
+}
+
+// Finds a vector in the null space of (s - lambda*I), where s is a symmetric
+// 3x3 matrix and lambda is one of its eigenvalues. This matrix has rank 2 (if
+// lambda is a simple eigenvalue), so the null space is spanned by a cross
+// product of two of its rows. I compute all 3 cross products, and use the
+// largest one. The result is not normalized. Returns its squared norm
+static inline double minimath_eig_sym33_vector(double* restrict v,
+                                               const double* restrict s, double lambda)
+{
+    const double r0[] = {s[0]-lambda, s[1],        s[2]       };
+    const double r1[] = {s[1],        s[3]-lambda, s[4]       };
+    const double r2[] = {s[2],        s[4],        s[5]-lambda};
+
+    double c[3][3];
+    cross3_vout(r0, r1, c[0]);
+    cross3_vout(r0, r2, c[1]);
+    cross3_vout(r1, r2, c[2]);
+
+    const double n0 = norm2_vec(3, c[0]);
+    const double n1 = norm2_vec(3, c[1]);
+    const double n2 = norm2_vec(3, c[2]);
+
+    const int    i    = n0 >= n1 ? (n0 >= n2 ? 0 : 2) : (n1 >= n2 ? 1 : 2);
+    const double norm = i == 0 ? n0 : (i == 1 ? n1 : n2);
+    for(int j=0; j<3; j++)
+        v[j] = c[i][j];
+    return norm;
+}
+
+// Eigen-decomposition of a symmetric 3x3 matrix s, stored packed. The
+// eigenvalues are written to l[] in ascending order. The corresponding
+// eigenvectors are written to the rows of the 3x3 matrix v. These are
+// orthonormal: v * s * vt = diag(l)
+//
+// The eigenvalues come from the trigonometric solution of the characteristic
+// cubic (Smith 1961). Each eigenvector is the cross product of two rows of
+// s - lambda*I. This is ill-conditioned when eigenvalues are (nearly) repeated,
+// so I compute the vector for the most isolated eigenvalue, and build the other
+// two from it by orthogonalization. If the middle eigenvalue is repeated also,
+// any orthonormal basis of that eigenspace is returned. Near a repeated
+// eigenvalue the relative accuracy of the trigonometric solution drops to about
+// sqrt(machine epsilon). Use an iterative solver if that isn't good enough
+static inline void eig_sym33(// output
+                             double* restrict l, double* restrict v,
+
+                             // input
+                             const double* restrict s)
+{
+    // I shift and scale the matrix to B = (s - q*I)/p, which has trace 0 and
+    // a reasonable scale
+    const double q  = (s[0] + s[3] + s[5]) / 3.0;
+    const double p1 = s[1]*s[1] + s[2]*s[2] + s[4]*s[4];
+    const double p2 =
+        (s[0]-q)*(s[0]-q) + (s[3]-q)*(s[3]-q) + (s[5]-q)*(s[5]-q) + 2.0*p1;
+    const double p  = sqrt(p2 / 6.0);
+
+    if(p == 0.0)
+    {
+        // s = q*I. Any basis will do
+        for(int i=0; i<3; i++)
+        {
+            l[i] = q;
+            for(int j=0; j<3; j++)
+                v[i*3 + j] = i == j ? 1.0 : 0.0;
+        }
+        return;
+    }
+
+    const double b[] = { (s[0]-q)/p, s[1]/p, s[2]/p,
+                                     (s[3]-q)/p, s[4]/p,
+                                                 (s[5]-q)/p };
+    double r = 0.5 * (b[0]*(b[3]*b[5]-b[4]*b[4]) -
+                      b[1]*(b[1]*b[5]-b[2]*b[4]) +
+                      b[2]*(b[1]*b[4]-b[2]*b[3]));
+    // r is in [-1,1] analytically, but may be slightly outside numerically
+    if     (r <= -1.0) r = -1.0;
+    else if(r >=  1.0) r =  1.0;
+
+    const double phi = acos(r) / 3.0;
+    l[2] = q + 2.0*p*cos(phi);
+    l[0] = q + 2.0*p*cos(phi + 2.0943951023931954923); // phi + 2pi/3
+    l[1] = 3.0*q - l[0] - l[2];
+    // roundoff could break the ordering when the eigenvalues are nearly equal
+    if(l[1] < l[0]) l[1] = l[0];
+    if(l[1] > l[2]) l[1] = l[2];
+
+    // The eigenvector of the most isolated eigenvalue. Its gap to the others is
+    // at least half of the spread of the eigenvalues, so this is always
+    // well-conditioned
+    const int iiso   = l[1] - l[0] > l[2] - l[1] ? 0 : 2;
+    double*   viso   = &v[iiso*3];
+    double*   vmid   = &v[3];
+    double*   vother = &v[(2-iiso)*3];
+
+    double norm2 = minimath_eig_sym33_vector(viso, s, l[iiso]);
+    for(int j=0; j<3; j++)
+        viso[j] /= sqrt(norm2);
+
+    // The middle eigenvector. If the middle eigenvalue is (nearly) repeated, the
+    // cross products are tiny, and the direction is meaningless. I then use any
+    // vector orthogonal to viso. In either case I make sure it is orthogonal to
+    // viso
+    norm2 = minimath_eig_sym33_vector(vmid, s, l[1]);
+    if(norm2 <= 1e-12 * p2*p2)
+    {
+        // pick the axis least aligned with viso, and orthogonalize it
+        const int iaxis =
+            fabs(viso[0]) <= fabs(viso[1]) ?
+            (fabs(viso[0]) <= fabs(viso[2]) ? 0 : 2) :
+            (fabs(viso[1]) <= fabs(viso[2]) ? 1 : 2);
+        for(int j=0; j<3; j++)
+            vmid[j] = (j == iaxis ? 1.0 : 0.0) - viso[iaxis]*viso[j];
+    }
+    else
+    {
+        const double d = dot_vec(3, vmid, viso);
+        for(int j=0; j<3; j++)
+            vmid[j] -= d*viso[j];
+    }
+    norm2 = norm2_vec(3, vmid);
+    for(int j=0; j<3; j++)
+        vmid[j] /= sqrt(norm2);
+
+    // And the last eigenvector is orthogonal to both
+    cross3_vout(viso, vmid, vother);
+}
+
+// N eigen-decompositions of symmetric 3x3 matrices (structure-of-arrays):
+// element j of matrix i lives in s[j*stride + i]. The outputs are laid out the
+// same way: l[j*stride + i] for the 3 eigenvalues, and v[j*stride + i] for the
+// 9 elements of the eigenvector matrix. See eig_sym33() for details
+static inline void eig_soaN_sym33(int n, int stride,
+
+                                  // output
+                                  double* restrict l, double* restrict v,
+
+                                  // input
+                                  const double* restrict s)
+{
+    MINIMATH_PARALLEL_FOR(n)
+    for(int i=0; i<n; i++)
+    {
+        double si[6], li[3], vi[9];
+        for(int j=0; j<6; j++) si[j] = s[j*stride + i];
+        eig_sym33(li, vi, si);
+        for(int j=0; j<3; j++) l[j*stride + i] = li[j];
+        for(int j=0; j<9; j++) v[j*stride + i] = vi[j];
+    }
+}
+
+// Applies a Jacobi rotation in the (p,q) plane to the full symmetric 3x3 matrix
+// S, chosen to zero out S[p][q]. The rotation is accumulated into the columns of
+// V. Used by svd_gen33()
+static inline void minimath_jacobi33(double* restrict S, double* restrict V, int p, int q)
+{
+    const double spq = S[p*3 + q];
+    if(spq == 0.0)
+        return;
+
+    const double theta = (S[q*3 + q] - S[p*3 + p]) / (2.0*spq);
+    const double t     = (theta >= 0.0 ? 1.0 : -1.0) / (fabs(theta) + sqrt(theta*theta + 1.0));
+    const double c     = 1.0 / sqrt(t*t + 1.0);
+    const double s     = t*c;
+
+    // S <- Jt S J
+    for(int k=0; k<3; k++)
+    {
+        const double skp = S[k*3 + p];
+        const double skq = S[k*3 + q];
+        S[k*3 + p] = c*skp - s*skq;
+        S[k*3 + q] = s*skp + c*skq;
+    }
+    for(int k=0; k<3; k++)
+    {
+        const double spk = S[p*3 + k];
+        const double sqk = S[q*3 + k];
+        S[p*3 + k] = c*spk - s*sqk;
+        S[q*3 + k] = s*spk + c*sqk;
+    }
+
+    // V <- V J
+    for(int k=0; k<3; k++)
+    {
+        const double vkp = V[k*3 + p];
+        const double vkq = V[k*3 + q];
+        V[k*3 + p] = c*vkp - s*vkq;
+        V[k*3 + q] = s*vkp + c*vkq;
+    }
+}
+
+// If column q of B is longer than column p, swaps the columns of B and of V. One
+// of the swapped columns is negated to keep det(V) = +1. Used by svd_gen33()
+static inline void minimath_svd_sort33(double* restrict B, double* restrict V, int p, int q)
+{
+    const double np = B[p]*B[p] + B[3+p]*B[3+p] + B[6+p]*B[6+p];
+    const double nq = B[q]*B[q] + B[3+q]*B[3+q] + B[6+q]*B[6+q];
+    if(nq <= np)
+        return;
+
+    for(int k=0; k<3; k++)
+    {
+        double t;
+        t = B[k*3 + p]; B[k*3 + p] = B[k*3 + q]; B[k*3 + q] = -t;
+        t = V[k*3 + p]; V[k*3 + p] = V[k*3 + q]; V[k*3 + q] = -t;
+    }
+}
+
+// Applies a Givens rotation to rows a,b of B, chosen to zero out B[b][col]. The
+// rotation is accumulated into the columns of U. Used by svd_gen33()
+static inline void minimath_givens33(double* restrict B, double* restrict U, int a, int b, int col)
+{
+    const double x = B[a*3 + col];
+    const double y = B[b*3 + col];
+    const double r = sqrt(x*x + y*y);
+    const double c = r > 0.0 ? x/r : 1.0;
+    const double s = r > 0.0 ? y/r : 0.0;
+
+    // B <- G B
+    for(int k=0; k<3; k++)
+    {
+        const double bak = B[a*3 + k];
+        const double bbk = B[b*3 + k];
+        B[a*3 + k] =  c*bak + s*bbk;
+        B[b*3 + k] = -s*bak + c*bbk;
+    }
+
+    // U <- U Gt
+    for(int k=0; k<3; k++)
+    {
+        const double uka = U[k*3 + a];
+        const double ukb = U[k*3 + b];
+        U[k*3 + a] =  c*uka + s*ukb;
+        U[k*3 + b] = -s*uka + c*ukb;
+    }
+}
+
+// Singular value decomposition of a general 3x3 matrix m: m = u * diag(s) * vt.
+// u and v are rotations: orthonormal, with det = +1. s[] is sorted by decreasing
+// magnitude. s[0] and s[1] are non-negative. s[2] has the sign of det(m). So for
+// a reflection the sign lives in s[2], not in u or v.
+//
+// This follows McAdams et al, "Computing the Singular Value Decomposition of 3x3
+// matrices with minimal branching and elementary floating point operations". I
+// diagonalize mt*m with a fixed number of cyclic Jacobi sweeps to get v. I then
+// sort the columns of m*v by length, and do a QR decomposition of the result
+// with Givens rotations to get u and s. The loop counts don't depend on the
+// data
+static inline void svd_gen33(// output
+                             double* restrict u, double* restrict s, double* restrict v,
+
+                             // input
+                             const double* restrict m)
+{
+    double S[9];
+    for(int i=0; i<3; i++)
+        for(int j=0; j<3; j++)
+            S[i*3 + j] = m[i]*m[j] + m[3+i]*m[3+j] + m[6+i]*m[6+j];
+
+    for(int i=0; i<9; i++)
+        v[i] = u[i] = (i%4 == 0) ? 1.0 : 0.0;
+
+    // Cyclic Jacobi converges quadratically. 4 sweeps is plenty for a 3x3
+    for(int sweep=0; sweep<4; sweep++)
+    {
+        minimath_jacobi33(S, v, 0, 1);
+        minimath_jacobi33(S, v, 0, 2);
+        minimath_jacobi33(S, v, 1, 2);
+    }
+
+    double B[9];
+    for(int i=0; i<3; i++)
+        for(int j=0; j<3; j++)
+            B[i*3 + j] = m[i*3]*v[j] + m[i*3+1]*v[3+j] + m[i*3+2]*v[6+j];
+
+    minimath_svd_sort33(B, v, 0, 1);
+    minimath_svd_sort33(B, v, 0, 2);
+    minimath_svd_sort33(B, v, 1, 2);
+
+    // B = u*R. R is upper-triangular with orthogonal columns, so it is diagonal
+    minimath_givens33(B, u, 0, 1, 0);
+    minimath_givens33(B, u, 0, 2, 0);
+    minimath_givens33(B, u, 1, 2, 1);
+
+    s[0] = B[0];
+    s[1] = B[4];
+    s[2] = B[8];
+}
+
+// The rotation closest to m in the Frobenius norm: r = u*vt from svd_gen33().
+// This is the solution of the orthogonal Procrustes (Kabsch) problem, and is
+// always a proper rotation, even if m has a negative determinant
+static inline void nearest_rotation_gen33(// output
+                                          double* restrict r,
+
+                                          // input
+                                          const double* restrict m)
+{
+    double u[9], s[3], v[9];
+    svd_gen33(u, s, v, m);
+
+    for(int i=0; i<3; i++)
+        for(int j=0; j<3; j++)
+            r[i*3 + j] = u[i*3]*v[j*3] + u[i*3+1]*v[j*3+1] + u[i*3+2]*v[j*3+2];
+}
+
+// Polar decomposition m = r*p, where r is the nearest rotation to m (see
+// nearest_rotation_gen33()), and p = v*diag(s)*vt is symmetric, stored packed.
+// p is positive semi-definite if det(m) >= 0
+static inline void polar_gen33(// output
+                               double* restrict r, double* restrict p,
+
+                               // input
+                               const double* restrict m)
+{
+    double u[9], s[3], v[9];
+    svd_gen33(u, s, v, m);
+
+    for(int i=0; i<3; i++)
+        for(int j=0; j<3; j++)
+            r[i*3 + j] = u[i*3]*v[j*3] + u[i*3+1]*v[j*3+1] + u[i*3+2]*v[j*3+2];
+
+    int ip = 0;
+    for(int i=0; i<3; i++)
+        for(int j=i; j<3; j++)
+            p[ip++] = v[i*3]*s[0]*v[j*3] + v[i*3+1]*s[1]*v[j*3+1] + v[i*3+2]*s[2]*v[j*3+2];
+}
+
+// N 3x3 SVDs (structure-of-arrays): element j of matrix i lives in
+// m[j*stride + i]. The outputs are laid out the same way: u[j*stride + i],
+// s[j*stride + i], v[j*stride + i]. See svd_gen33() for details
+static inline void svd_soaN_gen33(int n, int stride,
+
+                                  // output
+                                  double* restrict u, double* restrict s, double* restrict v,
+
+                                  // input
+                                  const double* restrict m)
+{
+    MINIMATH_PARALLEL_FOR(n)
+    for(int i=0; i<n; i++)
+    {
+        double mi[9], ui[9], si[3], vi[9];
+        for(int j=0; j<9; j++) mi[j] = m[j*stride + i];
+        svd_gen33(ui, si, vi, mi);
+        for(int j=0; j<9; j++) u[j*stride + i] = ui[j];
+        for(int j=0; j<3; j++) s[j*stride + i] = si[j];
+        for(int j=0; j<9; j++) v[j*stride + i] = vi[j];
+    }
+}
+
+// N nearest rotations (structure-of-arrays): element j of matrix i lives in
+// m[j*stride + i] and r[j*stride + i]. See nearest_rotation_gen33() for details
+static inline void nearest_rotation_soaN_gen33(int n, int stride,
+
+                                               // output
+                                               double* restrict r,
+
+                                               // input
+                                               const double* restrict m)
+{
+    MINIMATH_PARALLEL_FOR(n)
+    for(int i=0; i<n; i++)
+    {
+        double mi[9], ri[9];
+        for(int j=0; j<9; j++) mi[j] = m[j*stride + i];
+        nearest_rotation_gen33(ri, mi);
+        for(int j=0; j<9; j++) r[j*stride + i] = ri[j];
+    }
+}
+
+
+// Rotations. A rotation matrix R is a gen33 matrix, stored row-first as usual. A
+// Rodrigues vector r is a 3-vector: the rotation axis scaled by the angle. A
+// quaternion q is a 4-vector [w x y z], with the scalar part first. q and -q
+// represent the same rotation. The functions that return quaternions pick the
+// one with w >= 0.
+//
+// Each function optionally reports the gradient of its output with respect to
+// each input. The gradients are computed in the same pass as the output. They
+// are stored row-first, with a row per output element: dR_dr is 9x3, dq_dR is
+// 4x9 and so on. Pass NULL to skip a gradient
+
+// R = I + a*K + b*K^2, where K is the cross-product matrix of r. a = sin(th)/th,
+// b = (1-cos(th))/th^2. Near th=0 I use the Taylor series of these
+static inline void rotation_from_rodrigues(// output
+                                           double* restrict R,
+                                           double* restrict dR_dr, // may be NULL
+
+                                           // input
+                                           const double* restrict r)
+{
+    const double th2 = norm2_vec(3, r);
+    double a, b, da, db; // da, db are (d/dth a)/th, (d/dth b)/th
+
+    if(th2 < 1e-8)
+    {
+        a  =  1.0        - th2/6.0;
+        b  =  0.5        - th2/24.0;
+        da = -1.0/3.0    + th2/30.0;
+        db = -1.0/12.0   + th2/180.0;
+    }
+    else
+    {
+        const double th = sqrt(th2);
+        const double s  = sin(th);
+        const double c  = cos(th);
+        a  = s/th;
+        b  = (1.0 - c)/th2;
+        da = (th*c - s)/(th2*th);
+        db = (th*s - 2.0*(1.0 - c))/(th2*th2);
+    }
+
+    // K and K^2 = r*rt - th2*I
+    const double K[9] =
+        {  0.0,  -r[2],  r[1],
+           r[2],  0.0,  -r[0],
+          -r[1],  r[0],  0.0 };
+    double K2[9];
+    for(int i=0; i<3; i++)
+        for(int j=0; j<3; j++)
+            K2[i*3 + j] = r[i]*r[j] - (i == j ? th2 : 0.0);
+
+    for(int i=0; i<9; i++)
+        R[i] = (i%4 == 0 ? 1.0 : 0.0) + a*K[i] + b*K2[i];
+
+    if(dR_dr == NULL)
+        return;
+
+    // dR/dr_k = a*dK/dr_k + b*dK2/dr_k + r_k*(da*K + db*K2)
+    for(int k=0; k<3; k++)
+    {
+        double dK[9] = {};
+        // dK/dr_k. K[i][j] = -eps_ijk r_k
+        switch(k)
+        {
+        case 0: dK[5] = -1.0; dK[7] =  1.0; break;
+        case 1: dK[2] =  1.0; dK[6] = -1.0; break;
+        case 2: dK[1] = -1.0; dK[3] =  1.0; break;
+        }
+
+        for(int i=0; i<3; i++)
+            for(int j=0; j<3; j++)
+            {
+                // d(r_i r_j - th2 delta_ij)/dr_k
+                const double dK2 =
+                    (i == k ? r[j] : 0.0) + (j == k ? r[i] : 0.0) -
+                    (i == j ? 2.0*r[k] : 0.0);
+                dR_dr[(i*3 + j)*3 + k] =
+                    a*dK[i*3 + j] + b*dK2 +
+                    r[k]*(da*K[i*3 + j] + db*K2[i*3 + j]);
+            }
+    }
+}
+
+// Standard expression, with 2*(...) terms. q should be unit-length. The gradient
+// is of this expression; it does not normalize q
+static inline void rotation_from_quat(// output
+                                      double* restrict R,
+                                      double* restrict dR_dq, // may be NULL
+
+                                      // input
+                                      const double* restrict q)
+{
+    const double w = q[0], x = q[1], y = q[2], z = q[3];
+
+    R[0] = 1.0 - 2.0*(y*y + z*z); R[1] = 2.0*(x*y - w*z);       R[2] = 2.0*(x*z + w*y);
+    R[3] = 2.0*(x*y + w*z);       R[4] = 1.0 - 2.0*(x*x + z*z); R[5] = 2.0*(y*z - w*x);
+    R[6] = 2.0*(x*z - w*y);       R[7] = 2.0*(y*z + w*x);       R[8] = 1.0 - 2.0*(x*x + y*y);
+
+    if(dR_dq == NULL)
+        return;
+
+    const double d[9][4] =
+        { {  0.0,     0.0,    -4.0*y,  -4.0*z },
+          { -2.0*z,   2.0*y,   2.0*x,  -2.0*w },
+          {  2.0*y,   2.0*z,   2.0*w,   2.0*x },
+          {  2.0*z,   2.0*y,   2.0*x,   2.0*w },
+          {  0.0,    -4.0*x,   0.0,    -4.0*z },
+          { -2.0*x,  -2.0*w,   2.0*z,   2.0*y },
+          { -2.0*y,   2.0*z,  -2.0*w,   2.0*x },
+          {  2.0*x,   2.0*w,   2.0*z,   2.0*y },
+          {  0.0,    -4.0*x,  -4.0*y,   0.0   } };
+    for(int i=0; i<9; i++)
+        for(int j=0; j<4; j++)
+            dR_dq[i*4 + j] = d[i][j];
+}
+
+// Shepperd's method: I compute the largest of |w|,|x|,|y|,|z| from the diagonal
+// of R, and the others from the off-diagonal sums and differences. This is
+// well-conditioned for any rotation
+static inline void quat_from_rotation(// output
+                                      double* restrict q,
+                                      double* restrict dq_dR, // may be NULL
+
+                                      // input
+                                      const double* restrict R)
+{
+    // For each choice of the largest component b:
+    // - the signs of R00,R11,R22 in q_b = sqrt(1 +- R00 +- R11 +- R22)/2
+    // - for each component c: q_c = (R[i0] + sign*R[i1]) / (4 q_b)
+    static const struct
+    {
+        double diagsign[3];
+        int    i0[4], i1[4];
+        double sign[4];
+    } cases[4] =
+        { // w largest
+          { { 1, 1, 1},
+            {-1, 7, 2, 3}, {-1, 5, 6, 1}, { 0, -1, -1, -1} },
+          // x largest
+          { { 1,-1,-1},
+            { 7,-1, 1, 2}, { 5,-1, 3, 6}, {-1,  0,  1,  1} },
+          // y largest
+          { {-1, 1,-1},
+            { 2, 1,-1, 5}, { 6, 3,-1, 7}, {-1,  1,  0,  1} },
+          // z largest
+          { {-1,-1, 1},
+            { 3, 2, 5,-1}, { 1, 6, 7,-1}, {-1,  1,  1,  0} } };
+
+    const double tr = R[0] + R[4] + R[8];
+    int b = 0;
+    double biggest = tr;
+    if(R[0] > biggest) { b = 1; biggest = R[0]; }
+    if(R[4] > biggest) { b = 2; biggest = R[4]; }
+    if(R[8] > biggest) { b = 3; }
+
+    const double u  = 1.0 +
+        cases[b].diagsign[0]*R[0] +
+        cases[b].diagsign[1]*R[4] +
+        cases[b].diagsign[2]*R[8];
+    const double qb = 0.5*sqrt(u);
+    const double k  = 0.25/qb;
+
+    for(int c=0; c<4; c++)
+        q[c] = c == b ? qb :
+            k * (R[cases[b].i0[c]] + cases[b].sign[c]*R[cases[b].i1[c]]);
+
+    // I return w >= 0
+    const double flip = q[0] < 0.0 ? -1.0 : 1.0;
+    for(int c=0; c<4; c++)
+        q[c] *= flip;
+
+    if(dq_dR == NULL)
+        return;
+
+    // dq_b/dR_ii = diagsign_i / (8 q_b). dq_c = (dnumerator - 4 q_c dq_b) / (4 q_b)
+    double dqb[9] = {};
+    for(int i=0; i<3; i++)
+        dqb[i*4] = cases[b].diagsign[i] * 0.125/qb;
+
+    for(int c=0; c<4; c++)
+    {
+        for(int j=0; j<9; j++)
+        {
+            if(c == b)
+            {
+                dq_dR[c*9 + j] = flip * dqb[j];
+                continue;
+            }
+
+            // q[] is flipped already, so I un-flip to get the pre-flip q_c
+            double d = -(flip*q[c]) * dqb[j] / qb;
+            if(j == cases[b].i0[c]) d += k;
+            if(j == cases[b].i1[c]) d += k * cases[b].sign[c];
+            dq_dR[c*9 + j] = flip * d;
+        }
+    }
+}
+
+// r = v * th/|v|, where v = [x y z] and th = 2*atan2(|v|, w). Near |v| = 0 I use
+// the Taylor series. Internal; used by rodrigues_from_rotation()
+static inline void minimath_rodrigues_from_quat(// output
+                                                double* restrict r,
+                                                double* restrict dr_dq, // may be NULL
+
+                                                // input
+                                                const double* restrict q)
+{
+    const double w  = q[0];
+    const double* v = &q[1];
+    const double s2 = norm2_vec(3, v);
+    const double n2 = s2 + w*w;
+
+    // f = th/|v|. g = (df/d|v|)/|v|
+    double f, g;
+    if(s2 < 1e-10*w*w)
+    {
+        f =  2.0/w - 2.0*s2/(3.0*w*w*w);
+        g = -4.0/(3.0*w*w*w);
+    }
+    else
+    {
+        const double s = sqrt(s2);
+        f = 2.0*atan2(s, w)/s;
+        g = (2.0*w/n2 - f)/s2;
+    }
+
+    for(int i=0; i<3; i++)
+        r[i] = f*v[i];
+
+    if(dr_dq == NULL)
+        return;
+
+    // df/dw = -2/n2
+    for(int i=0; i<3; i++)
+    {
+        dr_dq[i*4 + 0] = -2.0/n2 * v[i];
+        for(int j=0; j<3; j++)
+            dr_dq[i*4 + 1+j] = (i == j ? f : 0.0) + g*v[i]*v[j];
+    }
+}
+
+// Computed through the quaternion, which is well-conditioned for all rotations,
+// including rotations by ~180 degrees
+static inline void rodrigues_from_rotation(// output
+                                           double* restrict r,
+                                           double* restrict dr_dR, // may be NULL
+
+                                           // input
+                                           const double* restrict R)
+{
+    double q[4];
+    if(dr_dR == NULL)
+    {
+        quat_from_rotation(q, NULL, R);
+        minimath_rodrigues_from_quat(r, NULL, q);
+        return;
+    }
+
+    double dq_dR[4*9], dr_dq[3*4];
+    quat_from_rotation(q, dq_dR, R);
+    minimath_rodrigues_from_quat(r, dr_dq, q);
+
+    for(int i=0; i<3; i++)
+        for(int j=0; j<9; j++)
+            dr_dR[i*9 + j] =
+                dr_dq[i*4 + 0]*dq_dR[0*9 + j] +
+                dr_dq[i*4 + 1]*dq_dR[1*9 + j] +
+                dr_dq[i*4 + 2]*dq_dR[2*9 + j] +
+                dr_dq[i*4 + 3]*dq_dR[3*9 + j];
+}
+
+// q = q0*q1 (the Hamilton product), so that rotation_from_quat(q) =
+// rotation_from_quat(q0) * rotation_from_quat(q1). Since this is bilinear, I don't
+// pick the sign of the result
+static inline void compose_quat(// output
+                                double* restrict q,
+                                double* restrict dq_dq0, // may be NULL
+                                double* restrict dq_dq1, // may be NULL
+
+                                // input
+                                const double* restrict q0,
+                                const double* restrict q1)
+{
+    const double a0 = q0[0], b0 = q0[1], c0 = q0[2], d0 = q0[3];
+    const double a1 = q1[0], b1 = q1[1], c1 = q1[2], d1 = q1[3];
+
+    q[0] = a0*a1 - b0*b1 - c0*c1 - d0*d1;
+    q[1] = a0*b1 + b0*a1 + c0*d1 - d0*c1;
+    q[2] = a0*c1 - b0*d1 + c0*a1 + d0*b1;
+    q[3] = a0*d1 + b0*c1 - c0*b1 + d0*a1;
+
+    if(dq_dq0 != NULL)
+    {
+        const double d[16] =
+            { a1, -b1, -c1, -d1,
+              b1,  a1,  d1, -c1,
+              c1, -d1,  a1,  b1,
+              d1,  c1, -b1,  a1 };
+        for(int i=0; i<16; i++) dq_dq0[i] = d[i];
+    }
+    if(dq_dq1 != NULL)
+    {
+        const double d[16] =
+            { a0, -b0, -c0, -d0,
+              b0,  a0, -d0,  c0,
+              c0,  d0,  a0, -b0,
+              d0, -c0,  b0,  a0 };
+        for(int i=0; i<16; i++) dq_dq1[i] = d[i];
+    }
+}
+
+// P = A*B for 3x3 matrices. Internal; I don't want minimath.h to depend on the
+// sizes chosen for minimath_generated.h
+static inline void minimath_mul_gen33_gen33(double* restrict P,
+                                            const double* restrict A, const double* restrict B)
+{
+    for(int i=0; i<3; i++)
+        for(int j=0; j<3; j++)
+            P[i*3 + j] = A[i*3 + 0]*B[0*3 + j] + A[i*3 + 1]*B[1*3 + j] + A[i*3 + 2]*B[2*3 + j];
+}
+
+// r = rodrigues_from_rotation( rotation_from_rodrigues(r0) *
+//                              rotation_from_rodrigues(r1) )
+static inline void compose_rodrigues(// output
+                                     double* restrict r,
+                                     double* restrict dr_dr0, // may be NULL
+                                     double* restrict dr_dr1, // may be NULL
+
+                                     // input
+                                     const double* restrict r0,
+                                     const double* restrict r1)
+{
+    const int grad = dr_dr0 != NULL || dr_dr1 != NULL;
+
+    double R0[9], R1[9], R[9];
+    double dR0_dr0[9*3], dR1_dr1[9*3], dr_dR[3*9];
+    rotation_from_rodrigues(R0, grad ? dR0_dr0 : NULL, r0);
+    rotation_from_rodrigues(R1, grad ? dR1_dr1 : NULL, r1);
+    minimath_mul_gen33_gen33(R, R0, R1);
+    rodrigues_from_rotation(r, grad ? dr_dR : NULL, R);
+
+    if(!grad)
+        return;
+
+    // dR/dr0_k = dR0/dr0_k * R1, dR/dr1_k = R0 * dR1/dr1_k. Then I apply dr/dR
+    for(int k=0; k<3; k++)
+    {
+        double dR0[9], dR1[9], dR[9];
+        for(int i=0; i<9; i++)
+        {
+            dR0[i] = dR0_dr0[i*3 + k];
+            dR1[i] = dR1_dr1[i*3 + k];
+        }
+
+        if(dr_dr0 != NULL)
+        {
+            minimath_mul_gen33_gen33(dR, dR0, R1);
+            for(int i=0; i<3; i++)
+                dr_dr0[i*3 + k] = dot_vec(9, &dr_dR[i*9], dR);
+        }
+        if(dr_dr1 != NULL)
+        {
+            minimath_mul_gen33_gen33(dR, R0, dR1);
+            for(int i=0; i<3; i++)
+                dr_dr1[i*3 + k] = dot_vec(9, &dr_dR[i*9], dR);
+        }
+    }
+}
+
+// N rotation conversions and compositions (structure-of-arrays): element j of
+// the input or output i lives in x[j*stride + i]. This applies to the gradients
+// also: element j of the row-first dR_dr of rotation i is dR_dr[j*stride + i].
+// The gradients may be NULL, as with the single-rotation functions
+static inline void rotation_from_rodrigues_soaN(int n, int stride,
+
+                                                // output
+                                                double* restrict R,
+                                                double* restrict dR_dr, // may be NULL
+
+                                                // input
+                                                const double* restrict r)
+{
+    MINIMATH_PARALLEL_FOR(n)
+    for(int i=0; i<n; i++)
+    {
+        double ri[3], Ri[9], dRi[9*3];
+        for(int j=0; j<3; j++) ri[j] = r[j*stride + i];
+        rotation_from_rodrigues(Ri, dR_dr ? dRi : NULL, ri);
+        for(int j=0; j<9; j++) R[j*stride + i] = Ri[j];
+        if(dR_dr)
+            for(int j=0; j<9*3; j++) dR_dr[j*stride + i] = dRi[j];
+    }
+}
+static inline void rodrigues_from_rotation_soaN(int n, int stride,
+
+                                                // output
+                                                double* restrict r,
+                                                double* restrict dr_dR, // may be NULL
+
+                                                // input
+                                                const double* restrict R)
+{
+    MINIMATH_PARALLEL_FOR(n)
+    for(int i=0; i<n; i++)
+    {
+        double Ri[9], ri[3], dri[3*9];
+        for(int j=0; j<9; j++) Ri[j] = R[j*stride + i];
+        rodrigues_from_rotation(ri, dr_dR ? dri : NULL, Ri);
+        for(int j=0; j<3; j++) r[j*stride + i] = ri[j];
+        if(dr_dR)
+            for(int j=0; j<3*9; j++) dr_dR[j*stride + i] = dri[j];
+    }
+}
+static inline void rotation_from_quat_soaN(int n, int stride,
+
+                                           // output
+                                           double* restrict R,
+                                           double* restrict dR_dq, // may be NULL
+
+                                           // input
+                                           const double* restrict q)
+{
+    MINIMATH_PARALLEL_FOR(n)
+    for(int i=0; i<n; i++)
+    {
+        double qi[4], Ri[9], dRi[9*4];
+        for(int j=0; j<4; j++) qi[j] = q[j*stride + i];
+        rotation_from_quat(Ri, dR_dq ? dRi : NULL, qi);
+        for(int j=0; j<9; j++) R[j*stride + i] = Ri[j];
+        if(dR_dq)
+            for(int j=0; j<9*4; j++) dR_dq[j*stride + i] = dRi[j];
+    }
+}
+static inline void quat_from_rotation_soaN(int n, int stride,
+
+                                           // output
+                                           double* restrict q,
+                                           double* restrict dq_dR, // may be NULL
+
+                                           // input
+                                           const double* restrict R)
+{
+    MINIMATH_PARALLEL_FOR(n)
+    for(int i=0; i<n; i++)
+    {
+        double Ri[9], qi[4], dqi[4*9];
+        for(int j=0; j<9; j++) Ri[j] = R[j*stride + i];
+        quat_from_rotation(qi, dq_dR ? dqi : NULL, Ri);
+        for(int j=0; j<4; j++) q[j*stride + i] = qi[j];
+        if(dq_dR)
+            for(int j=0; j<4*9; j++) dq_dR[j*stride + i] = dqi[j];
+    }
+}
+static inline void compose_quat_soaN(int n, int stride,
+
+                                     // output
+                                     double* restrict q,
+                                     double* restrict dq_dq0, // may be NULL
+                                     double* restrict dq_dq1, // may be NULL
+
+                                     // input
+                                     const double* restrict q0,
+                                     const double* restrict q1)
+{
+    MINIMATH_PARALLEL_FOR(n)
+    for(int i=0; i<n; i++)
+    {
+        double q0i[4], q1i[4], qi[4], d0[4*4], d1[4*4];
+        for(int j=0; j<4; j++)
+        {
+            q0i[j] = q0[j*stride + i];
+            q1i[j] = q1[j*stride + i];
+        }
+        compose_quat(qi, dq_dq0 ? d0 : NULL, dq_dq1 ? d1 : NULL, q0i, q1i);
+        for(int j=0; j<4; j++) q[j*stride + i] = qi[j];
+        if(dq_dq0)
+            for(int j=0; j<4*4; j++) dq_dq0[j*stride + i] = d0[j];
+        if(dq_dq1)
+            for(int j=0; j<4*4; j++) dq_dq1[j*stride + i] = d1[j];
+    }
+}
+static inline void compose_rodrigues_soaN(int n, int stride,
+
+                                          // output
+                                          double* restrict r,
+                                          double* restrict dr_dr0, // may be NULL
+                                          double* restrict dr_dr1, // may be NULL
+
+                                          // input
+                                          const double* restrict r0,
+                                          const double* restrict r1)
+{
+    MINIMATH_PARALLEL_FOR(n)
+    for(int i=0; i<n; i++)
+    {
+        double r0i[3], r1i[3], ri[3], d0[3*3], d1[3*3];
+        for(int j=0; j<3; j++)
+        {
+            r0i[j] = r0[j*stride + i];
+            r1i[j] = r1[j*stride + i];
+        }
+        compose_rodrigues(ri, dr_dr0 ? d0 : NULL, dr_dr1 ? d1 : NULL, r0i, r1i);
+        for(int j=0; j<3; j++) r[j*stride + i] = ri[j];
+        if(dr_dr0)
+            for(int j=0; j<3*3; j++) dr_dr0[j*stride + i] = d0[j];
+        if(dr_dr1)
+            for(int j=0; j<3*3; j++) dr_dr1[j*stride + i] = d1[j];
+    }
+}
+
+// Rigid transforms. An Rt transform is a 3x3 rotation R followed by a
+// translation t, stored in a double[12]: R row-first, then t. Like the 3x4
+// matrix [R t], except t is contiguous. It maps a point x to R*x + t. For row
+// vectors, as used everywhere else in this library, this is x*Rt + t. The
+// rotation and translation are applied in one pass over the points
+
+// Transforms a 3-vector: vout = R*x + t
+static inline void transform_vec3_Rt_vout(const double* restrict x, const double* restrict Rt, double* restrict vout)
+{
+    vout[0] = Rt[0]*x[0] + Rt[1]*x[1] + Rt[2]*x[2] + Rt[ 9];
+    vout[1] = Rt[3]*x[0] + Rt[4]*x[1] + Rt[5]*x[2] + Rt[10];
+    vout[2] = Rt[6]*x[0] + Rt[7]*x[1] + Rt[8]*x[2] + Rt[11];
+}
+static inline void transform_vec3_Rt(double* restrict x, const double* restrict Rt)
+{
+    double t[3];
+    transform_vec3_Rt_vout(x, Rt, t);
+    x[0] = t[0];
+    x[1] = t[1];
+    x[2] = t[2];
+}
+
+// Transforms N points stored contiguously, as an Nx3 matrix
+static inline void transform_genN3_Rt_vout(int n, const double* restrict x, const double* restrict Rt, double* restrict vout)
+{
+    MINIMATH_PARALLEL_FOR(n)
+    for(int i=0; i<n; i++)
+        transform_vec3_Rt_vout(x + 3*i, Rt, vout + 3*i);
+}
+static inline void transform_genN3_Rt(int n, double* restrict x, const double* restrict Rt)
+{
+    MINIMATH_PARALLEL_FOR(n)
+    for(int i=0; i<n; i++)
+        transform_vec3_Rt(x + 3*i, Rt);
+}
+
+// Transforms N points in a structure-of-arrays layout: coordinate j of point i
+// lives in x[j*stride + i]. The output uses the same layout
+static inline void transform_soaN3_Rt_vout(int n, int stride, const double* restrict x, const double* restrict Rt, double* restrict vout)
+{
+    const double r00 = Rt[0], r01 = Rt[1], r02 = Rt[2];
+    const double r10 = Rt[3], r11 = Rt[4], r12 = Rt[5];
+    const double r20 = Rt[6], r21 = Rt[7], r22 = Rt[8];
+    const double t0  = Rt[9], t1  = Rt[10], t2 = Rt[11];
+    MINIMATH_PARALLEL_FOR(n)
+    for(int i=0; i<n; i++)
+    {
+        const double x0 = x[0*stride + i];
+        const double x1 = x[1*stride + i];
+        const double x2 = x[2*stride + i];
+        vout[0*stride + i] = r00*x0 + r01*x1 + r02*x2 + t0;
+        vout[1*stride + i] = r10*x0 + r11*x1 + r12*x2 + t1;
+        vout[2*stride + i] = r20*x0 + r21*x1 + r22*x2 + t2;
+    }
+}
+static inline void transform_soaN3_Rt(int n, int stride, double* restrict x, const double* restrict Rt)
+{
+    const double r00 = Rt[0], r01 = Rt[1], r02 = Rt[2];
+    const double r10 = Rt[3], r11 = Rt[4], r12 = Rt[5];
+    const double r20 = Rt[6], r21 = Rt[7], r22 = Rt[8];
+    const double t0  = Rt[9], t1  = Rt[10], t2 = Rt[11];
+    MINIMATH_PARALLEL_FOR(n)
+    for(int i=0; i<n; i++)
+    {
+        const double x0 = x[0*stride + i];
+        const double x1 = x[1*stride + i];
+        const double x2 = x[2*stride + i];
+        x[0*stride + i] = r00*x0 + r01*x1 + r02*x2 + t0;
+        x[1*stride + i] = r10*x0 + r11*x1 + r12*x2 + t1;
+        x[2*stride + i] = r20*x0 + r21*x1 + r22*x2 + t2;
+    }
+}
+
+// Composition: vout = Rt0*Rt1, the transform that applies Rt1 and then Rt0. So
+// R = R0*R1 and t = R0*t1 + t0
+static inline void compose_Rt_vout(const double* restrict Rt0, const double* restrict Rt1, double* restrict vout)
+{
+    minimath_mul_gen33_gen33(vout, Rt0, Rt1);
+    transform_vec3_Rt_vout(&Rt1[9], Rt0, &vout[9]);
+}
+// Rt0 = Rt0*Rt1
+static inline void compose_Rt(double* restrict Rt0, const double* restrict Rt1)
+{
+    double t[12];
+    compose_Rt_vout(Rt0, Rt1, t);
+    for(int i=0; i<12; i++) Rt0[i] = t[i];
+}
+
+// Inverse: R -> Rt, t -> -Rt*t. Assumes R is a rotation
+static inline void invert_Rt_vout(const double* restrict Rt, double* restrict vout)
+{
+    for(int i=0; i<3; i++)
+        for(int j=0; j<3; j++)
+            vout[i*3 + j] = Rt[j*3 + i];
+    for(int i=0; i<3; i++)
+        vout[9 + i] = -(Rt[0*3 + i]*Rt[9] + Rt[1*3 + i]*Rt[10] + Rt[2*3 + i]*Rt[11]);
+}
+static inline void invert_Rt(double* restrict Rt)
+{
+    double t[12];
+    invert_Rt_vout(Rt, t);
+    for(int i=0; i<12; i++) Rt[i] = t[i];
+}
+
+// N compositions and inversions. The transforms are stored contiguously:
+// transform i is in Rt[12*i .. 12*i+11]
+static inline void compose_batchN_Rt_vout(int n, const double* restrict Rt0, const double* restrict Rt1, double* restrict vout)
+{
+    MINIMATH_PARALLEL_FOR(n)
+    for(int i=0; i<n; i++)
+        compose_Rt_vout(Rt0 + 12*i, Rt1 + 12*i, vout + 12*i);
+}
+static inline void compose_batchN_Rt(int n, double* restrict Rt0, const double* restrict Rt1)
+{
+    MINIMATH_PARALLEL_FOR(n)
+    for(int i=0; i<n; i++)
+        compose_Rt(Rt0 + 12*i, Rt1 + 12*i);
+}
+static inline void invert_batchN_Rt_vout(int n, const double* restrict Rt, double* restrict vout)
+{
+    MINIMATH_PARALLEL_FOR(n)
+    for(int i=0; i<n; i++)
+        invert_Rt_vout(Rt + 12*i, vout + 12*i);
+}
+static inline void invert_batchN_Rt(int n, double* restrict Rt)
+{
+    MINIMATH_PARALLEL_FOR(n)
+    for(int i=0; i<n; i++)
+        invert_Rt(Rt + 12*i);
+}
+
+// Batches of small matrices and vectors in an array-of-structures-of-arrays
+// layout. Each block holds MINIMATH_LANES objects, stored structure-of-arrays:
+// element j of object i of the block lives in x[j][i]. So x[0] of a block can be
+// given directly to the ..._soaN...() kernels, with stride = MINIMATH_LANES.
+// Each element row is contiguous across the lanes, so these are full aligned
+// vector loads, and a stream of blocks uses whole cache lines. The blocks are
+// aligned to 64 bytes. Arrays of blocks on the heap should be allocated with
+// aligned_alloc() to maintain that.
+//
+// The ..._pack() functions convert n objects in the usual packed layout (6
+// doubles per sym33 and so on, back-to-back) into aosoa_nblocks(n) blocks.
+// Unused lanes in the last block are filled with copies of the last object, so
+// the kernels can always process whole blocks without hitting garbage, and
+// with a compile-time trip count. The ..._unpack() functions do the reverse
+typedef struct { double x[ 3][MINIMATH_LANES]; } __attribute__((aligned(64))) aosoa_vec3;
+typedef struct { double x[ 6][MINIMATH_LANES]; } __attribute__((aligned(64))) aosoa_sym33;
+typedef struct { double x[ 9][MINIMATH_LANES]; } __attribute__((aligned(64))) aosoa_gen33;
+typedef struct { double x[21][MINIMATH_LANES]; } __attribute__((aligned(64))) aosoa_sym66;
+
+// The number of blocks needed to store n objects
+static inline int aosoa_nblocks(int n)
+{
+    return (n + MINIMATH_LANES - 1) / MINIMATH_LANES;
+}
+// The number of valid objects in block b of a batch of n objects. This is
+// MINIMATH_LANES, except possibly for the last block
+static inline int aosoa_block_lanes(int n, int b)
+{
+    const int nleft = n - b*MINIMATH_LANES;
+    return nleft < MINIMATH_LANES ? nleft : MINIMATH_LANES;
+}
+
+// Internal. blocks is an array of blocks, each nelem*MINIMATH_LANES doubles
+static inline void minimath_aosoa_pack(int n, int nelem,
+                                       // output
+                                       double* restrict blocks,
+                                       // input
+                                       const double* restrict v)
+{
+    for(int b=0; b<aosoa_nblocks(n); b++)
+    {
+        double* restrict block = &blocks[b*nelem*MINIMATH_LANES];
+        for(int lane=0; lane<MINIMATH_LANES; lane++)
+        {
+            int i = b*MINIMATH_LANES + lane;
+            if(i >= n) i = n-1;
+            for(int j=0; j<nelem; j++)
+                block[j*MINIMATH_LANES + lane] = v[i*nelem + j];
+        }
+    }
+}
+static inline void minimath_aosoa_unpack(int n, int nelem,
+                                         // output
+                                         double* restrict v,
+                                         // input
+                                         const double* restrict blocks)
+{
+    for(int b=0; b<aosoa_nblocks(n); b++)
+    {
+        const double* restrict block = &blocks[b*nelem*MINIMATH_LANES];
+        for(int lane=0; lane<aosoa_block_lanes(n, b); lane++)
+        {
+            const int i = b*MINIMATH_LANES + lane;
+            for(int j=0; j<nelem; j++)
+                v[i*nelem + j] = block[j*MINIMATH_LANES + lane];
+        }
+    }
+}
+
+static inline void aosoa_vec3_pack(int n, aosoa_vec3* restrict blocks, const double* restrict v)
+{
+    minimath_aosoa_pack(n, 3, blocks[0].x[0], v);
+}
+static inline void aosoa_vec3_unpack(int n, double* restrict v, const aosoa_vec3* restrict blocks)
+{
+    minimath_aosoa_unpack(n, 3, v, blocks[0].x[0]);
+}
+static inline void aosoa_sym33_pack(int n, aosoa_sym33* restrict blocks, const double* restrict s)
+{
+    minimath_aosoa_pack(n, 6, blocks[0].x[0], s);
+}
+static inline void aosoa_sym33_unpack(int n, double* restrict s, const aosoa_sym33* restrict blocks)
+{
+    minimath_aosoa_unpack(n, 6, s, blocks[0].x[0]);
+}
+static inline void aosoa_gen33_pack(int n, aosoa_gen33* restrict blocks, const double* restrict m)
+{
+    minimath_aosoa_pack(n, 9, blocks[0].x[0], m);
+}
+static inline void aosoa_gen33_unpack(int n, double* restrict m, const aosoa_gen33* restrict blocks)
+{
+    minimath_aosoa_unpack(n, 9, m, blocks[0].x[0]);
+}
+static inline void aosoa_sym66_pack(int n, aosoa_sym66* restrict blocks, const double* restrict s)
+{
+    minimath_aosoa_pack(n, 21, blocks[0].x[0], s);
+}
+static inline void aosoa_sym66_unpack(int n, double* restrict s, const aosoa_sym66* restrict blocks)
+{
+    minimath_aosoa_unpack(n, 21, s, blocks[0].x[0]);
+}
+
 #ifdef __cplusplus
 #undef restrict
 #endif
@@ -0,0 +1,1924 @@
+// THIS IS AUTO-GENERATED BY ./minimath_generate.pl FROM minimath.h. DO NOT EDIT BY HAND
+
+#pragma once
+
+#ifdef __cplusplus
+#define restrict
+#endif
+
+
+#include <math.h>
+#include <stddef.h>
+
+#include "minimath_generated_f.h"
+
+// In all the following computations I use the expression obtained before a
+// maxima expand(). factorsum()-ing the result doesn't appear to do much.  Doing
+// an expand() greatly increases the number of multiplications, but reduces the
+// number of additions. In the specific case of a 4x4 symmetric determinant,
+// expand() changes (23,40) to (16,58) +,*. 18 more *, but 7 fewer +.
+// Session:
+/*
+(%i13) display2d : false;
+(%o13) false
+
+(%i31) sym2 : matrix([m0,m1],
+                     [m1,m2]);
+
+(%o31) matrix([m0,m1],[m1,m2])
+(%i32) sym3 : matrix([m0,m1,m2],
+                     [m1,m3,m4],
+                     [m2,m4,m5]);
+
+(%o32) matrix([m0,m1,m2],[m1,m3,m4],[m2,m4,m5])
+(%i33) sym4 : matrix([m0,m1,m2,m3],
+                     [m1,m4,m5,m6],
+                     [m2,m5,m7,m8],
+                     [m3,m6,m8,m9]);
+(%i99) sym5 : matrix([m0,m1,m2, m3, m4 ],
+                     [m1,m5,m6, m7, m8 ],
+                     [m2,m6,m9, m10,m11],
+                     [m3,m7,m10,m12,m13],
+                     [m4,m8,m11,m13,m14]);
+
+(%o99) matrix([m0,m1,m2,m3,m4],[m1,m5,m6,m7,m8],[m2,m6,m9,m10,m11],
+              [m3,m7,m10,m12,m13],[m4,m8,m11,m13,m14])
+
+(%i34) determinant(sym4);
+
+(%o34) m0*(m4*(m7*m9-m8^2)-m5*(m5*m9-m6*m8)+m6*(m5*m8-m6*m7))
+        -m1*(m1*(m7*m9-m8^2)-m5*(m2*m9-m3*m8)+m6*(m2*m8-m3*m7))
+        +m2*(m1*(m5*m9-m6*m8)-m4*(m2*m9-m3*m8)+m6*(m2*m6-m3*m5))
+        -m3*(m1*(m5*m8-m6*m7)-m4*(m2*m8-m3*m7)+m5*(m2*m6-m3*m5))
+(%i35) expand(determinant(sym4));
+
+(%o35) m0*m4*m7*m9-m1^2*m7*m9-m0*m5^2*m9+2*m1*m2*m5*m9-m2^2*m4*m9-m0*m4*m8^2
+                  +m1^2*m8^2+2*m0*m5*m6*m8-2*m1*m2*m6*m8-2*m1*m3*m5*m8
+                  +2*m2*m3*m4*m8-m0*m6^2*m7+2*m1*m3*m6*m7-m3^2*m4*m7+m2^2*m6^2
+                  -2*m2*m3*m5*m6+m3^2*m5^2
+*/
+
+/* The session to compute the determinants appears above. The only postprocessing was to
+   replace m.^2 -> m.*m, m. -> m[.]
+
+(%i36) determinant(sym2);
+
+(%o36) m0*m2-m1^2
+(%i37) determinant(sym3);
+
+(%o37) m0*(m3*m5-m4^2)-m1*(m1*m5-m2*m4)+m2*(m1*m4-m2*m3)
+(%i38) determinant(sym4);
+
+(%o38) m0*(m4*(m7*m9-m8^2)-m5*(m5*m9-m6*m8)+m6*(m5*m8-m6*m7))
+        -m1*(m1*(m7*m9-m8^2)-m5*(m2*m9-m3*m8)+m6*(m2*m8-m3*m7))
+        +m2*(m1*(m5*m9-m6*m8)-m4*(m2*m9-m3*m8)+m6*(m2*m6-m3*m5))
+        -m3*(m1*(m5*m8-m6*m7)-m4*(m2*m8-m3*m7)+m5*(m2*m6-m3*m5))
+
+(%i100) determinant(sym5);
+
+(%o100) -m3*(-m8*((m3*m8-m4*m7)*m9+m2*(m11*m7-m10*m8)-(m11*m3-m10*m4)*m6)
+            +m1*(-(m14*m7-m13*m8)*m9+m11*(m11*m7-m10*m8)+(m10*m14-m11*m13)*m6)
+            -m5*(-(m14*m3-m13*m4)*m9+m11*(m11*m3-m10*m4)+(m10*m14-m11*m13)*m2)
+            +m6*(m11*(m3*m8-m4*m7)+m2*(m14*m7-m13*m8)-(m14*m3-m13*m4)*m6))
+         +m4*(-m7*((m3*m8-m4*m7)*m9+m2*(m11*m7-m10*m8)-(m11*m3-m10*m4)*m6)
+             +m1*(-(m13*m7-m12*m8)*m9+m10*(m11*m7-m10*m8)
+                                     +(m10*m13-m11*m12)*m6)
+             -m5*(-(m13*m3-m12*m4)*m9+m10*(m11*m3-m10*m4)
+                                     +(m10*m13-m11*m12)*m2)
+             +m6*(m10*(m3*m8-m4*m7)+m2*(m13*m7-m12*m8)-(m13*m3-m12*m4)*m6))
+         +m0*(m7*(-(m14*m7-m13*m8)*m9+m11*(m11*m7-m10*m8)
+                                     +(m10*m14-m11*m13)*m6)
+             -m8*(-(m13*m7-m12*m8)*m9+m10*(m11*m7-m10*m8)
+                                     +(m10*m13-m11*m12)*m6)
+             +m5*((m12*m14-m13^2)*m9-m10*(m10*m14-m11*m13)
+                                    +m11*(m10*m13-m11*m12))
+             -m6*(-m10*(m14*m7-m13*m8)+m11*(m13*m7-m12*m8)
+                                      +(m12*m14-m13^2)*m6))
+         -m1*(m7*(-(m14*m3-m13*m4)*m9+m11*(m11*m3-m10*m4)
+                                     +(m10*m14-m11*m13)*m2)
+             -m8*(-(m13*m3-m12*m4)*m9+m10*(m11*m3-m10*m4)
+                                     +(m10*m13-m11*m12)*m2)
+             +m1*((m12*m14-m13^2)*m9-m10*(m10*m14-m11*m13)
+                                    +m11*(m10*m13-m11*m12))
+             -(-m10*(m14*m3-m13*m4)+m11*(m13*m3-m12*m4)+(m12*m14-m13^2)*m2)
+              *m6)
+         +m2*(m7*(m11*(m3*m8-m4*m7)+m2*(m14*m7-m13*m8)-(m14*m3-m13*m4)*m6)
+             -m8*(m10*(m3*m8-m4*m7)+m2*(m13*m7-m12*m8)-(m13*m3-m12*m4)*m6)
+             +m1*(-m10*(m14*m7-m13*m8)+m11*(m13*m7-m12*m8)+(m12*m14-m13^2)*m6)
+             -(-m10*(m14*m3-m13*m4)+m11*(m13*m3-m12*m4)+(m12*m14-m13^2)*m2)
+              *m5)
+
+*/
+
+#if 0
+#error You really should be using the cofactors functions below to do this. So far Ive only needed the determinant as a part of computing the inverse, and the below functions do this much more efficiently
+static inline float det_sym2_f(const float* m)
+{
+  return m[0]*m[2]-m[1]*m[1];
+}
+static inline float det_sym3_f(const float* m)
+{
+  return m[0]*(m[3]*m[5]-m[4]*m[4])-m[1]*(m[1]*m[5]-m[2]*m[4])+m[2]*(m[1]*m[4]-m[2]*m[3]);
+}
+static inline float det_sym4_f(const float* m)
+{
+  return
+    +m[0]*(m[4]*(m[7]*m[9]-m[8]*m[8])-m[5]*(m[5]*m[9]-m[6]*m[8])+m[6]*(m[5]*m[8]-m[6]*m[7]))
+    -m[1]*(m[1]*(m[7]*m[9]-m[8]*m[8])-m[5]*(m[2]*m[9]-m[3]*m[8])+m[6]*(m[2]*m[8]-m[3]*m[7]))
+    +m[2]*(m[1]*(m[5]*m[9]-m[6]*m[8])-m[4]*(m[2]*m[9]-m[3]*m[8])+m[6]*(m[2]*m[6]-m[3]*m[5]))
+    -m[3]*(m[1]*(m[5]*m[8]-m[6]*m[7])-m[4]*(m[2]*m[8]-m[3]*m[7])+m[5]*(m[2]*m[6]-m[3]*m[5]));
+}
+static inline float det_sym5_f(const float* m)
+{
+  return
+    -m[3]*(-m[8]*((m[3]*m[8]-m[4]*m[7])*m[9]+m[2]*(m[11]*m[7]-m[10]*m[8])-(m[11]*m[3]-m[10]*m[4])*m[6])
+           +m[1]*(-(m[14]*m[7]-m[13]*m[8])*m[9]+m[11]*(m[11]*m[7]-m[10]*m[8])+(m[10]*m[14]-m[11]*m[13])*m[6])
+           -m[5]*(-(m[14]*m[3]-m[13]*m[4])*m[9]+m[11]*(m[11]*m[3]-m[10]*m[4])+(m[10]*m[14]-m[11]*m[13])*m[2])
+           +m[6]*(m[11]*(m[3]*m[8]-m[4]*m[7])+m[2]*(m[14]*m[7]-m[13]*m[8])-(m[14]*m[3]-m[13]*m[4])*m[6]))
+    +m[4]*(-m[7]*((m[3]*m[8]-m[4]*m[7])*m[9]+m[2]*(m[11]*m[7]-m[10]*m[8])-(m[11]*m[3]-m[10]*m[4])*m[6])
+           +m[1]*(-(m[13]*m[7]-m[12]*m[8])*m[9]+m[10]*(m[11]*m[7]-m[10]*m[8])
+                  +(m[10]*m[13]-m[11]*m[12])*m[6])
+           -m[5]*(-(m[13]*m[3]-m[12]*m[4])*m[9]+m[10]*(m[11]*m[3]-m[10]*m[4])
+                  +(m[10]*m[13]-m[11]*m[12])*m[2])
+           +m[6]*(m[10]*(m[3]*m[8]-m[4]*m[7])+m[2]*(m[13]*m[7]-m[12]*m[8])-(m[13]*m[3]-m[12]*m[4])*m[6]))
+    +m[0]*(m[7]*(-(m[14]*m[7]-m[13]*m[8])*m[9]+m[11]*(m[11]*m[7]-m[10]*m[8])
+                 +(m[10]*m[14]-m[11]*m[13])*m[6])
+           -m[8]*(-(m[13]*m[7]-m[12]*m[8])*m[9]+m[10]*(m[11]*m[7]-m[10]*m[8])
+                  +(m[10]*m[13]-m[11]*m[12])*m[6])
+           +m[5]*((m[12]*m[14]-m[13]*m[13])*m[9]-m[10]*(m[10]*m[14]-m[11]*m[13])
+                  +m[11]*(m[10]*m[13]-m[11]*m[12]))
+           -m[6]*(-m[10]*(m[14]*m[7]-m[13]*m[8])+m[11]*(m[13]*m[7]-m[12]*m[8])
+                  +(m[12]*m[14]-m[13]*m[13])*m[6]))
+    -m[1]*(m[7]*(-(m[14]*m[3]-m[13]*m[4])*m[9]+m[11]*(m[11]*m[3]-m[10]*m[4])
+                 +(m[10]*m[14]-m[11]*m[13])*m[2])
+           -m[8]*(-(m[13]*m[3]-m[12]*m[4])*m[9]+m[10]*(m[11]*m[3]-m[10]*m[4])
+                  +(m[10]*m[13]-m[11]*m[12])*m[2])
+           +m[1]*((m[12]*m[14]-m[13]*m[13])*m[9]-m[10]*(m[10]*m[14]-m[11]*m[13])
+                  +m[11]*(m[10]*m[13]-m[11]*m[12]))
+           -(-m[10]*(m[14]*m[3]-m[13]*m[4])+m[11]*(m[13]*m[3]-m[12]*m[4])+(m[12]*m[14]-m[13]*m[13])*m[2])
+           *m[6])
+    +m[2]*(m[7]*(m[11]*(m[3]*m[8]-m[4]*m[7])+m[2]*(m[14]*m[7]-m[13]*m[8])-(m[14]*m[3]-m[13]*m[4])*m[6])
+           -m[8]*(m[10]*(m[3]*m[8]-m[4]*m[7])+m[2]*(m[13]*m[7]-m[12]*m[8])-(m[13]*m[3]-m[12]*m[4])*m[6])
+           +m[1]*(-m[10]*(m[14]*m[7]-m[13]*m[8])+m[11]*(m[13]*m[7]-m[12]*m[8])+(m[12]*m[14]-m[13]*m[13])*m[6])
+           -(-m[10]*(m[14]*m[3]-m[13]*m[4])+m[11]*(m[13]*m[3]-m[12]*m[4])+(m[12]*m[14]-m[13]*m[13])*m[2])
+           *m[5]);
+}
+#endif
+
+/* I now do inverses. I return transposed cofactors. Original matrix * cofactors / det = identity
+As before, I replaced  m.^2 -> m.*m, m. -> m[.]
+I also removed the lower triangle, since I'm dealing with symmetric matrices here
+Session:
+
+
+(%i64) num( ev(invert(sym2),detout) );
+
+(%o64) matrix([m2,-m1],[-m1,m0])
+(%i65) num( ev(invert(sym3),detout) );
+
+(%o65) matrix([m3*m5-m4^2,m2*m4-m1*m5,m1*m4-m2*m3],
+              [m2*m4-m1*m5,m0*m5-m2^2,m1*m2-m0*m4],
+              [m1*m4-m2*m3,m1*m2-m0*m4,m0*m3-m1^2])
+
+The 4x4, 5x5 and 6x6 versions are generated by minimath_generate.pl. The
+expressions that maxima produces for those recompute the same small minors many
+times; the generated versions compute each minor only once
+*/
+
+static inline float cofactors_sym2_f(const float* restrict m, float* restrict c)
+{
+  c[0] = m[2];
+  c[1] = -m[1];
+  c[2] = -m[1];
+
+  return m[0]*c[0] + m[1]*c[1];
+}
+
+static inline float cofactors_sym3_f(const float* restrict m, float* restrict c)
+{
+  c[0] = m[3]*m[5]-m[4]*m[4];
+  c[1] = m[2]*m[4]-m[1]*m[5];
+  c[2] = m[1]*m[4]-m[2]*m[3];
+  c[3] = m[0]*m[5]-m[2]*m[2];
+  c[4] = m[1]*m[2]-m[0]*m[4];
+  c[5] = m[0]*m[3]-m[1]*m[1];
+
+  return m[0]*c[0] + m[1]*c[1] + m[2]*c[2];
+}
+
+/*
+The upper-triangular and lower-triangular routines have a similar API to the
+symmetric ones. Note that as with symmetric matrices, we don't store redundant
+data, and we store data row-first. So the upper-triangular matrices have N
+elements in the first row in memory, but lower-triangular matrices have only 1.f
+
+Inverses of triangular matrices are similarly triangular, and that's how I store
+them
+
+
+Session:
+
+// upper triangular
+(%i2) ut2 : matrix([m0,m1],[0,m2]);
+
+(%o2) matrix([m0,m1],[0,m2])
+(%i3) ut3 : matrix([m0,m1,m2],[0,m3,m4],[0,0,m5]);
+
+(%o3) matrix([m0,m1,m2],[0,m3,m4],[0,0,m5])
+(%i4) ut4 : matrix([m0,m1,m2,m3],[0,m4,m5,m6],[0,0,m7,m8],[0,0,0,m9]);
+
+(%o4) matrix([m0,m1,m2,m3],[0,m4,m5,m6],[0,0,m7,m8],[0,0,0,m9])
+(%i5) ut5 : matrix([m0,m1,m2,m3,m4],[0,m5,m6,m7,m8],[0,0,m9,m10,m11],[0,0,0,m12,m13],[0,0,0,0,m14]);
+
+(%o5) matrix([m0,m1,m2,m3,m4],[0,m5,m6,m7,m8],[0,0,m9,m10,m11],
+             [0,0,0,m12,m13],[0,0,0,0,m14])
+
+(%i11) num( ev(invert(ut2),detout) );
+
+(%o11) matrix([m2,-m1],[0,m0])
+(%i12) num( ev(invert(ut3),detout) );
+
+(%o12) matrix([m3*m5,-m1*m5,m1*m4-m2*m3],[0,m0*m5,-m0*m4],[0,0,m0*m3])
+(%i13) num( ev(invert(ut4),detout) );
+
+(%o13) matrix([m4*m7*m9,-m1*m7*m9,m1*m5*m9-m2*m4*m9,
+               (-m1*(m5*m8-m6*m7))+m2*m4*m8-m3*m4*m7],
+              [0,m0*m7*m9,-m0*m5*m9,m0*(m5*m8-m6*m7)],
+              [0,0,m0*m4*m9,-m0*m4*m8],[0,0,0,m0*m4*m7])
+(%i14) num( ev(invert(ut5),detout) );
+
+(%o14) matrix([m12*m14*m5*m9,-m1*m12*m14*m9,m1*m12*m14*m6-m12*m14*m2*m5,
+               (-m1*(m10*m14*m6-m14*m7*m9))-m14*m3*m5*m9+m10*m14*m2*m5,
+               m1*(m12*m8*m9-m13*m7*m9+(m10*m13-m11*m12)*m6)
+                -m12*m4*m5*m9+m13*m3*m5*m9-(m10*m13-m11*m12)*m2*m5],
+              [0,m0*m12*m14*m9,-m0*m12*m14*m6,m0*(m10*m14*m6-m14*m7*m9),
+               -m0*(m12*m8*m9-m13*m7*m9+(m10*m13-m11*m12)*m6)],
+              [0,0,m0*m12*m14*m5,-m0*m10*m14*m5,m0*(m10*m13-m11*m12)*m5],
+              [0,0,0,m0*m14*m5*m9,-m0*m13*m5*m9],[0,0,0,0,m0*m12*m5*m9])
+
+
+// lower-triangular
+(%i19) lt2 : matrix([m0,0],[m1,m2]);
+
+(%o19) matrix([m0,0],[m1,m2])
+(%i20) lt3 : matrix([m0,0,0],[m1,m2,0],[m3,m4,m5]);
+
+(%o20) matrix([m0,0,0],[m1,m2,0],[m3,m4,m5])
+(%i21) lt4 : matrix([m0,0,0,0],[m1,m2,0,0],[m3,m4,m5,0],[m6,m7,m8,m9]);
+
+(%o21) matrix([m0,0,0,0],[m1,m2,0,0],[m3,m4,m5,0],[m6,m7,m8,m9])
+(%i22) lt5 : matrix([m0,0,0,0,0],[m1,m2,0,0,0],[m3,m4,m5,0,0],[m6,m7,m8,m9,0],[m10,m11,m12,m13,m14]);
+
+(%o22) matrix([m0,0,0,0,0],[m1,m2,0,0,0],[m3,m4,m5,0,0],[m6,m7,m8,m9,0],
+              [m10,m11,m12,m13,m14])
+(%i23) num( ev(invert(lt2),detout) );
+
+(%o23) matrix([m2,0],[-m1,m0])
+(%i24) num( ev(invert(lt3),detout) );
+
+(%o24) matrix([m2*m5,0,0],[-m1*m5,m0*m5,0],[m1*m4-m2*m3,-m0*m4,m0*m2])
+(%i25) num( ev(invert(lt4),detout) );
+
+(%o25) matrix([m2*m5*m9,0,0,0],[-m1*m5*m9,m0*m5*m9,0,0],
+              [m1*m4*m9-m2*m3*m9,-m0*m4*m9,m0*m2*m9,0],
+              [m2*(m3*m8-m5*m6)-m1*(m4*m8-m5*m7),m0*(m4*m8-m5*m7),-m0*m2*m8,
+               m0*m2*m5])
+(%i26) num( ev(invert(lt5),detout) );
+
+(%o26) matrix([m14*m2*m5*m9,0,0,0,0],[-m1*m14*m5*m9,m0*m14*m5*m9,0,0,0],
+              [m1*m14*m4*m9-m14*m2*m3*m9,-m0*m14*m4*m9,m0*m14*m2*m9,0,0],
+              [m2*(m14*m3*m8-m14*m5*m6)-m1*(m14*m4*m8-m14*m5*m7),
+               m0*(m14*m4*m8-m14*m5*m7),-m0*m14*m2*m8,m0*m14*m2*m5,0],
+              [m1*(m4*(m13*m8-m12*m9)-m5*(m13*m7-m11*m9))
+                -m2*(m3*(m13*m8-m12*m9)-m5*(m13*m6-m10*m9)),
+               -m0*(m4*(m13*m8-m12*m9)-m5*(m13*m7-m11*m9)),
+               m0*m2*(m13*m8-m12*m9),-m0*m13*m2*m5,m0*m2*m5*m9])
+
+ */
+static inline float cofactors_ut2_f(const float* restrict m, float* restrict c)
+{
+    int i=0;
+    c[i++] = m[2];
+    c[i++] = -m[1];
+    c[i++] = m[0];
+    return m[0]*m[2];
+}
+static inline float cofactors_ut3_f(const float* restrict m, float* restrict c)
+{
+    int i=0;
+    c[i++] = m[3]*m[5];
+    c[i++] = -m[1]*m[5];
+    c[i++] = m[1]*m[4]-m[2]*m[3];
+    c[i++] = m[0]*m[5];
+    c[i++] = -m[0]*m[4];
+    c[i++] = m[0]*m[3];
+    return m[0]*m[3]*m[5];
+}
+static inline float cofactors_ut4_f(const float* restrict m, float* restrict c)
+{
+    int i=0;
+    c[i++] = m[4]*m[7]*m[9];
+    c[i++] = -m[1]*m[7]*m[9];
+    c[i++] = m[1]*m[5]*m[9]-m[2]*m[4]*m[9];
+    c[i++] = (-m[1]*(m[5]*m[8]-m[6]*m[7]))+m[2]*m[4]*m[8]-m[3]*m[4]*m[7];
+    c[i++] = m[0]*m[7]*m[9];
+    c[i++] = -m[0]*m[5]*m[9];
+    c[i++] = m[0]*(m[5]*m[8]-m[6]*m[7]);
+    c[i++] = m[0]*m[4]*m[9];
+    c[i++] = -m[0]*m[4]*m[8];
+    c[i++] = m[0]*m[4]*m[7];
+    return m[0]*m[4]*m[7]*m[9];
+}
+static inline float cofactors_ut5_f(const float* restrict m, float* restrict c)
+{
+    int i=0;
+    c[i++] = m[12]*m[14]*m[5]*m[9];
+    c[i++] = -m[1]*m[12]*m[14]*m[9];
+    c[i++] = m[1]*m[12]*m[14]*m[6]-m[12]*m[14]*m[2]*m[5];
+    c[i++] = (-m[1]*(m[10]*m[14]*m[6]-m[14]*m[7]*m[9]))-m[14]*m[3]*m[5]*m[9]+m[10]*m[14]*m[2]*m[5];
+    c[i++] = m[1]*(m[12]*m[8]*m[9]-m[13]*m[7]*m[9]+(m[10]*m[13]-m[11]*m[12])*m[6])-m[12]*m[4]*m[5]*m[9]+m[13]*m[3]*m[5]*m[9]-(m[10]*m[13]-m[11]*m[12])*m[2]*m[5];
+    c[i++] = m[0]*m[12]*m[14]*m[9];
+    c[i++] = -m[0]*m[12]*m[14]*m[6];
+    c[i++] = m[0]*(m[10]*m[14]*m[6]-m[14]*m[7]*m[9]);
+    c[i++] = -m[0]*(m[12]*m[8]*m[9]-m[13]*m[7]*m[9]+(m[10]*m[13]-m[11]*m[12])*m[6]);
+    c[i++] = m[0]*m[12]*m[14]*m[5];
+    c[i++] = -m[0]*m[10]*m[14]*m[5];
+    c[i++] = m[0]*(m[10]*m[13]-m[11]*m[12])*m[5];
+    c[i++] = m[0]*m[14]*m[5]*m[9];
+    c[i++] = -m[0]*m[13]*m[5]*m[9];
+    c[i++] = m[0]*m[12]*m[5]*m[9];
+    return m[0]*m[5]*m[9]*m[12]*m[14];
+}
+static inline float cofactors_lt2_f(const float* restrict m, float* restrict c)
+{
+    int i=0;
+    c[i++] = m[2];
+    c[i++] = -m[1];
+    c[i++] = m[0];
+    return m[0]*m[2];
+}
+static inline float cofactors_lt3_f(const float* restrict m, float* restrict c)
+{
+    int i=0;
+    c[i++] = m[2]*m[5];
+    c[i++] = -m[1]*m[5];
+    c[i++] = m[0]*m[5];
+    c[i++] = m[1]*m[4]-m[2]*m[3];
+    c[i++] = -m[0]*m[4];
+    c[i++] = m[0]*m[2];
+    return m[0]*m[2]*m[5];
+}
+static inline float cofactors_lt4_f(const float* restrict m, float* restrict c)
+{
+    int i=0;
+    c[i++] = m[2]*m[5]*m[9];
+    c[i++] = -m[1]*m[5]*m[9];
+    c[i++] = m[0]*m[5]*m[9];
+    c[i++] = m[1]*m[4]*m[9]-m[2]*m[3]*m[9];
+    c[i++] = -m[0]*m[4]*m[9];
+    c[i++] = m[0]*m[2]*m[9];
+    c[i++] = m[2]*(m[3]*m[8]-m[5]*m[6])-m[1]*(m[4]*m[8]-m[5]*m[7]);
+    c[i++] = m[0]*(m[4]*m[8]-m[5]*m[7]);
+    c[i++] = -m[0]*m[2]*m[8];
+    c[i++] = m[0]*m[2]*m[5];
+    return m[0]*m[2]*m[5]*m[9];
+}
+static inline float cofactors_lt5_f(const float* restrict m, float* restrict c)
+{
+    int i=0;
+    c[i++] = m[14]*m[2]*m[5]*m[9];
+    c[i++] = -m[1]*m[14]*m[5]*m[9];
+    c[i++] = m[0]*m[14]*m[5]*m[9];
+    c[i++] = m[1]*m[14]*m[4]*m[9]-m[14]*m[2]*m[3]*m[9];
+    c[i++] = -m[0]*m[14]*m[4]*m[9];
+    c[i++] = m[0]*m[14]*m[2]*m[9];
+    c[i++] = m[2]*(m[14]*m[3]*m[8]-m[14]*m[5]*m[6])-m[1]*(m[14]*m[4]*m[8]-m[14]*m[5]*m[7]);
+    c[i++] = m[0]*(m[14]*m[4]*m[8]-m[14]*m[5]*m[7]);
+    c[i++] = -m[0]*m[14]*m[2]*m[8];
+    c[i++] = m[0]*m[14]*m[2]*m[5];
+    c[i++] = m[1]*(m[4]*(m[13]*m[8]-m[12]*m[9])-m[5]*(m[13]*m[7]-m[11]*m[9]))-m[2]*(m[3]*(m[13]*m[8]-m[12]*m[9])-m[5]*(m[13]*m[6]-m[10]*m[9]));
+    c[i++] = -m[0]*(m[4]*(m[13]*m[8]-m[12]*m[9])-m[5]*(m[13]*m[7]-m[11]*m[9]));
+    c[i++] = m[0]*m[2]*(m[13]*m[8]-m[12]*m[9]);
+    c[i++] = -m[0]*m[13]*m[2]*m[5];
+    c[i++] = m[0]*m[2]*m[5]*m[9];
+    return m[0]*m[2]*m[5]*m[9]*m[14];
+}
+
+/*
+(%i27) a : matrix([a0,a1,a2],[0,a3,a4],[0,0,a5]);
+
+(%o27) matrix([a0,a1,a2],[0,a3,a4],[0,0,a5])
+(%i28) b : matrix([b0,b1,b2],[0,b3,b4],[0,0,b5]);
+
+(%o28) matrix([b0,b1,b2],[0,b3,b4],[0,0,b5])
+(%i29) a . b;
+
+(%o29) matrix([a0*b0,a1*b3+a0*b1,a2*b5+a1*b4+a0*b2],[0,a3*b3,a4*b5+a3*b4],[0,0,a5*b5])
+*/
+static inline void mul_ut3_ut3_f(const float* restrict a, const float* restrict b,
+                               float* restrict ab)
+{
+    ab[0] = a[0] * b[0];
+    ab[1] = a[1] * b[3]+a[0] * b[1];
+    ab[2] = a[2] * b[5]+a[1] * b[4]+a[0] * b[2];
+    ab[3] = a[3] * b[3];
+    ab[4] = a[4] * b[5]+a[3] * b[4];
+    ab[5] = a[5] * b[5];
+}
+
+// symmetrix 3x3 by symmetrix 3x3, written into a new non-symmetric matrix,
+// scaled. This is a special-case function that I needed for something...
+static inline void mul_sym33_sym33_scaled_out_f(const float* restrict s0, const float* restrict s1, float* restrict mout, float scale)
+{
+// (%i106) matrix([m0_0,m0_1,m0_2],
+//                [m0_1,m0_3,m0_4],
+//                [m0_2,m0_4,m0_5]) .
+//         matrix([m1_0,m1_1,m1_2],
+//                [m1_1,m1_3,m1_4],
+//                [m1_2,m1_4,m1_5]);
+
+// (%o106) matrix([m0_2*m1_2+m0_1*m1_1+m0_0*m1_0,m0_2*m1_4+m0_1*m1_3+m0_0*m1_1,
+//                 m0_2*m1_5+m0_1*m1_4+m0_0*m1_2],
+//                [m0_4*m1_2+m0_3*m1_1+m0_1*m1_0,m0_4*m1_4+m0_3*m1_3+m0_1*m1_1,
+//                 m0_4*m1_5+m0_3*m1_4+m0_1*m1_2],
+//                [m0_5*m1_2+m0_4*m1_1+m0_2*m1_0,m0_5*m1_4+m0_4*m1_3+m0_2*m1_1,
+//                 m0_5*m1_5+m0_4*m1_4+m0_2*m1_2])
+
+  mout[0] = scale * (s0[2]*s1[2]+s0[1]*s1[1]+s0[0]*s1[0]);
+  mout[1] = scale * (s0[2]*s1[4]+s0[1]*s1[3]+s0[0]*s1[1]);
+  mout[2] = scale * (s0[2]*s1[5]+s0[1]*s1[4]+s0[0]*s1[2]);
+  mout[3] = scale * (s0[4]*s1[2]+s0[3]*s1[1]+s0[1]*s1[0]);
+  mout[4] = scale * (s0[4]*s1[4]+s0[3]*s1[3]+s0[1]*s1[1]);
+  mout[5] = scale * (s0[4]*s1[5]+s0[3]*s1[4]+s0[1]*s1[2]);
+  mout[6] = scale * (s0[5]*s1[2]+s0[4]*s1[1]+s0[2]*s1[0]);
+  mout[7] = scale * (s0[5]*s1[4]+s0[4]*s1[3]+s0[2]*s1[1]);
+  mout[8] = scale * (s0[5]*s1[5]+s0[4]*s1[4]+s0[2]*s1[2]);
+}
+
+static inline void outerproduct3_f(const float* restrict v, float* restrict P)
+{
+  P[0] = v[0]*v[0];
+  P[1] = v[0]*v[1];
+  P[2] = v[0]*v[2];
+  P[3] = v[1]*v[1];
+  P[4] = v[1]*v[2];
+  P[5] = v[2]*v[2];
+}
+
+static inline void outerproduct3_scaled_f(const float* restrict v, float* restrict P, float scale)
+{
+  P[0] = scale * v[0]*v[0];
+  P[1] = scale * v[0]*v[1];
+  P[2] = scale * v[0]*v[2];
+  P[3] = scale * v[1]*v[1];
+  P[4] = scale * v[1]*v[2];
+  P[5] = scale * v[2]*v[2];
+}
+
+// conjugate 2 vectors (a, b) through a symmetric matrix S: a->transpose x S x b
+// (%i2) sym3 : matrix([s0,s1,s2],
+//                     [s1,s3,s4],
+//                     [s2,s4,s5]);
+
+// (%o2) matrix([s0,s1,s2],[s1,s3,s4],[s2,s4,s5])
+// (%i6) a : matrix([a0],[a1],[a2]);
+
+// (%o6) matrix([a0],[a1],[a2])
+// (%i7) b : matrix([b0],[b1],[b2]);
+
+// (%o7) matrix([b0],[b1],[b2])
+// (%i10) transpose(a) . sym3 . b;
+
+// (%o10) a2*(b2*s5+b1*s4+b0*s2)+a1*(b2*s4+b1*s3+b0*s1)+a0*(b2*s2+b1*s1+b0*s0)
+static inline float conj_3_f(const float* restrict a, const float* restrict s, const float* restrict b)
+{
+  return a[2]*(b[2]*s[5]+b[1]*s[4]+b[0]*s[2])+a[1]*(b[2]*s[4]+b[1]*s[3]+b[0]*s[1])+a[0]*(b[2]*s[2]+b[1]*s[1]+b[0]*s[0]);
+}
+
+// Given an orthonormal matrix, returns the det. This is always +1 or -1
+static inline float det_orthonormal33_f(const float* m)
+{
+    // cross(row0,row1) = det * row3
+
+    // I find a nice non-zero element of row3, and see if the signs match
+    if( m[6] < -0.1f )
+    {
+        // looking at col0 of the last row. It is <0
+        float cross = m[1]*m[5] - m[2]*m[4];
+        return cross > 0.0f ? -1.0f : 1.0f;
+    }
+    if( m[6] > 0.1f)
+    {
+        // looking at col0 of the last row. It is > 0
+        float cross = m[1]*m[5] - m[2]*m[4];
+        return cross > 0.0f ? 1.0f : -1.0f;
+    }
+
+    if( m[7] < -0.1f )
+    {
+        // looking at col1 of the last row. It is <0
+        float cross = m[2]*m[3] - m[0]*m[5];
+        return cross > 0.0f ? -1.0f : 1.0f;
+    }
+    if( m[7] > 0.1f)
+    {
+        // looking at col1 of the last row. It is > 0
+        float cross = m[2]*m[3] - m[0]*m[5];
+        return cross > 0.0f ? 1.0f : -1.0f;
+    }
+
+    if( m[8] < -0.1f )
+    {
+        // looking at col2 of the last row. It is <0
+        float cross = m[0]*m[4] - m[1]*m[3];
+        return cross > 0.0f ? -1.0f : 1.0f;
+    }
+
+    // last option. This MUST be true, so I don't even bother to check
+    {
+        // looking at col2 of the last row. It is > 0
+        float cross = m[0]*m[4] - m[1]*m[3];
+        return cross > 0.0f ? 1.0f : -1.0f;
+    }
+}
+
+static void minimath_xchg_f(float* m, int i, int j)
+{
+    float t = m[i];
+    m[i] = m[j];
+    m[j] = t;
+}
+static inline void gen33_transpose_f(float* m)
+{
+    minimath_xchg_f(m, 1, 3);
+    minimath_xchg_f(m, 2, 6);
+    minimath_xchg_f(m, 5, 7);
+}
+
+static inline void gen33_transpose_vout_f(const float* m, float* mout)
+{
+    for(int i=0; i<3; i++)
+        for(int j=0; j<3; j++)
+            mout[i*3+j] = m[j*3+i];
+}
+
+static inline float cofactors_gen33_f(// output
+                                     float* restrict c,
+
+                                     // input
+                                     const float* restrict m)
+{
+    /*
+(%i1) display2d : false;
+
+(%o1) false
+(%i5) linel : 100000;
+
+(%o5) 100000
+(%i6) mat33 : matrix( [m0,m1,m2], [m3,m4,m5], [m6,m7,m8] );
+
+(%o6) matrix([m0,m1,m2],[m3,m4,m5],[m6,m7,m8])
+(%i7) num( ev(invert(mat33)), detout );
+
+(%o7) matrix([(m4*m8-m5*m7)/(m0*(m4*m8-m5*m7)+m1*(m5*m6-m3*m8)+m2*(m3*m7-m4*m6)),(m2*m7-m1*m8)/(m0*(m4*m8-m5*m7)+m1*(m5*m6-m3*m8)+m2*(m3*m7-m4*m6)),(m1*m5-m2*m4)/(m0*(m4*m8-m5*m7)+m1*(m5*m6-m3*m8)+m2*(m3*m7-m4*m6))],[(m5*m6-m3*m8)/(m0*(m4*m8-m5*m7)+m1*(m5*m6-m3*m8)+m2*(m3*m7-m4*m6)),(m0*m8-m2*m6)/(m0*(m4*m8-m5*m7)+m1*(m5*m6-m3*m8)+m2*(m3*m7-m4*m6)),(m2*m3-m0*m5)/(m0*(m4*m8-m5*m7)+m1*(m5*m6-m3*m8)+m2*(m3*m7-m4*m6))],[(m3*m7-m4*m6)/(m0*(m4*m8-m5*m7)+m1*(m5*m6-m3*m8)+m2*(m3*m7-m4*m6)),(m1*m6-m0*m7)/(m0*(m4*m8-m5*m7)+m1*(m5*m6-m3*m8)+m2*(m3*m7-m4*m6)),(m0*m4-m1*m3)/(m0*(m4*m8-m5*m7)+m1*(m5*m6-m3*m8)+m2*(m3*m7-m4*m6))])
+(%i8) determinant(mat33);
+
+(%o8) m0*(m4*m8-m5*m7)-m1*(m3*m8-m5*m6)+m2*(m3*m7-m4*m6)
+    */
+
+    float det = m[0]*(m[4]*m[8]-m[5]*m[7])-m[1]*(m[3]*m[8]-m[5]*m[6])+m[2]*(m[3]*m[7]-m[4]*m[6]);
+
+    c[0] = m[4]*m[8]-m[5]*m[7];
+    c[1] = m[2]*m[7]-m[1]*m[8];
+    c[2] = m[1]*m[5]-m[2]*m[4];
+    c[3] = m[5]*m[6]-m[3]*m[8];
+    c[4] = m[0]*m[8]-m[2]*m[6];
+    c[5] = m[2]*m[3]-m[0]*m[5];
+    c[6] = m[3]*m[7]-m[4]*m[6];
+    c[7] = m[1]*m[6]-m[0]*m[7];
+    c[8] = m[0]*m[4]-m[1]*m[3];
+
+    return det;
+}
+
+// Robust inverses. The inverse is computed from the cofactors, as usual. The
+// cofactors also give the exact 1-norm of the inverse, so the reciprocal
+// condition number rcond = 1/(|M|_1 |M^-1|_1) is available almost for free. If
+// rcond < rcond_min, the cofactor expansion isn't trusted, and the inverse is
+// recomputed with a Gauss-Jordan elimination with partial pivoting. This
+// fallback is out-of-line, so the common well-conditioned path stays small and
+// predictable. The inverse is stored in the same packed format as the input.
+// Returns rcond. If the matrix is exactly singular, 0 is returned, and the
+// inverse is set to 0
+
+// index of element (i,j) in a packed matrix: 's'ymmetric (upper triangle
+// stored), 'u'pper-triangular, 'l'ower-triangular or 'g'eneral. Returns -1 for
+// the elements that are not stored
+static inline int minimath_packed_index_f(char kind, int n, int i, int j)
+{
+    if(kind == 's' && i > j)
+    {
+        int t = i; i = j; j = t;
+    }
+    if(kind == 's' || kind == 'u') return i <= j ? (2*n-i-1)*i/2 + j : -1;
+    if(kind == 'l')                return j <= i ? i*(i+1)/2 + j     : -1;
+    return i*n + j;
+}
+
+// 1-norm (max column sum) of a packed matrix
+static inline float minimath_norm1_packed_f(char kind, int n, const float* restrict m)
+{
+    float norm = 0.0f;
+    for(int j=0; j<n; j++)
+    {
+        float sum = 0.0f;
+        for(int i=0; i<n; i++)
+        {
+            const int k = minimath_packed_index_f(kind, n, i, j);
+            if(k >= 0) sum += fabsf(m[k]);
+        }
+        norm = fmaxf(norm, sum);
+    }
+    return norm;
+}
+
+// The slow path of the robust inverses: Gauss-Jordan elimination with partial
+// pivoting on an unpacked copy of m. n <= 6
+__attribute__((noinline, unused))
+static float minimath_inverse_pivoted_f(char kind, int n,
+                                       // output
+                                       float* restrict inv,
+                                       // input
+                                       const float* restrict m, float norm_m)
+{
+    float a[6*6], b[6*6];
+    for(int i=0; i<n; i++)
+        for(int j=0; j<n; j++)
+        {
+            const int k = minimath_packed_index_f(kind, n, i, j);
+            a[i*n + j] = k >= 0 ? m[k] : 0.0f;
+            b[i*n + j] = i == j ? 1.0f : 0.0f;
+        }
+
+    for(int col=0; col<n; col++)
+    {
+        int p = col;
+        for(int i=col+1; i<n; i++)
+            if(fabsf(a[i*n + col]) > fabsf(a[p*n + col]))
+                p = i;
+        if(a[p*n + col] == 0.0f)
+        {
+            for(int i=0; i<n; i++)
+                for(int j=0; j<n; j++)
+                {
+                    const int k = minimath_packed_index_f(kind, n, i, j);
+                    if(k >= 0) inv[k] = 0.0f;
+                }
+            return 0.0f;
+        }
+        if(p != col)
+            for(int j=0; j<n; j++)
+            {
+                float t;
+                t = a[p*n + j]; a[p*n + j] = a[col*n + j]; a[col*n + j] = t;
+                t = b[p*n + j]; b[p*n + j] = b[col*n + j]; b[col*n + j] = t;
+            }
+
+        const float s = 1.0f / a[col*n + col];
+        for(int j=0; j<n; j++)
+        {
+            a[col*n + j] *= s;
+            b[col*n + j] *= s;
+        }
+        for(int i=0; i<n; i++)
+        {
+            if(i == col) continue;
+            const float f = a[i*n + col];
+            for(int j=0; j<n; j++)
+            {
+                a[i*n + j] -= f*a[col*n + j];
+                b[i*n + j] -= f*b[col*n + j];
+            }
+        }
+    }
+
+    // Pack. A symmetric inverse is symmetrized to clean up the round-off
+    float norm_inv = 0.0f;
+    for(int j=0; j<n; j++)
+    {
+        float sum = 0.0f;
+        for(int i=0; i<n; i++)
+        {
+            const int k = minimath_packed_index_f(kind, n, i, j);
+            if(k < 0) continue;
+            sum += fabsf(b[i*n + j]);
+            if(kind != 's')  inv[k] = b[i*n + j];
+            else if(i <= j)  inv[k] = (b[i*n + j] + b[j*n + i]) / 2.0f;
+        }
+        norm_inv = fmaxf(norm_inv, sum);
+    }
+    return 1.0f / (norm_m * norm_inv);
+}
+
+// Takes the cofactors c and determinant from cofactors_...(). Scales the
+// cofactors into the inverse in-place, or calls the fallback
+static inline float minimath_inverse_robust_f(char kind, int n,
+                                             // output
+                                             float* restrict c,
+                                             // input
+                                             const float* restrict m, float det, float rcond_min)
+{
+    const float norm_m = minimath_norm1_packed_f(kind, n, m);
+    const float norm_c = minimath_norm1_packed_f(kind, n, c);
+
+    if(__builtin_expect(det != 0.0f && fabsf(det) >= rcond_min * norm_m * norm_c, 1))
+    {
+        const int N = kind == 'g' ? n*n : n*(n+1)/2;
+        const float s = 1.0f / det;
+        for(int i=0; i<N; i++) c[i] *= s;
+        return fabsf(det) / (norm_m * norm_c);
+    }
+    return minimath_inverse_pivoted_f(kind, n, c, m, norm_m);
+}
+
+static inline float inverse_sym2_robust_f(const float* restrict m, float* restrict inv, float rcond_min)
+{
+    return minimath_inverse_robust_f('s', 2, inv, m, cofactors_sym2_f(m, inv), rcond_min);
+}
+static inline float inverse_sym3_robust_f(const float* restrict m, float* restrict inv, float rcond_min)
+{
+    return minimath_inverse_robust_f('s', 3, inv, m, cofactors_sym3_f(m, inv), rcond_min);
+}
+static inline float inverse_sym4_robust_f(const float* restrict m, float* restrict inv, float rcond_min)
+{
+    return minimath_inverse_robust_f('s', 4, inv, m, cofactors_sym4_f(m, inv), rcond_min);
+}
+static inline float inverse_sym5_robust_f(const float* restrict m, float* restrict inv, float rcond_min)
+{
+    return minimath_inverse_robust_f('s', 5, inv, m, cofactors_sym5_f(m, inv), rcond_min);
+}
+static inline float inverse_sym6_robust_f(const float* restrict m, float* restrict inv, float rcond_min)
+{
+    return minimath_inverse_robust_f('s', 6, inv, m, cofactors_sym6_f(m, inv), rcond_min);
+}
+static inline float inverse_ut2_robust_f(const float* restrict m, float* restrict inv, float rcond_min)
+{
+    return minimath_inverse_robust_f('u', 2, inv, m, cofactors_ut2_f(m, inv), rcond_min);
+}
+static inline float inverse_ut3_robust_f(const float* restrict m, float* restrict inv, float rcond_min)
+{
+    return minimath_inverse_robust_f('u', 3, inv, m, cofactors_ut3_f(m, inv), rcond_min);
+}
+static inline float inverse_ut4_robust_f(const float* restrict m, float* restrict inv, float rcond_min)
+{
+    return minimath_inverse_robust_f('u', 4, inv, m, cofactors_ut4_f(m, inv), rcond_min);
+}
+static inline float inverse_ut5_robust_f(const float* restrict m, float* restrict inv, float rcond_min)
+{
+    return minimath_inverse_robust_f('u', 5, inv, m, cofactors_ut5_f(m, inv), rcond_min);
+}
+static inline float inverse_lt2_robust_f(const float* restrict m, float* restrict inv, float rcond_min)
+{
+    return minimath_inverse_robust_f('l', 2, inv, m, cofactors_lt2_f(m, inv), rcond_min);
+}
+static inline float inverse_lt3_robust_f(const float* restrict m, float* restrict inv, float rcond_min)
+{
+    return minimath_inverse_robust_f('l', 3, inv, m, cofactors_lt3_f(m, inv), rcond_min);
+}
+static inline float inverse_lt4_robust_f(const float* restrict m, float* restrict inv, float rcond_min)
+{
+    return minimath_inverse_robust_f('l', 4, inv, m, cofactors_lt4_f(m, inv), rcond_min);
+}
+static inline float inverse_lt5_robust_f(const float* restrict m, float* restrict inv, float rcond_min)
+{
+    return minimath_inverse_robust_f('l', 5, inv, m, cofactors_lt5_f(m, inv), rcond_min);
+}
+static inline float inverse_gen33_robust_f(const float* restrict m, float* restrict inv, float rcond_min)
+{
+    return minimath_inverse_robust_f('g', 3, inv, m, cofactors_gen33_f(inv, m), rcond_min);
+}
+
+// cross product of two 3-vectors: vout = a x b
+static inline void cross3_vout_f(const float* restrict a, const float* restrict b, float* restrict vout)
+{
+    vout[0] = a[1]*b[2] - a[2]*b[1];
+    vout[1] = a[2]*b[0] - a[0]*b[2];
+    vout[2] = a[0]*b[1] - a[1]*b[0];
+}
+
+// Finds a vector in the null space of (s - lambda*I), where s is a symmetric
+// 3x3 matrix and lambda is one of its eigenvalues. This matrix has rank 2 (if
+// lambda is a simple eigenvalue), so the null space is spanned by a cross
+// product of two of its rows. I compute all 3 cross products, and use the
+// largest one. The result is not normalized. Returns its squared norm
+static inline float minimath_eig_sym33_vector_f(float* restrict v,
+                                               const float* restrict s, float lambda)
+{
+    const float r0[] = {s[0]-lambda, s[1],        s[2]       };
+    const float r1[] = {s[1],        s[3]-lambda, s[4]       };
+    const float r2[] = {s[2],        s[4],        s[5]-lambda};
+
+    float c[3][3];
+    cross3_vout_f(r0, r1, c[0]);
+    cross3_vout_f(r0, r2, c[1]);
+    cross3_vout_f(r1, r2, c[2]);
+
+    const float n0 = norm2_vec_f(3, c[0]);
+    const float n1 = norm2_vec_f(3, c[1]);
+    const float n2 = norm2_vec_f(3, c[2]);
+
+    const int    i    = n0 >= n1 ? (n0 >= n2 ? 0 : 2) : (n1 >= n2 ? 1 : 2);
+    const float norm = i == 0 ? n0 : (i == 1 ? n1 : n2);
+    for(int j=0; j<3; j++)
+        v[j] = c[i][j];
+    return norm;
+}
+
+// Eigen-decomposition of a symmetric 3x3 matrix s, stored packed. The
+// eigenvalues are written to l[] in ascending order. The corresponding
+// eigenvectors are written to the rows of the 3x3 matrix v. These are
+// orthonormal: v * s * vt = diag(l)
+//
+// The eigenvalues come from the trigonometric solution of the characteristic
+// cubic (Smith 1961). Each eigenvector is the cross product of two rows of
+// s - lambda*I. This is ill-conditioned when eigenvalues are (nearly) repeated,
+// so I compute the vector for the most isolated eigenvalue, and build the other
+// two from it by orthogonalization. If the middle eigenvalue is repeated also,
+// any orthonormal basis of that eigenspace is returned. Near a repeated
+// eigenvalue the relative accuracy of the trigonometric solution drops to about
+// sqrtf(machine epsilon). Use an iterative solver if that isn't good enough
+static inline void eig_sym33_f(// output
+                             float* restrict l, float* restrict v,
+
+                             // input
+                             const float* restrict s)
+{
+    // I shift and scale the matrix to B = (s - q*I)/p, which has trace 0 and
+    // a reasonable scale
+    const float q  = (s[0] + s[3] + s[5]) / 3.0f;
+    const float p1 = s[1]*s[1] + s[2]*s[2] + s[4]*s[4];
+    const float p2 =
+        (s[0]-q)*(s[0]-q) + (s[3]-q)*(s[3]-q) + (s[5]-q)*(s[5]-q) + 2.0f*p1;
+    const float p  = sqrtf(p2 / 6.0f);
+
+    if(p == 0.0f)
+    {
+        // s = q*I. Any basis will do
+        for(int i=0; i<3; i++)
+        {
+            l[i] = q;
+            for(int j=0; j<3; j++)
+                v[i*3 + j] = i == j ? 1.0f : 0.0f;
+        }
+        return;
+    }
+
+    const float b[] = { (s[0]-q)/p, s[1]/p, s[2]/p,
+                                     (s[3]-q)/p, s[4]/p,
+                                                 (s[5]-q)/p };
+    float r = 0.5f * (b[0]*(b[3]*b[5]-b[4]*b[4]) -
+                      b[1]*(b[1]*b[5]-b[2]*b[4]) +
+                      b[2]*(b[1]*b[4]-b[2]*b[3]));
+    // r is in [-1,1] analytically, but may be slightly outside numerically
+    if     (r <= -1.0f) r = -1.0f;
+    else if(r >=  1.0f) r =  1.0f;
+
+    const float phi = acosf(r) / 3.0f;
+    l[2] = q + 2.0f*p*cosf(phi);
+    l[0] = q + 2.0f*p*cosf(phi + 2.0943951023931954923f); // phi + 2pi/3
+    l[1] = 3.0f*q - l[0] - l[2];
+    // roundoff could break the ordering when the eigenvalues are nearly equal
+    if(l[1] < l[0]) l[1] = l[0];
+    if(l[1] > l[2]) l[1] = l[2];
+
+    // The eigenvector of the most isolated eigenvalue. Its gap to the others is
+    // at least half of the spread of the eigenvalues, so this is always
+    // well-conditioned
+    const int iiso   = l[1] - l[0] > l[2] - l[1] ? 0 : 2;
+    float*   viso   = &v[iiso*3];
+    float*   vmid   = &v[3];
+    float*   vother = &v[(2-iiso)*3];
+
+    float norm2 = minimath_eig_sym33_vector_f(viso, s, l[iiso]);
+    for(int j=0; j<3; j++)
+        viso[j] /= sqrtf(norm2);
+
+    // The middle eigenvector. If the middle eigenvalue is (nearly) repeated, the
+    // cross products are tiny, and the direction is meaningless. I then use any
+    // vector orthogonal to viso. In either case I make sure it is orthogonal to
+    // viso
+    norm2 = minimath_eig_sym33_vector_f(vmid, s, l[1]);
+    if(norm2 <= 1e-12 * p2*p2)
+    {
+        // pick the axis least aligned with viso, and orthogonalize it
+        const int iaxis =
+            fabsf(viso[0]) <= fabsf(viso[1]) ?
+            (fabsf(viso[0]) <= fabsf(viso[2]) ? 0 : 2) :
+            (fabsf(viso[1]) <= fabsf(viso[2]) ? 1 : 2);
+        for(int j=0; j<3; j++)
+            vmid[j] = (j == iaxis ? 1.0f : 0.0f) - viso[iaxis]*viso[j];
+    }
+    else
+    {
+        const float d = dot_vec_f(3, vmid, viso);
+        for(int j=0; j<3; j++)
+            vmid[j] -= d*viso[j];
+    }
+    norm2 = norm2_vec_f(3, vmid);
+    for(int j=0; j<3; j++)
+        vmid[j] /= sqrtf(norm2);
+
+    // And the last eigenvector is orthogonal to both
+    cross3_vout_f(viso, vmid, vother);
+}
+
+// N eigen-decompositions of symmetric 3x3 matrices (structure-of-arrays):
+// element j of matrix i lives in s[j*stride + i]. The outputs are laid out the
+// same way: l[j*stride + i] for the 3 eigenvalues, and v[j*stride + i] for the
+// 9 elements of the eigenvector matrix. See eig_sym33_f() for details
+static inline void eig_soaN_sym33_f(int n, int stride,
+
+                                  // output
+                                  float* restrict l, float* restrict v,
+
+                                  // input
+                                  const float* restrict s)
+{
+    MINIMATH_PARALLEL_FOR_f(n)
+    for(int i=0; i<n; i++)
+    {
+        float si[6], li[3], vi[9];
+        for(int j=0; j<6; j++) si[j] = s[j*stride + i];
+        eig_sym33_f(li, vi, si);
+        for(int j=0; j<3; j++) l[j*stride + i] = li[j];
+        for(int j=0; j<9; j++) v[j*stride + i] = vi[j];
+    }
+}
+
+// Applies a Jacobi rotation in the (p,q) plane to the full symmetric 3x3 matrix
+// S, chosen to zero out S[p][q]. The rotation is accumulated into the columns of
+// V. Used by svd_gen33_f()
+static inline void minimath_jacobi33_f(float* restrict S, float* restrict V, int p, int q)
+{
+    const float spq = S[p*3 + q];
+    if(spq == 0.0f)
+        return;
+
+    const float theta = (S[q*3 + q] - S[p*3 + p]) / (2.0f*spq);
+    const float t     = (theta >= 0.0f ? 1.0f : -1.0f) / (fabsf(theta) + sqrtf(theta*theta + 1.0f));
+    const float c     = 1.0f / sqrtf(t*t + 1.0f);
+    const float s     = t*c;
+
+    // S <- Jt S J
+    for(int k=0; k<3; k++)
+    {
+        const float skp = S[k*3 + p];
+        const float skq = S[k*3 + q];
+        S[k*3 + p] = c*skp - s*skq;
+        S[k*3 + q] = s*skp + c*skq;
+    }
+    for(int k=0; k<3; k++)
+    {
+        const float spk = S[p*3 + k];
+        const float sqk = S[q*3 + k];
+        S[p*3 + k] = c*spk - s*sqk;
+        S[q*3 + k] = s*spk + c*sqk;
+    }
+
+    // V <- V J
+    for(int k=0; k<3; k++)
+    {
+        const float vkp = V[k*3 + p];
+        const float vkq = V[k*3 + q];
+        V[k*3 + p] = c*vkp - s*vkq;
+        V[k*3 + q] = s*vkp + c*vkq;
+    }
+}
+
+// If column q of B is longer than column p, swaps the columns of B and of V. One
+// of the swapped columns is negated to keep det(V) = +1.f Used by svd_gen33_f()
+static inline void minimath_svd_sort33_f(float* restrict B, float* restrict V, int p, int q)
+{
+    const float np = B[p]*B[p] + B[3+p]*B[3+p] + B[6+p]*B[6+p];
+    const float nq = B[q]*B[q] + B[3+q]*B[3+q] + B[6+q]*B[6+q];
+    if(nq <= np)
+        return;
+
+    for(int k=0; k<3; k++)
+    {
+        float t;
+        t = B[k*3 + p]; B[k*3 + p] = B[k*3 + q]; B[k*3 + q] = -t;
+        t = V[k*3 + p]; V[k*3 + p] = V[k*3 + q]; V[k*3 + q] = -t;
+    }
+}
+
+// Applies a Givens rotation to rows a,b of B, chosen to zero out B[b][col]. The
+// rotation is accumulated into the columns of U. Used by svd_gen33_f()
+static inline void minimath_givens33_f(float* restrict B, float* restrict U, int a, int b, int col)
+{
+    const float x = B[a*3 + col];
+    const float y = B[b*3 + col];
+    const float r = sqrtf(x*x + y*y);
+    const float c = r > 0.0f ? x/r : 1.0f;
+    const float s = r > 0.0f ? y/r : 0.0f;
+
+    // B <- G B
+    for(int k=0; k<3; k++)
+    {
+        const float bak = B[a*3 + k];
+        const float bbk = B[b*3 + k];
+        B[a*3 + k] =  c*bak + s*bbk;
+        B[b*3 + k] = -s*bak + c*bbk;
+    }
+
+    // U <- U Gt
+    for(int k=0; k<3; k++)
+    {
+        const float uka = U[k*3 + a];
+        const float ukb = U[k*3 + b];
+        U[k*3 + a] =  c*uka + s*ukb;
+        U[k*3 + b] = -s*uka + c*ukb;
+    }
+}
+
+// Singular value decomposition of a general 3x3 matrix m: m = u * diag(s) * vt.
+// u and v are rotations: orthonormal, with det = +1.f s[] is sorted by decreasing
+// magnitude. s[0] and s[1] are non-negative. s[2] has the sign of det(m). So for
+// a reflection the sign lives in s[2], not in u or v.
+//
+// This follows McAdams et al, "Computing the Singular Value Decomposition of 3x3
+// matrices with minimal branching and elementary floating point operations". I
+// diagonalize mt*m with a fixed number of cyclic Jacobi sweeps to get v. I then
+// sort the columns of m*v by length, and do a QR decomposition of the result
+// with Givens rotations to get u and s. The loop counts don't depend on the
+// data
+static inline void svd_gen33_f(// output
+                             float* restrict u, float* restrict s, float* restrict v,
+
+                             // input
+                             const float* restrict m)
+{
+    float S[9];
+    for(int i=0; i<3; i++)
+        for(int j=0; j<3; j++)
+            S[i*3 + j] = m[i]*m[j] + m[3+i]*m[3+j] + m[6+i]*m[6+j];
+
+    for(int i=0; i<9; i++)
+        v[i] = u[i] = (i%4 == 0) ? 1.0f : 0.0f;
+
+    // Cyclic Jacobi converges quadratically. 4 sweeps is plenty for a 3x3
+    for(int sweep=0; sweep<4; sweep++)
+    {
+        minimath_jacobi33_f(S, v, 0, 1);
+        minimath_jacobi33_f(S, v, 0, 2);
+        minimath_jacobi33_f(S, v, 1, 2);
+    }
+
+    float B[9];
+    for(int i=0; i<3; i++)
+        for(int j=0; j<3; j++)
+            B[i*3 + j] = m[i*3]*v[j] + m[i*3+1]*v[3+j] + m[i*3+2]*v[6+j];
+
+    minimath_svd_sort33_f(B, v, 0, 1);
+    minimath_svd_sort33_f(B, v, 0, 2);
+    minimath_svd_sort33_f(B, v, 1, 2);
+
+    // B = u*R. R is upper-triangular with orthogonal columns, so it is diagonal
+    minimath_givens33_f(B, u, 0, 1, 0);
+    minimath_givens33_f(B, u, 0, 2, 0);
+    minimath_givens33_f(B, u, 1, 2, 1);
+
+    s[0] = B[0];
+    s[1] = B[4];
+    s[2] = B[8];
+}
+
+// The rotation closest to m in the Frobenius norm: r = u*vt from svd_gen33_f().
+// This is the solution of the orthogonal Procrustes (Kabsch) problem, and is
+// always a proper rotation, even if m has a negative determinant
+static inline void nearest_rotation_gen33_f(// output
+                                          float* restrict r,
+
+                                          // input
+                                          const float* restrict m)
+{
+    float u[9], s[3], v[9];
+    svd_gen33_f(u, s, v, m);
+
+    for(int i=0; i<3; i++)
+        for(int j=0; j<3; j++)
+            r[i*3 + j] = u[i*3]*v[j*3] + u[i*3+1]*v[j*3+1] + u[i*3+2]*v[j*3+2];
+}
+
+// Polar decomposition m = r*p, where r is the nearest rotation to m (see
+// nearest_rotation_gen33_f()), and p = v*diag(s)*vt is symmetric, stored packed.
+// p is positive semi-definite if det(m) >= 0
+static inline void polar_gen33_f(// output
+                               float* restrict r, float* restrict p,
+
+                               // input
+                               const float* restrict m)
+{
+    float u[9], s[3], v[9];
+    svd_gen33_f(u, s, v, m);
+
+    for(int i=0; i<3; i++)
+        for(int j=0; j<3; j++)
+            r[i*3 + j] = u[i*3]*v[j*3] + u[i*3+1]*v[j*3+1] + u[i*3+2]*v[j*3+2];
+
+    int ip = 0;
+    for(int i=0; i<3; i++)
+        for(int j=i; j<3; j++)
+            p[ip++] = v[i*3]*s[0]*v[j*3] + v[i*3+1]*s[1]*v[j*3+1] + v[i*3+2]*s[2]*v[j*3+2];
+}
+
+// N 3x3 SVDs (structure-of-arrays): element j of matrix i lives in
+// m[j*stride + i]. The outputs are laid out the same way: u[j*stride + i],
+// s[j*stride + i], v[j*stride + i]. See svd_gen33_f() for details
+static inline void svd_soaN_gen33_f(int n, int stride,
+
+                                  // output
+                                  float* restrict u, float* restrict s, float* restrict v,
+
+                                  // input
+                                  const float* restrict m)
+{
+    MINIMATH_PARALLEL_FOR_f(n)
+    for(int i=0; i<n; i++)
+    {
+        float mi[9], ui[9], si[3], vi[9];
+        for(int j=0; j<9; j++) mi[j] = m[j*stride + i];
+        svd_gen33_f(ui, si, vi, mi);
+        for(int j=0; j<9; j++) u[j*stride + i] = ui[j];
+        for(int j=0; j<3; j++) s[j*stride + i] = si[j];
+        for(int j=0; j<9; j++) v[j*stride + i] = vi[j];
+    }
+}
+
+// N nearest rotations (structure-of-arrays): element j of matrix i lives in
+// m[j*stride + i] and r[j*stride + i]. See nearest_rotation_gen33_f() for details
+static inline void nearest_rotation_soaN_gen33_f(int n, int stride,
+
+                                               // output
+                                               float* restrict r,
+
+                                               // input
+                                               const float* restrict m)
+{
+    MINIMATH_PARALLEL_FOR_f(n)
+    for(int i=0; i<n; i++)
+    {
+        float mi[9], ri[9];
+        for(int j=0; j<9; j++) mi[j] = m[j*stride + i];
+        nearest_rotation_gen33_f(ri, mi);
+        for(int j=0; j<9; j++) r[j*stride + i] = ri[j];
+    }
+}
+
+
+// Rotations. A rotation matrix R is a gen33 matrix, stored row-first as usual. A
+// Rodrigues vector r is a 3-vector: the rotation axis scaled by the angle. A
+// quaternion q is a 4-vector [w x y z], with the scalar part first. q and -q
+// represent the same rotation. The functions that return quaternions pick the
+// one with w >= 0.f
+//
+// Each function optionally reports the gradient of its output with respect to
+// each input. The gradients are computed in the same pass as the output. They
+// are stored row-first, with a row per output element: dR_dr is 9x3, dq_dR is
+// 4x9 and so on. Pass NULL to skip a gradient
+
+// R = I + a*K + b*K^2, where K is the cross-product matrix of r. a = sinf(th)/th,
+// b = (1-cosf(th))/th^2.f Near th=0 I use the Taylor series of these
+static inline void rotation_from_rodrigues_f(// output
+                                           float* restrict R,
+                                           float* restrict dR_dr, // may be NULL
+
+                                           // input
+                                           const float* restrict r)
+{
+    const float th2 = norm2_vec_f(3, r);
+    float a, b, da, db; // da, db are (d/dth a)/th, (d/dth b)/th
+
+    if(th2 < 1e-8)
+    {
+        a  =  1.0f        - th2/6.0f;
+        b  =  0.5f        - th2/24.0f;
+        da = -1.0f/3.0f    + th2/30.0f;
+        db = -1.0f/12.0f   + th2/180.0f;
+    }
+    else
+    {
+        const float th = sqrtf(th2);
+        const float s  = sinf(th);
+        const float c  = cosf(th);
+        a  = s/th;
+        b  = (1.0f - c)/th2;
+        da = (th*c - s)/(th2*th);
+        db = (th*s - 2.0f*(1.0f - c))/(th2*th2);
+    }
+
+    // K and K^2 = r*rt - th2*I
+    const float K[9] =
+        {  0.0f,  -r[2],  r[1],
+           r[2],  0.0f,  -r[0],
+          -r[1],  r[0],  0.0f };
+    float K2[9];
+    for(int i=0; i<3; i++)
+        for(int j=0; j<3; j++)
+            K2[i*3 + j] = r[i]*r[j] - (i == j ? th2 : 0.0f);
+
+    for(int i=0; i<9; i++)
+        R[i] = (i%4 == 0 ? 1.0f : 0.0f) + a*K[i] + b*K2[i];
+
+    if(dR_dr == NULL)
+        return;
+
+    // dR/dr_k = a*dK/dr_k + b*dK2/dr_k + r_k*(da*K + db*K2)
+    for(int k=0; k<3; k++)
+    {
+        float dK[9] = {};
+        // dK/dr_k. K[i][j] = -eps_ijk r_k
+        switch(k)
+        {
+        case 0: dK[5] = -1.0f; dK[7] =  1.0f; break;
+        case 1: dK[2] =  1.0f; dK[6] = -1.0f; break;
+        case 2: dK[1] = -1.0f; dK[3] =  1.0f; break;
+        }
+
+        for(int i=0; i<3; i++)
+            for(int j=0; j<3; j++)
+            {
+                // d(r_i r_j - th2 delta_ij)/dr_k
+                const float dK2 =
+                    (i == k ? r[j] : 0.0f) + (j == k ? r[i] : 0.0f) -
+                    (i == j ? 2.0f*r[k] : 0.0f);
+                dR_dr[(i*3 + j)*3 + k] =
+                    a*dK[i*3 + j] + b*dK2 +
+                    r[k]*(da*K[i*3 + j] + db*K2[i*3 + j]);
+            }
+    }
+}
+
+// Standard expression, with 2*(...) terms. q should be unit-length. The gradient
+// is of this expression; it does not normalize q
+static inline void rotation_from_quat_f(// output
+                                      float* restrict R,
+                                      float* restrict dR_dq, // may be NULL
+
+                                      // input
+                                      const float* restrict q)
+{
+    const float w = q[0], x = q[1], y = q[2], z = q[3];
+
+    R[0] = 1.0f - 2.0f*(y*y + z*z); R[1] = 2.0f*(x*y - w*z);       R[2] = 2.0f*(x*z + w*y);
+    R[3] = 2.0f*(x*y + w*z);       R[4] = 1.0f - 2.0f*(x*x + z*z); R[5] = 2.0f*(y*z - w*x);
+    R[6] = 2.0f*(x*z - w*y);       R[7] = 2.0f*(y*z + w*x);       R[8] = 1.0f - 2.0f*(x*x + y*y);
+
+    if(dR_dq == NULL)
+        return;
+
+    const float d[9][4] =
+        { {  0.0f,     0.0f,    -4.0f*y,  -4.0f*z },
+          { -2.0f*z,   2.0f*y,   2.0f*x,  -2.0f*w },
+          {  2.0f*y,   2.0f*z,   2.0f*w,   2.0f*x },
+          {  2.0f*z,   2.0f*y,   2.0f*x,   2.0f*w },
+          {  0.0f,    -4.0f*x,   0.0f,    -4.0f*z },
+          { -2.0f*x,  -2.0f*w,   2.0f*z,   2.0f*y },
+          { -2.0f*y,   2.0f*z,  -2.0f*w,   2.0f*x },
+          {  2.0f*x,   2.0f*w,   2.0f*z,   2.0f*y },
+          {  0.0f,    -4.0f*x,  -4.0f*y,   0.0f   } };
+    for(int i=0; i<9; i++)
+        for(int j=0; j<4; j++)
+            dR_dq[i*4 + j] = d[i][j];
+}
+
+// Shepperd's method: I compute the largest of |w|,|x|,|y|,|z| from the diagonal
+// of R, and the others from the off-diagonal sums and differences. This is
+// well-conditioned for any rotation
+static inline void quat_from_rotation_f(// output
+                                      float* restrict q,
+                                      float* restrict dq_dR, // may be NULL
+
+                                      // input
+                                      const float* restrict R)
+{
+    // For each choice of the largest component b:
+    // - the signs of R00,R11,R22 in q_b = sqrtf(1 +- R00 +- R11 +- R22)/2
+    // - for each component c: q_c = (R[i0] + sign*R[i1]) / (4 q_b)
+    static const struct
+    {
+        float diagsign[3];
+        int    i0[4], i1[4];
+        float sign[4];
+    } cases[4] =
+        { // w largest
+          { { 1, 1, 1},
+            {-1, 7, 2, 3}, {-1, 5, 6, 1}, { 0, -1, -1, -1} },
+          // x largest
+          { { 1,-1,-1},
+            { 7,-1, 1, 2}, { 5,-1, 3, 6}, {-1,  0,  1,  1} },
+          // y largest
+          { {-1, 1,-1},
+            { 2, 1,-1, 5}, { 6, 3,-1, 7}, {-1,  1,  0,  1} },
+          // z largest
+          { {-1,-1, 1},
+            { 3, 2, 5,-1}, { 1, 6, 7,-1}, {-1,  1,  1,  0} } };
+
+    const float tr = R[0] + R[4] + R[8];
+    int b = 0;
+    float biggest = tr;
+    if(R[0] > biggest) { b = 1; biggest = R[0]; }
+    if(R[4] > biggest) { b = 2; biggest = R[4]; }
+    if(R[8] > biggest) { b = 3; }
+
+    const float u  = 1.0f +
+        cases[b].diagsign[0]*R[0] +
+        cases[b].diagsign[1]*R[4] +
+        cases[b].diagsign[2]*R[8];
+    const float qb = 0.5f*sqrtf(u);
+    const float k  = 0.25f/qb;
+
+    for(int c=0; c<4; c++)
+        q[c] = c == b ? qb :
+            k * (R[cases[b].i0[c]] + cases[b].sign[c]*R[cases[b].i1[c]]);
+
+    // I return w >= 0
+    const float flip = q[0] < 0.0f ? -1.0f : 1.0f;
+    for(int c=0; c<4; c++)
+        q[c] *= flip;
+
+    if(dq_dR == NULL)
+        return;
+
+    // dq_b/dR_ii = diagsign_i / (8 q_b). dq_c = (dnumerator - 4 q_c dq_b) / (4 q_b)
+    float dqb[9] = {};
+    for(int i=0; i<3; i++)
+        dqb[i*4] = cases[b].diagsign[i] * 0.125f/qb;
+
+    for(int c=0; c<4; c++)
+    {
+        for(int j=0; j<9; j++)
+        {
+            if(c == b)
+            {
+                dq_dR[c*9 + j] = flip * dqb[j];
+                continue;
+            }
+
+            // q[] is flipped already, so I un-flip to get the pre-flip q_c
+            float d = -(flip*q[c]) * dqb[j] / qb;
+            if(j == cases[b].i0[c]) d += k;
+            if(j == cases[b].i1[c]) d += k * cases[b].sign[c];
+            dq_dR[c*9 + j] = flip * d;
+        }
+    }
+}
+
+// r = v * th/|v|, where v = [x y z] and th = 2*atan2f(|v|, w). Near |v| = 0 I use
+// the Taylor series. Internal; used by rodrigues_from_rotation_f()
+static inline void minimath_rodrigues_from_quat_f(// output
+                                                float* restrict r,
+                                                float* restrict dr_dq, // may be NULL
+
+                                                // input
+                                                const float* restrict q)
+{
+    const float w  = q[0];
+    const float* v = &q[1];
+    const float s2 = norm2_vec_f(3, v);
+    const float n2 = s2 + w*w;
+
+    // f = th/|v|. g = (df/d|v|)/|v|
+    float f, g;
+    if(s2 < 1e-10*w*w)
+    {
+        f =  2.0f/w - 2.0f*s2/(3.0f*w*w*w);
+        g = -4.0f/(3.0f*w*w*w);
+    }
+    else
+    {
+        const float s = sqrtf(s2);
+        f = 2.0f*atan2f(s, w)/s;
+        g = (2.0f*w/n2 - f)/s2;
+    }
+
+    for(int i=0; i<3; i++)
+        r[i] = f*v[i];
+
+    if(dr_dq == NULL)
+        return;
+
+    // df/dw = -2/n2
+    for(int i=0; i<3; i++)
+    {
+        dr_dq[i*4 + 0] = -2.0f/n2 * v[i];
+        for(int j=0; j<3; j++)
+            dr_dq[i*4 + 1+j] = (i == j ? f : 0.0f) + g*v[i]*v[j];
+    }
+}
+
+// Computed through the quaternion, which is well-conditioned for all rotations,
+// including rotations by ~180 degrees
+static inline void rodrigues_from_rotation_f(// output
+                                           float* restrict r,
+                                           float* restrict dr_dR, // may be NULL
+
+                                           // input
+                                           const float* restrict R)
+{
+    float q[4];
+    if(dr_dR == NULL)
+    {
+        quat_from_rotation_f(q, NULL, R);
+        minimath_rodrigues_from_quat_f(r, NULL, q);
+        return;
+    }
+
+    float dq_dR[4*9], dr_dq[3*4];
+    quat_from_rotation_f(q, dq_dR, R);
+    minimath_rodrigues_from_quat_f(r, dr_dq, q);
+
+    for(int i=0; i<3; i++)
+        for(int j=0; j<9; j++)
+            dr_dR[i*9 + j] =
+                dr_dq[i*4 + 0]*dq_dR[0*9 + j] +
+                dr_dq[i*4 + 1]*dq_dR[1*9 + j] +
+                dr_dq[i*4 + 2]*dq_dR[2*9 + j] +
+                dr_dq[i*4 + 3]*dq_dR[3*9 + j];
+}
+
+// q = q0*q1 (the Hamilton product), so that rotation_from_quat_f(q) =
+// rotation_from_quat_f(q0) * rotation_from_quat_f(q1). Since this is bilinear, I don't
+// pick the sign of the result
+static inline void compose_quat_f(// output
+                                float* restrict q,
+                                float* restrict dq_dq0, // may be NULL
+                                float* restrict dq_dq1, // may be NULL
+
+                                // input
+                                const float* restrict q0,
+                                const float* restrict q1)
+{
+    const float a0 = q0[0], b0 = q0[1], c0 = q0[2], d0 = q0[3];
+    const float a1 = q1[0], b1 = q1[1], c1 = q1[2], d1 = q1[3];
+
+    q[0] = a0*a1 - b0*b1 - c0*c1 - d0*d1;
+    q[1] = a0*b1 + b0*a1 + c0*d1 - d0*c1;
+    q[2] = a0*c1 - b0*d1 + c0*a1 + d0*b1;
+    q[3] = a0*d1 + b0*c1 - c0*b1 + d0*a1;
+
+    if(dq_dq0 != NULL)
+    {
+        const float d[16] =
+            { a1, -b1, -c1, -d1,
+              b1,  a1,  d1, -c1,
+              c1, -d1,  a1,  b1,
+              d1,  c1, -b1,  a1 };
+        for(int i=0; i<16; i++) dq_dq0[i] = d[i];
+    }
+    if(dq_dq1 != NULL)
+    {
+        const float d[16] =
+            { a0, -b0, -c0, -d0,
+              b0,  a0, -d0,  c0,
+              c0,  d0,  a0, -b0,
+              d0, -c0,  b0,  a0 };
+        for(int i=0; i<16; i++) dq_dq1[i] = d[i];
+    }
+}
+
+// P = A*B for 3x3 matrices. Internal; I don't want minimath.h to depend on the
+// sizes chosen for minimath_generated.h
+static inline void minimath_mul_gen33_gen33_f(float* restrict P,
+                                            const float* restrict A, const float* restrict B)
+{
+    for(int i=0; i<3; i++)
+        for(int j=0; j<3; j++)
+            P[i*3 + j] = A[i*3 + 0]*B[0*3 + j] + A[i*3 + 1]*B[1*3 + j] + A[i*3 + 2]*B[2*3 + j];
+}
+
+// r = rodrigues_from_rotation_f( rotation_from_rodrigues_f(r0) *
+//                              rotation_from_rodrigues_f(r1) )
+static inline void compose_rodrigues_f(// output
+                                     float* restrict r,
+                                     float* restrict dr_dr0, // may be NULL
+                                     float* restrict dr_dr1, // may be NULL
+
+                                     // input
+                                     const float* restrict r0,
+                                     const float* restrict r1)
+{
+    const int grad = dr_dr0 != NULL || dr_dr1 != NULL;
+
+    float R0[9], R1[9], R[9];
+    float dR0_dr0[9*3], dR1_dr1[9*3], dr_dR[3*9];
+    rotation_from_rodrigues_f(R0, grad ? dR0_dr0 : NULL, r0);
+    rotation_from_rodrigues_f(R1, grad ? dR1_dr1 : NULL, r1);
+    minimath_mul_gen33_gen33_f(R, R0, R1);
+    rodrigues_from_rotation_f(r, grad ? dr_dR : NULL, R);
+
+    if(!grad)
+        return;
+
+    // dR/dr0_k = dR0/dr0_k * R1, dR/dr1_k = R0 * dR1/dr1_k. Then I apply dr/dR
+    for(int k=0; k<3; k++)
+    {
+        float dR0[9], dR1[9], dR[9];
+        for(int i=0; i<9; i++)
+        {
+            dR0[i] = dR0_dr0[i*3 + k];
+            dR1[i] = dR1_dr1[i*3 + k];
+        }
+
+        if(dr_dr0 != NULL)
+        {
+            minimath_mul_gen33_gen33_f(dR, dR0, R1);
+            for(int i=0; i<3; i++)
+                dr_dr0[i*3 + k] = dot_vec_f(9, &dr_dR[i*9], dR);
+        }
+        if(dr_dr1 != NULL)
+        {
+            minimath_mul_gen33_gen33_f(dR, R0, dR1);
+            for(int i=0; i<3; i++)
+                dr_dr1[i*3 + k] = dot_vec_f(9, &dr_dR[i*9], dR);
+        }
+    }
+}
+
+// N rotation conversions and compositions (structure-of-arrays): element j of
+// the input or output i lives in x[j*stride + i]. This applies to the gradients
+// also: element j of the row-first dR_dr of rotation i is dR_dr[j*stride + i].
+// The gradients may be NULL, as with the single-rotation functions
+static inline void rotation_from_rodrigues_soaN_f(int n, int stride,
+
+                                                // output
+                                                float* restrict R,
+                                                float* restrict dR_dr, // may be NULL
+
+                                                // input
+                                                const float* restrict r)
+{
+    MINIMATH_PARALLEL_FOR_f(n)
+    for(int i=0; i<n; i++)
+    {
+        float ri[3], Ri[9], dRi[9*3];
+        for(int j=0; j<3; j++) ri[j] = r[j*stride + i];
+        rotation_from_rodrigues_f(Ri, dR_dr ? dRi : NULL, ri);
+        for(int j=0; j<9; j++) R[j*stride + i] = Ri[j];
+        if(dR_dr)
+            for(int j=0; j<9*3; j++) dR_dr[j*stride + i] = dRi[j];
+    }
+}
+static inline void rodrigues_from_rotation_soaN_f(int n, int stride,
+
+                                                // output
+                                                float* restrict r,
+                                                float* restrict dr_dR, // may be NULL
+
+                                                // input
+                                                const float* restrict R)
+{
+    MINIMATH_PARALLEL_FOR_f(n)
+    for(int i=0; i<n; i++)
+    {
+        float Ri[9], ri[3], dri[3*9];
+        for(int j=0; j<9; j++) Ri[j] = R[j*stride + i];
+        rodrigues_from_rotation_f(ri, dr_dR ? dri : NULL, Ri);
+        for(int j=0; j<3; j++) r[j*stride + i] = ri[j];
+        if(dr_dR)
+            for(int j=0; j<3*9; j++) dr_dR[j*stride + i] = dri[j];
+    }
+}
+static inline void rotation_from_quat_soaN_f(int n, int stride,
+
+                                           // output
+                                           float* restrict R,
+                                           float* restrict dR_dq, // may be NULL
+
+                                           // input
+                                           const float* restrict q)
+{
+    MINIMATH_PARALLEL_FOR_f(n)
+    for(int i=0; i<n; i++)
+    {
+        float qi[4], Ri[9], dRi[9*4];
+        for(int j=0; j<4; j++) qi[j] = q[j*stride + i];
+        rotation_from_quat_f(Ri, dR_dq ? dRi : NULL, qi);
+        for(int j=0; j<9; j++) R[j*stride + i] = Ri[j];
+        if(dR_dq)
+            for(int j=0; j<9*4; j++) dR_dq[j*stride + i] = dRi[j];
+    }
+}
+static inline void quat_from_rotation_soaN_f(int n, int stride,
+
+                                           // output
+                                           float* restrict q,
+                                           float* restrict dq_dR, // may be NULL
+
+                                           // input
+                                           const float* restrict R)
+{
+    MINIMATH_PARALLEL_FOR_f(n)
+    for(int i=0; i<n; i++)
+    {
+        float Ri[9], qi[4], dqi[4*9];
+        for(int j=0; j<9; j++) Ri[j] = R[j*stride + i];
+        quat_from_rotation_f(qi, dq_dR ? dqi : NULL, Ri);
+        for(int j=0; j<4; j++) q[j*stride + i] = qi[j];
+        if(dq_dR)
+            for(int j=0; j<4*9; j++) dq_dR[j*stride + i] = dqi[j];
+    }
+}
+static inline void compose_quat_soaN_f(int n, int stride,
+
+                                     // output
+                                     float* restrict q,
+                                     float* restrict dq_dq0, // may be NULL
+                                     float* restrict dq_dq1, // may be NULL
+
+                                     // input
+                                     const float* restrict q0,
+                                     const float* restrict q1)
+{
+    MINIMATH_PARALLEL_FOR_f(n)
+    for(int i=0; i<n; i++)
+    {
+        float q0i[4], q1i[4], qi[4], d0[4*4], d1[4*4];
+        for(int j=0; j<4; j++)
+        {
+            q0i[j] = q0[j*stride + i];
+            q1i[j] = q1[j*stride + i];
+        }
+        compose_quat_f(qi, dq_dq0 ? d0 : NULL, dq_dq1 ? d1 : NULL, q0i, q1i);
+        for(int j=0; j<4; j++) q[j*stride + i] = qi[j];
+        if(dq_dq0)
+            for(int j=0; j<4*4; j++) dq_dq0[j*stride + i] = d0[j];
+        if(dq_dq1)
+            for(int j=0; j<4*4; j++) dq_dq1[j*stride + i] = d1[j];
+    }
+}
+static inline void compose_rodrigues_soaN_f(int n, int stride,
+
+                                          // output
+                                          float* restrict r,
+                                          float* restrict dr_dr0, // may be NULL
+                                          float* restrict dr_dr1, // may be NULL
+
+                                          // input
+                                          const float* restrict r0,
+                                          const float* restrict r1)
+{
+    MINIMATH_PARALLEL_FOR_f(n)
+    for(int i=0; i<n; i++)
+    {
+        float r0i[3], r1i[3], ri[3], d0[3*3], d1[3*3];
+        for(int j=0; j<3; j++)
+        {
+            r0i[j] = r0[j*stride + i];
+            r1i[j] = r1[j*stride + i];
+        }
+        compose_rodrigues_f(ri, dr_dr0 ? d0 : NULL, dr_dr1 ? d1 : NULL, r0i, r1i);
+        for(int j=0; j<3; j++) r[j*stride + i] = ri[j];
+        if(dr_dr0)
+            for(int j=0; j<3*3; j++) dr_dr0[j*stride + i] = d0[j];
+        if(dr_dr1)
+            for(int j=0; j<3*3; j++) dr_dr1[j*stride + i] = d1[j];
+    }
+}
+
+// Rigid transforms. An Rt transform is a 3x3 rotation R followed by a
+// translation t, stored in a float[12]: R row-first, then t. Like the 3x4
+// matrix [R t], except t is contiguous. It maps a point x to R*x + t. For row
+// vectors, as used everywhere else in this library, this is x*Rt + t. The
+// rotation and translation are applied in one pass over the points
+
+// Transforms a 3-vector: vout = R*x + t
+static inline void transform_vec3_Rt_vout_f(const float* restrict x, const float* restrict Rt, float* restrict vout)
+{
+    vout[0] = Rt[0]*x[0] + Rt[1]*x[1] + Rt[2]*x[2] + Rt[ 9];
+    vout[1] = Rt[3]*x[0] + Rt[4]*x[1] + Rt[5]*x[2] + Rt[10];
+    vout[2] = Rt[6]*x[0] + Rt[7]*x[1] + Rt[8]*x[2] + Rt[11];
+}
+static inline void transform_vec3_Rt_f(float* restrict x, const float* restrict Rt)
+{
+    float t[3];
+    transform_vec3_Rt_vout_f(x, Rt, t);
+    x[0] = t[0];
+    x[1] = t[1];
+    x[2] = t[2];
+}
+
+// Transforms N points stored contiguously, as an Nx3 matrix
+static inline void transform_genN3_Rt_vout_f(int n, const float* restrict x, const float* restrict Rt, float* restrict vout)
+{
+    MINIMATH_PARALLEL_FOR_f(n)
+    for(int i=0; i<n; i++)
+        transform_vec3_Rt_vout_f(x + 3*i, Rt, vout + 3*i);
+}
+static inline void transform_genN3_Rt_f(int n, float* restrict x, const float* restrict Rt)
+{
+    MINIMATH_PARALLEL_FOR_f(n)
+    for(int i=0; i<n; i++)
+        transform_vec3_Rt_f(x + 3*i, Rt);
+}
+
+// Transforms N points in a structure-of-arrays layout: coordinate j of point i
+// lives in x[j*stride + i]. The output uses the same layout
+static inline void transform_soaN3_Rt_vout_f(int n, int stride, const float* restrict x, const float* restrict Rt, float* restrict vout)
+{
+    const float r00 = Rt[0], r01 = Rt[1], r02 = Rt[2];
+    const float r10 = Rt[3], r11 = Rt[4], r12 = Rt[5];
+    const float r20 = Rt[6], r21 = Rt[7], r22 = Rt[8];
+    const float t0  = Rt[9], t1  = Rt[10], t2 = Rt[11];
+    MINIMATH_PARALLEL_FOR_f(n)
+    for(int i=0; i<n; i++)
+    {
+        const float x0 = x[0*stride + i];
+        const float x1 = x[1*stride + i];
+        const float x2 = x[2*stride + i];
+        vout[0*stride + i] = r00*x0 + r01*x1 + r02*x2 + t0;
+        vout[1*stride + i] = r10*x0 + r11*x1 + r12*x2 + t1;
+        vout[2*stride + i] = r20*x0 + r21*x1 + r22*x2 + t2;
+    }
+}
+static inline void transform_soaN3_Rt_f(int n, int stride, float* restrict x, const float* restrict Rt)
+{
+    const float r00 = Rt[0], r01 = Rt[1], r02 = Rt[2];
+    const float r10 = Rt[3], r11 = Rt[4], r12 = Rt[5];
+    const float r20 = Rt[6], r21 = Rt[7], r22 = Rt[8];
+    const float t0  = Rt[9], t1  = Rt[10], t2 = Rt[11];
+    MINIMATH_PARALLEL_FOR_f(n)
+    for(int i=0; i<n; i++)
+    {
+        const float x0 = x[0*stride + i];
+        const float x1 = x[1*stride + i];
+        const float x2 = x[2*stride + i];
+        x[0*stride + i] = r00*x0 + r01*x1 + r02*x2 + t0;
+        x[1*stride + i] = r10*x0 + r11*x1 + r12*x2 + t1;
+        x[2*stride + i] = r20*x0 + r21*x1 + r22*x2 + t2;
+    }
+}
+
+// Composition: vout = Rt0*Rt1, the transform that applies Rt1 and then Rt0. So
+// R = R0*R1 and t = R0*t1 + t0
+static inline void compose_Rt_vout_f(const float* restrict Rt0, const float* restrict Rt1, float* restrict vout)
+{
+    minimath_mul_gen33_gen33_f(vout, Rt0, Rt1);
+    transform_vec3_Rt_vout_f(&Rt1[9], Rt0, &vout[9]);
+}
+// Rt0 = Rt0*Rt1
+static inline void compose_Rt_f(float* restrict Rt0, const float* restrict Rt1)
+{
+    float t[12];
+    compose_Rt_vout_f(Rt0, Rt1, t);
+    for(int i=0; i<12; i++) Rt0[i] = t[i];
+}
+
+// Inverse: R -> Rt, t -> -Rt*t. Assumes R is a rotation
+static inline void invert_Rt_vout_f(const float* restrict Rt, float* restrict vout)
+{
+    for(int i=0; i<3; i++)
+        for(int j=0; j<3; j++)
+            vout[i*3 + j] = Rt[j*3 + i];
+    for(int i=0; i<3; i++)
+        vout[9 + i] = -(Rt[0*3 + i]*Rt[9] + Rt[1*3 + i]*Rt[10] + Rt[2*3 + i]*Rt[11]);
+}
+static inline void invert_Rt_f(float* restrict Rt)
+{
+    float t[12];
+    invert_Rt_vout_f(Rt, t);
+    for(int i=0; i<12; i++) Rt[i] = t[i];
+}
+
+// N compositions and inversions. The transforms are stored contiguously:
+// transform i is in Rt[12*i .. 12*i+11]
+static inline void compose_batchN_Rt_vout_f(int n, const float* restrict Rt0, const float* restrict Rt1, float* restrict vout)
+{
+    MINIMATH_PARALLEL_FOR_f(n)
+    for(int i=0; i<n; i++)
+        compose_Rt_vout_f(Rt0 + 12*i, Rt1 + 12*i, vout + 12*i);
+}
+static inline void compose_batchN_Rt_f(int n, float* restrict Rt0, const float* restrict Rt1)
+{
+    MINIMATH_PARALLEL_FOR_f(n)
+    for(int i=0; i<n; i++)
+        compose_Rt_f(Rt0 + 12*i, Rt1 + 12*i);
+}
+static inline void invert_batchN_Rt_vout_f(int n, const float* restrict Rt, float* restrict vout)
+{
+    MINIMATH_PARALLEL_FOR_f(n)
+    for(int i=0; i<n; i++)
+        invert_Rt_vout_f(Rt + 12*i, vout + 12*i);
+}
+static inline void invert_batchN_Rt_f(int n, float* restrict Rt)
+{
+    MINIMATH_PARALLEL_FOR_f(n)
+    for(int i=0; i<n; i++)
+        invert_Rt_f(Rt + 12*i);
+}
+
+// Batches of small matrices and vectors in an array-of-structures-of-arrays
+// layout. Each block holds MINIMATH_LANES objects, stored structure-of-arrays:
+// element j of object i of the block lives in x[j][i]. So x[0] of a block can be
+// given directly to the ..._soaN...() kernels, with stride = MINIMATH_LANES.
+// Each element row is contiguous across the lanes, so these are full aligned
+// vector loads, and a stream of blocks uses whole cache lines. The blocks are
+// aligned to 64 bytes. Arrays of blocks on the heap should be allocated with
+// aligned_alloc() to maintain that.
+//
+// The ..._pack() functions convert n objects in the usual packed layout (6
+// doubles per sym33 and so on, back-to-back) into aosoa_nblocks_f(n) blocks.
+// Unused lanes in the last block are filled with copies of the last object, so
+// the kernels can always process whole blocks without hitting garbage, and
+// with a compile-time trip count. The ..._unpack() functions do the reverse
+typedef struct { float x[ 3][MINIMATH_LANES]; } __attribute__((aligned(64))) aosoa_vec3_f;
+typedef struct { float x[ 6][MINIMATH_LANES]; } __attribute__((aligned(64))) aosoa_sym33_f;
+typedef struct { float x[ 9][MINIMATH_LANES]; } __attribute__((aligned(64))) aosoa_gen33_f;
+typedef struct { float x[21][MINIMATH_LANES]; } __attribute__((aligned(64))) aosoa_sym66_f;
+
+// The number of blocks needed to store n objects
+static inline int aosoa_nblocks_f(int n)
+{
+    return (n + MINIMATH_LANES - 1) / MINIMATH_LANES;
+}
+// The number of valid objects in block b of a batch of n objects. This is
+// MINIMATH_LANES, except possibly for the last block
+static inline int aosoa_block_lanes_f(int n, int b)
+{
+    const int nleft = n - b*MINIMATH_LANES;
+    return nleft < MINIMATH_LANES ? nleft : MINIMATH_LANES;
+}
+
+// Internal. blocks is an array of blocks, each nelem*MINIMATH_LANES doubles
+static inline void minimath_aosoa_pack_f(int n, int nelem,
+                                       // output
+                                       float* restrict blocks,
+                                       // input
+                                       const float* restrict v)
+{
+    for(int b=0; b<aosoa_nblocks_f(n); b++)
+    {
+        float* restrict block = &blocks[b*nelem*MINIMATH_LANES];
+        for(int lane=0; lane<MINIMATH_LANES; lane++)
+        {
+            int i = b*MINIMATH_LANES + lane;
+            if(i >= n) i = n-1;
+            for(int j=0; j<nelem; j++)
+                block[j*MINIMATH_LANES + lane] = v[i*nelem + j];
+        }
+    }
+}
+static inline void minimath_aosoa_unpack_f(int n, int nelem,
+                                         // output
+                                         float* restrict v,
+                                         // input
+                                         const float* restrict blocks)
+{
+    for(int b=0; b<aosoa_nblocks_f(n); b++)
+    {
+        const float* restrict block = &blocks[b*nelem*MINIMATH_LANES];
+        for(int lane=0; lane<aosoa_block_lanes_f(n, b); lane++)
+        {
+            const int i = b*MINIMATH_LANES + lane;
+            for(int j=0; j<nelem; j++)
+                v[i*nelem + j] = block[j*MINIMATH_LANES + lane];
+        }
+    }
+}
+
+static inline void aosoa_vec3_pack_f(int n, aosoa_vec3_f* restrict blocks, const float* restrict v)
+{
+    minimath_aosoa_pack_f(n, 3, blocks[0].x[0], v);
+}
+static inline void aosoa_vec3_unpack_f(int n, float* restrict v, const aosoa_vec3_f* restrict blocks)
+{
+    minimath_aosoa_unpack_f(n, 3, v, blocks[0].x[0]);
+}
+static inline void aosoa_sym33_pack_f(int n, aosoa_sym33_f* restrict blocks, const float* restrict s)
+{
+    minimath_aosoa_pack_f(n, 6, blocks[0].x[0], s);
+}
+static inline void aosoa_sym33_unpack_f(int n, float* restrict s, const aosoa_sym33_f* restrict blocks)
+{
+    minimath_aosoa_unpack_f(n, 6, s, blocks[0].x[0]);
+}
+static inline void aosoa_gen33_pack_f(int n, aosoa_gen33_f* restrict blocks, const float* restrict m)
+{
+    minimath_aosoa_pack_f(n, 9, blocks[0].x[0], m);
+}
+static inline void aosoa_gen33_unpack_f(int n, float* restrict m, const aosoa_gen33_f* restrict blocks)
+{
+    minimath_aosoa_unpack_f(n, 9, m, blocks[0].x[0]);
+}
+static inline void aosoa_sym66_pack_f(int n, aosoa_sym66_f* restrict blocks, const float* restrict s)
+{
+    minimath_aosoa_pack_f(n, 21, blocks[0].x[0], s);
+}
+static inline void aosoa_sym66_unpack_f(int n, float* restrict s, const aosoa_sym66_f* restrict blocks)
+{
+    minimath_aosoa_unpack_f(n, 21, s, blocks[0].x[0]);
+}
+
+#ifdef __cplusplus
+#undef restrict
+#endif
@@ -4,11 +4,128 @@ use warnings;
 use feature qw(say);
 use List::Util qw(min);
 use List::MoreUtils qw(pairwise);
+use Getopt::Long;
+
+my $usage = <<EOU;
+Usage: $0 [--float] [--sizes LIST] [--rect LIST] [--blocks LIST] [header.h ...]
+
+With no header arguments, generates the double-precision kernels to stdout.
+
+--sizes selects the sizes of the fully-unrolled kernels: a comma-separated list
+of sizes and ranges, such as "2-6,9,12". Defaults to 2-6
+
+--rect selects the NxM combinations of the rectangular kernels: a
+comma-separated list such as "3x9,9x3". The square NxN kernels for each of the
+--sizes are always generated. By default all the NxM pairs of the --sizes are
+generated
+
+--blocks selects the BxB blocks in packed symmetric NxN matrices that get
+unrolled block-access kernels: a comma-separated list such as "3in6,6in12".
+Defaults to 2in4,3in6,3in9,3in12,6in12
+
+--float makes everything single-precision: double becomes float, and every
+function, macro and struct type gets an _f suffix, so the double and float
+flavors can be used together. If headers are given, these are converted to
+their float flavors instead of generating anything.
+EOU
+
+my %options;
+GetOptions(\%options, 'float', 'sizes=s', 'rect=s', 'blocks=s', 'help') or die $usage;
+if($options{help})
+{
+  print $usage;
+  exit 0;
+}
+
+my @sizes = _parseSizes($options{sizes} // '2-6');
+
+# The NxM combinations for the rectangular kernels. The square ones are always
+# there: the matrix-matrix kernels use them
+my @rect;
+if(defined $options{rect})
+{
+  my %seen;
+  foreach my $nm ((split /,/, $options{rect}), (map {"${_}x$_"} @sizes))
+  {
+    my ($n,$m) = $nm =~ /^\s*(\d+)\s*x\s*(\d+)\s*$/ or die "Couldn't parse NxM combination '$nm'\n$usage";
+    die "Sizes must be >= 2; got '$nm'" if $n < 2 || $m < 2;
+    push @rect, [$n, $m] unless $seen{"${n}x$m"}++;
+  }
+}
+else
+{
+  @rect = map { my $n = $_; map {[$n, $_]} @sizes } @sizes;
+}
+
+# The BxB blocks in packed NxN symmetric matrices
+my @blocks;
+{
+  my %seen;
+  foreach my $bn (split /,/, $options{blocks} // '2in4,3in6,3in9,3in12,6in12')
+  {
+    my ($b,$n) = $bn =~ /^\s*(\d+)\s*in\s*(\d+)\s*$/ or die "Couldn't parse block 'BinN' '$bn'\n$usage";
+    die "Need 2 <= B <= N; got '$bn'" if $b < 2 || $n < $b;
+    push @blocks, [$b, $n] unless $seen{"${b}in$n"}++;
+  }
+
+  # minimath-extra.h uses these
+  push @blocks, [3, 6] unless $seen{"3in6"}++;
+}
+
+if(@ARGV)
+{
+  die "Given headers to convert, but not asked for --float\n$usage" unless $options{float};
+
+  foreach my $header (@ARGV)
+  {
+    open my $fd, '<', $header or die "Couldn't open '$header'";
+    local $/ = undef;
+    my $contents = <$fd>;
+
+    # The functions defined in the headers this one includes are renamed also
+    my ($dir) = $header =~ m{^(.*/)?} ;
+    my %names = _collectIncludedNames($contents, $dir // '');
+
+    say "// THIS IS AUTO-GENERATED BY $0 FROM $header. DO NOT EDIT BY HAND\n";
+    print _makeFloat($contents, %names);
+  }
+  exit 0;
+}
+
+# I accumulate all the output, and postprocess it at the end, if needed
+open my $fdout, '>', \my $output or die "Couldn't open output buffer";
+select $fdout;
 
 say "// THIS IS AUTO-GENERATED BY $0. DO NOT EDIT BY HAND\n";
+say "#pragma once\n";
+say "#include <math.h>\n";
+say <<EOC;
+// The batched solvers process this many systems at a time. This should be at
+// least the SIMD width
+#ifndef MINIMATH_LANES
+#define MINIMATH_LANES 8
+#endif
+
+// The loops over the N rows, vectors or systems of the genN, soaN and batchN
+// functions are split across the threads of the OpenMP pool if built with
+// -fopenmp, and if there are at least MINIMATH_PARALLEL_MIN_ROWS iterations. The
+// threads take chunks of MINIMATH_PARALLEL_CHUNK iterations. Without -fopenmp
+// MINIMATH_PARALLEL_FOR() does nothing
+#ifndef MINIMATH_PARALLEL_MIN_ROWS
+#define MINIMATH_PARALLEL_MIN_ROWS 100000
+#endif
+#ifndef MINIMATH_PARALLEL_CHUNK
+#define MINIMATH_PARALLEL_CHUNK 4096
+#endif
+#ifdef _OPENMP
+#define MINIMATH_PRAGMA(x) _Pragma(#x)
+#define MINIMATH_PARALLEL_FOR(n) MINIMATH_PRAGMA(omp parallel for schedule(static, MINIMATH_PARALLEL_CHUNK) if((n) >= MINIMATH_PARALLEL_MIN_ROWS))
+#else
+#define MINIMATH_PARALLEL_FOR(n)
+#endif
+EOC
 say "// This contains dot products, norms, basic vector arithmetic and multiplication\n";
-
-my @sizes = 2..6;
+say "// Generated for sizes " . join(',', @sizes) . "\n";
 
 # the dot products, norms and basic arithmetic functions take the size as an
 # argument. I'm assuming that the compiler will expand these out for each
@@ -17,21 +134,107 @@ dotProducts();
 norms();
 vectorArithmetic();
 
+# index tables for the packed symmetric matrices. Everything else is generated
+# for particular sizes, but these are tiny, so I always generate the useful
+# ones
+my %symIndexSizes = map {$_ => 1} 2..12, map {$_->[1]} @blocks;
+symIndexTables(sort {$a <=> $b} keys %symIndexSizes);
+
+my %sizes = map {$_ => 1} @sizes;
 foreach my $n(@sizes)
 {
   matrixVectorSym($n);
 
-  foreach my $m (@sizes)
+  foreach my $nm (grep {$_->[0] == $n} @rect)
   {
-    matrixVectorGen($n, $m)
+    matrixVectorGen(@$nm)
   }
 
   matrixMatrixSym($n);
   matrixMatrixGen($n);
 }
 
-# this is only defined for N=3. I haven't made the others yet and I don't yet need them
-matrixMatrixMatrixSym(3);
+# fully-unrolled products of fixed-size matrices
+foreach my $n(@sizes)
+{
+  foreach my $m(@sizes)
+  {
+    foreach my $l(@sizes)
+    {
+      matrixMatrixGenFixed($n, $m, $l);
+    }
+  }
+}
+
+# rectangular kernels whose row count isn't one of the --sizes
+foreach my $nm (grep {!$sizes{$_->[0]}} @rect)
+{
+  matrixVectorGen(@$nm)
+}
+
+# symmetric sandwich products: A*B*A and J*S*Jt
+foreach my $n(@sizes)
+{
+  matrixMatrixMatrixSym($n);
+}
+foreach my $n(@sizes)
+{
+  foreach my $m(@sizes)
+  {
+    matrixSandwichSym($n, $m);
+  }
+}
+
+# Cholesky factorizations and the corresponding solvers
+foreach my $n(@sizes)
+{
+  triangularSolve($n);
+  cholSym($n);
+  cholUpdate($n);
+  ldltSym($n);
+  cholSolveBatch($n);
+  qrUpdate($n);
+
+  foreach my $k(1..3)
+  {
+    normalAccum($k, $n);
+  }
+}
+
+# cofactors of the larger symmetric matrices. The smaller ones are in minimath.h
+foreach my $n(4..6)
+{
+  cofactorsSym($n);
+}
+
+# access to blocks of packed symmetric matrices
+foreach my $bn(@blocks)
+{
+  symBlocks(@$bn);
+}
+
+# symmetric rank-k updates. The number of rows is given at runtime, so these
+# don't take much space, and I always generate all the useful sizes
+foreach my $n(2..12)
+{
+  syrk($n);
+}
+
+# Mixed-precision solvers: these factor in single precision, and refine the
+# solution in double precision. They use the float kernels, so these only exist
+# in the double-precision header
+if(!$options{float})
+{
+  say '#include "minimath_generated_f.h"' . "\n";
+  foreach my $n(@sizes)
+  {
+    solveRefine($n);
+  }
+}
+
+select STDOUT;
+close $fdout;
+print $options{float} ? _makeFloat($output) : $output;
 
 
 
@@ -117,8 +320,9 @@ EOC
 
   $vout .= "}";
 
-
-  print _multiplicationVersions($vout, $n, $n);
+  my $funcs = _multiplicationVersions($vout, $n, $n);
+  print $funcs;
+  print _makeSoa($funcs);
 }
 
 
@@ -150,7 +354,9 @@ EOC
   }
 
   $vout .= "}";
-  print _multiplicationVersions($vout, $m, $n);
+  my $funcs = _multiplicationVersions($vout, $m, $n);
+  print $funcs;
+  print _makeSoa($funcs);
 
 
 # now the transposed version
@@ -172,7 +378,9 @@ EOC
   }
 
   $vout .= "}";
-  print _multiplicationVersions($vout, $m,$n);
+  $funcs = _multiplicationVersions($vout, $m,$n);
+  print $funcs;
+  print _makeSoa($funcs);
 }
 
 sub matrixMatrixSym
@@ -188,6 +396,7 @@ sub matrixMatrixSym
 // general Nx$n matrix by symmetric ${n}x$n
 static inline void mul_genN${n}_sym${n}${n}_vout(int n, const double* restrict v, const double* restrict s, double* restrict vout)
 {
+  MINIMATH_PARALLEL_FOR(n)
   for(int i=0; i<n; i++)
     mul_vec${n}_sym${n}${n}_vout(v + $n*i, s, vout + $n*i);
 }
@@ -199,53 +408,65 @@ EOC
 sub matrixMatrixMatrixSym
 {
   my $n = shift;
-  die 'matrixMatrixMatrixSym ONLY defined for $n==3 right now' if $n != 3;
-
 
-  print <<'EOC';
-// (%i2) sym3 : matrix([m0,m1,m2],
-//                      [m1,m3,m4],
-//                      [m2,m4,m5]);
+  # symmetric A * B * A. The result is symmetric, and stored packed
+  _sandwichSym("mul_sym$n${n}_sym$n${n}_sym$n$n", "symmetric A * B * A",
+               'a', 'b', $n, $n,
+               sub { _symIndex($_[0], $_[1], $n) });
+}
 
-// (%o2) matrix([m0,m1,m2],[m1,m3,m4],[m2,m4,m5])
-// (%i3) sym3_a : matrix([a0,a1,a2],
-//                       [a1,a3,a4],
-//                       [a2,a4,a5]);
+sub matrixSandwichSym
+{
+  my $n = shift;
+  my $m = shift;
 
-// (%o3) matrix([a0,a1,a2],[a1,a3,a4],[a2,a4,a5])
-// (%i4) sym3_b : matrix([b0,b1,b2],
-//                       [b1,b3,b4],
-//                       [b2,b4,b5]);
+  # J * S * Jt, where J is a general NxM matrix and S is a symmetric MxM. This
+  # is the usual covariance propagation. The result is symmetric, and stored
+  # packed
+  _sandwichSym("mul_gen$n${m}_sym$m${m}_gen$n${m}t", "${n}x$m matrix J by symmetric ${m}x$m S by Jt: J * S * Jt",
+               'j', 's', $n, $m,
+               sub { $_[0]*$m + $_[1] });
+}
 
-// (%o4) matrix([b0,b1,b2],[b1,b3,b4],[b2,b4,b5])
-// (%i5) sym3_a . sym3_b . sym3_a;
+sub _sandwichSym
+{
+  my ($name, $comment, $jname, $sname, $n, $m, $ij) = @_;
 
-// (%o5) matrix([a2*(a2*b5+a1*b4+a0*b2)+a1*(a2*b4+a1*b3+a0*b1) + a0*(a2*b2+a1*b1+a0*b0), a2*(a4*b5+a3*b4+a1*b2)+a1*(a4*b4+a3*b3+a1*b1) + a0*(a4*b2+a3*b1+a1*b0), a2*(a5*b5+a4*b4+a2*b2)+a1*(a5*b4+a4*b3+a2*b1) + a0*(a5*b2+a4*b1+a2*b0)],
-//              [a4*(a2*b5+a1*b4+a0*b2)+a3*(a2*b4+a1*b3+a0*b1) + a1*(a2*b2+a1*b1+a0*b0), a4*(a4*b5+a3*b4+a1*b2)+a3*(a4*b4+a3*b3+a1*b1) + a1*(a4*b2+a3*b1+a1*b0), a4*(a5*b5+a4*b4+a2*b2)+a3*(a5*b4+a4*b3+a2*b1) + a1*(a5*b2+a4*b1+a2*b0)],
-//              [a5*(a2*b5+a1*b4+a0*b2)+a4*(a2*b4+a1*b3+a0*b1) + a2*(a2*b2+a1*b1+a0*b0), a5*(a4*b5+a3*b4+a1*b2)+a4*(a4*b4+a3*b3+a1*b1) + a2*(a4*b2+a3*b1+a1*b0), a5*(a5*b5+a4*b4+a2*b2)+a4*(a5*b4+a4*b3+a2*b1) + a2*(a5*b2+a4*b1+a2*b0)])
+  # I compute t = J*S, and then only the upper triangle of t*Jt
+  my $vout = <<EOC;
+// $comment
+static inline void ${name}_vout(const double* restrict $jname, const double* restrict $sname, double* restrict vout)
+{
 EOC
 
-  my $vout = <<'EOC';
-// symmetric A * B * A
-static inline void mul_sym33_sym33_sym33_vout(const double* restrict a, const double* restrict b, double* restrict vout)
-{
-  double t0 = a[2]*b[5]+a[1]*b[4]+a[0]*b[2];
-  double t1 = a[2]*b[4]+a[1]*b[3]+a[0]*b[1];
-  double t2 = a[2]*b[2]+a[1]*b[1]+a[0]*b[0];
-  double t3 = a[4]*b[2]+a[3]*b[1]+a[1]*b[0];
-  double t4 = a[4]*b[5]+a[3]*b[4]+a[1]*b[2];
-  double t5 = a[4]*b[4]+a[3]*b[3]+a[1]*b[1];
+  my @t;
+  for my $i(0..$n-1)
+  {
+    for my $k(0..$m-1)
+    {
+      push @t, join(' + ', map { "${jname}[" . $ij->($i,$_) . "]*${sname}[" . _symIndex($_, $k, $m) . "]" } 0..$m-1);
+    }
+  }
+  $vout .= "  double t[" . ($n*$m) . "] =\n";
+  $vout .= "    { " .
+    join(",\n      ", map { join(', ', @t[$_*$m .. ($_+1)*$m-1]) } 0..$n-1) .
+    " };\n";
 
-  vout[0] = a[2]*t0+a[1]*t1+a[0]*t2;
-  vout[1] = a[4]*t0+a[3]*t1+a[1]*t2;
-  vout[2] = a[5]*t0+a[4]*t1+a[2]*t2;
-  vout[3] = a[4]*t4+a[3]*t5+a[1]*t3;
-  vout[4] = a[5]*t4+a[4]*t5+a[2]*t3;
-  vout[5] = a[5]*(a[5]*b[5]+a[4]*b[4]+a[2]*b[2])+a[4]*(a[5]*b[4]+a[4]*b[3]+a[2]*b[1]) + a[2]*(a[5]*b[2]+a[4]*b[1]+a[2]*b[0]);
-}
-EOC
+  for my $i(0..$n-1)
+  {
+    for my $j($i..$n-1)
+    {
+      my @sum_components = map { "t[" . ($i*$m + $_) . "]*${jname}[" . $ij->($j,$_) . "]" } 0..$m-1;
+      $vout .= "  vout[" . _symIndex($i, $j, $n) . "] = " . join(' + ', @sum_components) . ";\n";
+    }
+  }
+  $vout .= "}";
 
-  print $vout;
+  # The temporaries are defined with an initializer list, so the _scaled
+  # versions only scale the output
+  my $funcs = $vout . "\n" . _makeVaccum($vout) . "\n";
+  print $funcs;
+  print _makeScaled_mulVector($funcs);
 }
 
 sub matrixMatrixGen
@@ -261,6 +482,7 @@ sub matrixMatrixGen
 // general Nx${n} matrix by general ${n}x${n}
 static inline void mul_genN${n}_gen${n}${n}_vout(int n, const double* restrict v, const double* restrict m, double* restrict vout)
 {
+  MINIMATH_PARALLEL_FOR(n)
   for(int i=0; i<n; i++)
     mul_vec${n}_gen${n}${n}_vout(v + $n*i, m, vout + $n*i);
 }
@@ -268,6 +490,7 @@ static inline void mul_genN${n}_gen${n}${n}_vout(int n, const double* restrict v
 // general Nx${n} matrix by general ${n}x${n}
 static inline void mul_genN${n}_gen${n}${n}t_vout(int n, const double* restrict v, const double* restrict mt, double* restrict vout)
 {
+  MINIMATH_PARALLEL_FOR(n)
   for(int i=0; i<n; i++)
     mul_vec${n}_gen${n}${n}t_vout(v + $n*i, mt, vout + $n*i);
 }
@@ -283,6 +506,849 @@ EOC
 
 
 
+sub matrixMatrixGenFixed
+{
+  my ($n, $m, $l) = @_;
+
+  # (N,L) <- (N,M) * (M,L), fully unrolled. Either of the inputs may be stored
+  # transposed. These replace the runtime-looped mul_genNM_genML() in
+  # minimath-extra.h when the sizes are known at compile time
+  my @flavors =
+    ( # name,                           comment,                               a index,            b index
+      ["mul_gen$n${m}_gen$m${l}",  "${n}x$m matrix by ${m}x$l matrix",             sub {$_[0]*$m + $_[1]}, sub {$_[0]*$l + $_[1]}],
+      ["mul_gen$m${n}t_gen$m${l}", "${m}x$n-transposed matrix by ${m}x$l matrix",  sub {$_[1]*$n + $_[0]}, sub {$_[0]*$l + $_[1]}],
+      ["mul_gen$n${m}_gen$l${m}t", "${n}x$m matrix by ${l}x$m-transposed matrix",  sub {$_[0]*$m + $_[1]}, sub {$_[1]*$m + $_[0]}] );
+
+  my $funcs = '';
+  foreach my $flavor (@flavors)
+  {
+    my ($name, $comment, $ia, $ib) = @$flavor;
+
+    my $vout = <<EOC;
+// $comment
+static inline void ${name}_vout(const double* restrict a, const double* restrict b, double* restrict vout)
+{
+EOC
+
+    for my $i(0..$n-1)
+    {
+      for my $j(0..$l-1)
+      {
+        my @sum_components = map { "a[" . $ia->($i,$_) . "]*b[" . $ib->($_,$j) . "]" } 0..$m-1;
+        $vout .= "  vout[" . ($i*$l + $j) . "] = " . join(' + ', @sum_components) . ";\n";
+      }
+    }
+    $vout .= "}";
+
+    $funcs .= $vout . "\n";
+    $funcs .= _makeVaccum($vout) . "\n";
+  }
+
+  print $funcs;
+  print _makeScaled_mulVector($funcs);
+  print "\n";
+}
+
+sub triangularSolve
+{
+  my $n = shift;
+
+  # Solves with the packed upper- and lower-triangular matrices from minimath.h,
+  # without forming the inverse. The upper-triangular matrices use the same
+  # layout as the symmetric ones. The lower-triangular ones are stored row-first
+  # also, so row i has i+1 elements
+  my $ut = sub { _symIndex($_[0], $_[1], $n) };
+  my $lt = sub { $_[0]*($_[0]+1)/2 + $_[1] };
+
+  my @flavors =
+    ( # name,    comment,                                         matrix, index,                   forward?
+      ["ut$n",  "upper-triangular ${n}x$n U: U*x = v",            'u',    $ut,                     0],
+      ["ut${n}t","upper-triangular ${n}x$n U: Ut*x = v",          'u',    sub { $ut->($_[1],$_[0]) }, 1],
+      ["lt$n",  "lower-triangular ${n}x$n L: L*x = v",            'l',    $lt,                     1],
+      ["lt${n}t","lower-triangular ${n}x$n L: Lt*x = v",          'l',    sub { $lt->($_[1],$_[0]) }, 0] );
+
+  my $funcs = '';
+  foreach my $flavor (@flavors)
+  {
+    my ($name, $comment, $m, $index, $forward) = @$flavor;
+
+    # $index->(i,k) is the element that multiplies x_k in equation i. The
+    # reciprocals of the diagonal don't depend on each other, so I compute them
+    # up-front to keep the divisions off the substitution dependency chain
+    my $vout = <<EOC;
+// Solves a system with $comment
+static inline void solve_${name}_vout(const double* restrict v, const double* restrict $m, double* restrict vout)
+{
+EOC
+    for my $i(0..$n-1)
+    {
+      $vout .= "  const double inv$i = 1.0 / ${m}[" . $index->($i,$i) . "];\n";
+    }
+    for my $i($forward ? (0..$n-1) : reverse(0..$n-1))
+    {
+      my @known = $forward ? (0..$i-1) : ($i+1..$n-1);
+      my $sum = join(' - ', "v[$i]", map { "${m}[" . $index->($i,$_) . "]*x$_" } @known);
+      $vout .= "  const double x$i = " . (@known ? "($sum)" : $sum) . " * inv$i;\n";
+    }
+    $vout .= join('', map { "  vout[$_] = x$_;\n" } 0..$n-1);
+    $vout .= "}";
+
+    # All the reads of v happen before any writes of vout, so the in-place
+    # version is safe
+    $funcs .= $vout . "\n\n" . _makeInplace_mulVector($vout, 'v') . "\n\n";
+
+    # and the multiple-right-hand-side versions
+    $funcs .= <<EOC;
+// Solves N systems with $comment. Each row of v is a
+// separate right-hand side
+static inline void solve_genN${n}_${name}_vout(int n, const double* restrict v, const double* restrict $m, double* restrict vout)
+{
+  MINIMATH_PARALLEL_FOR(n)
+  for(int i=0; i<n; i++)
+    solve_${name}_vout(v + $n*i, $m, vout + $n*i);
+}
+
+// Solves N systems with $comment. Each row of v is a
+// separate right-hand side
+static inline void solve_genN${n}_${name}(int n, double* restrict v, const double* restrict $m)
+{
+  MINIMATH_PARALLEL_FOR(n)
+  for(int i=0; i<n; i++)
+    solve_${name}(v + $n*i, $m);
+}
+
+EOC
+  }
+
+  print $funcs;
+}
+
+sub cholSym
+{
+  my $n = shift;
+
+  # S = Ut*U, where U is upper-triangular. U is stored in the same packed layout
+  # as the upper-triangular matrices in minimath.h, which is the same as the
+  # layout of the symmetric matrices. So the factorization can be done in-place.
+  # Returns 1 on success, or 0 if the matrix isn't positive-definite
+  my $vout = <<EOC;
+// Cholesky factorization of a symmetric ${n}x$n matrix: S = Ut*U. Returns 1 on
+// success, 0 if S is not positive-definite
+static inline int chol_sym$n${n}_vout(const double* restrict s, double* restrict vout)
+{
+  double d, inv;
+EOC
+
+  for my $i(0..$n-1)
+  {
+    my $ii = _symIndex($i, $i, $n);
+    $vout .= "\n  d = " . join(' - ', "s[$ii]", map { my $ki = _symIndex($_, $i, $n); "vout[$ki]*vout[$ki]" } 0..$i-1) . ";\n";
+    $vout .= "  if(!(d > 0.0)) return 0;\n";
+    $vout .= "  vout[$ii] = sqrt(d);\n";
+    next if $i == $n-1;
+
+    $vout .= "  inv = 1.0 / vout[$ii];\n";
+    for my $j($i+1..$n-1)
+    {
+      my $ij = _symIndex($i, $j, $n);
+      my $sum = join(' - ', "s[$ij]", map { "vout[" . _symIndex($_, $i, $n) . "]*vout[" . _symIndex($_, $j, $n) . "]" } 0..$i-1);
+      $vout .= "  vout[$ij] = " . ($i ? "($sum)" : $sum) . " * inv;\n";
+    }
+  }
+  $vout .= "  return 1;\n}";
+
+  print $vout . "\n\n";
+  print _makeInplace_mulVector($vout, 's') . "\n\n";
+
+  # Solve S*x = v, given the factor U from chol_symNN(). This is a forward
+  # substitution with Ut followed by a back substitution with U
+  print <<EOC;
+// Solves S*x = v for a symmetric ${n}x$n S, given its Cholesky factor U from
+// chol_sym$n${n}()
+static inline void solve_sym$n${n}_chol_vout(const double* restrict v, const double* restrict u, double* restrict vout)
+{
+  solve_ut${n}t_vout(v, u, vout);
+  solve_ut$n(vout, u);
+}
+
+// Solves S*x = v for a symmetric ${n}x$n S, given its Cholesky factor U from
+// chol_sym$n${n}()
+static inline void solve_sym$n${n}_chol(double* restrict v, const double* restrict u)
+{
+  solve_ut${n}t(v, u);
+  solve_ut$n(v, u);
+}
+
+EOC
+}
+
+sub cholUpdate
+{
+  my $n = shift;
+
+  # Rank-1 update and downdate of a Cholesky factor: given S = Ut*U, compute the
+  # factor of S + x*xt or S - x*xt in O(N^2). Each row of U is rotated against x
+  # in turn. The downdate fails if the result would not be positive-definite.
+  # Each element of u is read before the corresponding element of vout is
+  # written, so the in-place versions are safe
+  for my $what( ['update',   '+', 'S + x*xt'],
+                ['downdate', '-', 'S - x*xt'] )
+  {
+    my ($name, $op, $desc) = @$what;
+    my $isdown = $name eq 'downdate';
+    my $rettype = $isdown ? 'int' : 'void';
+
+    my $vout = "// Given the Cholesky factor U of a symmetric ${n}x$n S = Ut*U (from chol_sym$n${n}()),\n" .
+      "// computes the factor of $desc\n";
+    $vout .= "// Returns 1 on success, or 0 if the result is not positive-definite. The\n" .
+      "// in-place version leaves u partially updated in that case\n" if $isdown;
+    $vout .= "static inline $rettype chol_sym$n${n}_${name}_vout(const double* restrict u, const double* restrict x, double* restrict vout)\n{\n";
+    $vout .= "  double " . join(', ', map { "x$_ = x[$_]" } 0..$n-1) . ";\n";
+    $vout .= "  double r2, r, c, s;\n";
+
+    for my $k(0..$n-1)
+    {
+      my $kk = _symIndex($k, $k, $n);
+      $vout .= "\n  r2 = u[$kk]*u[$kk] $op x$k*x$k;\n";
+      $vout .= "  if(!(r2 > 0.0)) return 0;\n" if $isdown;
+      $vout .= "  r = sqrt(r2);\n";
+      if($k == $n-1)
+      {
+        $vout .= "  vout[$kk] = r;\n";
+        last;
+      }
+      $vout .= "  c = r / u[$kk];\n";
+      $vout .= "  s = x$k / u[$kk];\n";
+      $vout .= "  vout[$kk] = r;\n";
+      for my $j($k+1..$n-1)
+      {
+        my $kj = _symIndex($k, $j, $n);
+        $vout .= "  vout[$kj] = (u[$kj] $op s*x$j) / c;\n";
+        $vout .= "  x$j = c*x$j - s*vout[$kj];\n";
+      }
+    }
+    $vout .= $isdown ? "  return 1;\n}" : "}";
+
+    print $vout . "\n\n";
+    print _makeInplace_mulVector($vout, 'u') . "\n\n";
+  }
+}
+
+sub ldltSym
+{
+  my $n = shift;
+
+  # S = Ut*D*U, where U is unit upper-triangular and D is diagonal. This needs
+  # no square roots, and works with semi-definite matrices. D is stored on the
+  # diagonal and U above it, in the same packed layout as S, so the
+  # factorization can be done in-place. A pivot d_i <= eps*|S_ii| is taken to be
+  # 0: the diagonal element and the rest of that row are then set to 0. Returns
+  # the number of non-zero pivots: the rank
+  my $vout = <<EOC;
+// LDLt factorization of a symmetric ${n}x$n matrix: S = Ut*D*U. D is stored on
+// the diagonal, and the unit upper-triangular U above it. Pivots below
+// eps*|S_ii| are set to 0. Returns the number of non-zero pivots
+static inline int ldlt_sym$n${n}_vout(const double* restrict s, double* restrict vout, double eps)
+{
+  int rank = 0;
+EOC
+
+  for my $i(0..$n-1)
+  {
+    my $ii = _symIndex($i, $i, $n);
+    $vout .= "\n  {\n";
+
+    # w_k = d_k*u_ki
+    for my $k(0..$i-1)
+    {
+      $vout .= "    const double w$k = vout[" . _symIndex($k, $i, $n) . "]*vout[" . _symIndex($k, $k, $n) . "];\n";
+    }
+    $vout .= "    const double d = " . join(' - ', "s[$ii]", map { "w$_*vout[" . _symIndex($_, $i, $n) . "]" } 0..$i-1) . ";\n";
+    $vout .= "    if(d > eps*fabs(s[$ii]))\n    {\n";
+    $vout .= "      rank++;\n";
+    $vout .= "      vout[$ii] = d;\n";
+    if($i < $n-1)
+    {
+      $vout .= "      const double inv = 1.0 / d;\n";
+      for my $j($i+1..$n-1)
+      {
+        my $ij = _symIndex($i, $j, $n);
+        my $sum = join(' - ', "s[$ij]", map { "w$_*vout[" . _symIndex($_, $j, $n) . "]" } 0..$i-1);
+        $vout .= "      vout[$ij] = " . ($i ? "($sum)" : $sum) . " * inv;\n";
+      }
+    }
+    $vout .= "    }\n    else\n    {\n";
+    $vout .= join('', map { "      vout[" . _symIndex($i, $_, $n) . "] = 0.0;\n" } $i..$n-1);
+    $vout .= "    }\n  }\n";
+  }
+  $vout .= "  return rank;\n}";
+
+  print $vout . "\n\n";
+  print _makeInplace_mulVector($vout, 's') . "\n\n";
+
+  # Solve S*x = v, given the factorization from ldlt_symNN(). The components
+  # corresponding to 0 pivots are set to 0, so for a singular S this produces a
+  # solution in the subspace the factorization could resolve. As with the
+  # Cholesky solver, all the reads of v happen before any writes of vout
+  $vout = <<EOC;
+// Solves S*x = v for a symmetric ${n}x$n S, given its LDLt factorization from
+// ldlt_sym$n${n}(). Components corresponding to 0 pivots are set to 0
+static inline void solve_sym$n${n}_ldlt_vout(const double* restrict v, const double* restrict l, double* restrict vout)
+{
+EOC
+
+  for my $i(0..$n-1)
+  {
+    my $sum = join(' - ', "v[$i]", map { "l[" . _symIndex($_, $i, $n) . "]*y$_" } 0..$i-1);
+    $vout .= "  const double y$i = $sum;\n";
+  }
+  for my $i(0..$n-1)
+  {
+    my $ii = _symIndex($i, $i, $n);
+    $vout .= "  const double z$i = l[$ii] != 0.0 ? y$i / l[$ii] : 0.0;\n";
+  }
+  for my $i(reverse 0..$n-1)
+  {
+    # the rows of U with 0 pivots are 0, so x_i = z_i = 0 there already
+    my $sum = join(' - ', "z$i", map { "l[" . _symIndex($i, $_, $n) . "]*x$_" } $i+1..$n-1);
+    $vout .= "  const double x$i = $sum;\n";
+  }
+  $vout .= join('', map { "  vout[$_] = x$_;\n" } 0..$n-1);
+  $vout .= "}";
+
+  print $vout . "\n\n";
+  print _makeInplace_mulVector($vout, 'v') . "\n\n";
+}
+
+sub cholSolveBatch
+{
+  my $n = shift;
+  my $ns = $n*($n+1)/2;
+
+  # Many independent systems, solved with a Cholesky factorization. The
+  # structure-of-arrays kernel has no branches in the lane loop, so the compiler
+  # can vectorize across systems. A system that isn't positive-definite produces
+  # NaN, instead of an early exit. The sqrt() only vectorizes with
+  # -fno-math-errno
+  my $soa = <<EOC;
+// N symmetric ${n}x$n systems S*x = v (structure-of-arrays): element j of system i
+// lives in s[j*stride + i], v[j*stride + i]. Solved with a Cholesky
+// factorization. The solutions of systems that aren't positive-definite are NaN.
+// If det is non-NULL, the determinants are written to det[0..n-1]
+static inline void solve_soaN_sym$n${n}_chol(int n, int stride, const double* restrict s, const double* restrict v, double* restrict vout, double* restrict det)
+{
+  MINIMATH_PARALLEL_FOR(n)
+  for(int i=0; i<n; i++)
+  {
+EOC
+
+  for my $i(0..$n-1)
+  {
+    my $ii = _symIndex($i, $i, $n);
+    my $d = join(' - ', "s[$ii*stride + i]", map { "u" . _symIndex($_, $i, $n) . "*u" . _symIndex($_, $i, $n) } 0..$i-1);
+    $soa .= "    const double u$ii = sqrt($d);\n";
+    $soa .= "    const double inv$i = 1.0 / u$ii;\n";
+    for my $j($i+1..$n-1)
+    {
+      my $ij = _symIndex($i, $j, $n);
+      my $sum = join(' - ', "s[$ij*stride + i]", map { "u" . _symIndex($_, $i, $n) . "*u" . _symIndex($_, $j, $n) } 0..$i-1);
+      $soa .= "    const double u$ij = " . ($i ? "($sum)" : $sum) . " * inv$i;\n";
+    }
+  }
+  for my $i(0..$n-1)
+  {
+    my $sum = join(' - ', "v[$i*stride + i]", map { "u" . _symIndex($_, $i, $n) . "*y$_" } 0..$i-1);
+    $soa .= "    const double y$i = " . ($i ? "($sum)" : $sum) . " * inv$i;\n";
+  }
+  for my $i(reverse 0..$n-1)
+  {
+    my $sum = join(' - ', "y$i", map { "u" . _symIndex($i, $_, $n) . "*x$_" } $i+1..$n-1);
+    $soa .= "    const double x$i = " . ($i < $n-1 ? "($sum)" : $sum) . " * inv$i;\n";
+  }
+  $soa .= join('', map { "    vout[$_*stride + i] = x$_;\n" } 0..$n-1);
+
+  my $diag = join('*', map { "u" . _symIndex($_, $_, $n) } 0..$n-1);
+  $soa .= "    if(det) det[i] = ($diag)*($diag);\n";
+  $soa .= "  }\n}\n";
+
+  # The array-of-structures version. The inputs are transposed into blocks of
+  # MINIMATH_LANES systems, which are then solved with the kernel above
+  my $batch = <<EOC;
+// N symmetric ${n}x$n systems S*x = v, each stored contiguously: s[$ns*i + ...],
+// v[$n*i + ...]. These are solved MINIMATH_LANES at a time by
+// solve_soaN_sym$n${n}_chol(). If det is non-NULL, the determinants are written to
+// det[0..n-1]
+static inline void solve_batchN_sym$n${n}_chol(int n, const double* restrict s, const double* restrict v, double* restrict vout, double* restrict det)
+{
+  MINIMATH_PARALLEL_FOR(n / MINIMATH_LANES)
+  for(int i0=0; i0<n; i0 += MINIMATH_LANES)
+  {
+    const int nlanes = n-i0 < MINIMATH_LANES ? n-i0 : MINIMATH_LANES;
+    double s_soa[$ns*MINIMATH_LANES], v_soa[$n*MINIMATH_LANES], x_soa[$n*MINIMATH_LANES];
+
+    for(int i=0; i<nlanes; i++)
+    {
+      for(int j=0; j<$ns; j++) s_soa[j*MINIMATH_LANES + i] = s[$ns*(i0+i) + j];
+      for(int j=0; j<$n; j++) v_soa[j*MINIMATH_LANES + i] = v[$n*(i0+i) + j];
+    }
+
+    solve_soaN_sym$n${n}_chol(nlanes, MINIMATH_LANES, s_soa, v_soa, x_soa, det ? &det[i0] : det);
+
+    for(int i=0; i<nlanes; i++)
+      for(int j=0; j<$n; j++) vout[$n*(i0+i) + j] = x_soa[j*MINIMATH_LANES + i];
+  }
+}
+
+EOC
+
+  print $soa . "\n" . $batch;
+}
+
+sub normalAccum
+{
+  my ($k, $n) = @_;
+
+  # Accumulates the normal equations of a least-squares problem, k rows of the
+  # Jacobian at a time: jtj += Jt*J, jtr += Jt*r. jtj is symmetric, so only its
+  # upper triangle is computed, and stored packed
+  my $rows = $k == 1 ? "a row" : "$k rows";
+  my $code = <<EOC;
+// Accumulates the normal equations with $rows of a Jacobian: J is ${k}x$n,
+// r has $k elements. jtj += Jt*J (symmetric ${n}x$n, packed), jtr += Jt*r
+static inline void normal_accum_gen$k${n}(const double* restrict J, const double* restrict r, double* restrict jtj, double* restrict jtr)
+{
+EOC
+
+  for my $i(0..$n-1)
+  {
+    for my $j($i..$n-1)
+    {
+      $code .= "  jtj[" . _symIndex($i, $j, $n) . "] += " . join(' + ', map { "J[" . ($_*$n+$i) . "]*J[" . ($_*$n+$j) . "]" } 0..$k-1) . ";\n";
+    }
+  }
+  for my $i(0..$n-1)
+  {
+    $code .= "  jtr[$i] += " . join(' + ', map { "J[" . ($_*$n+$i) . "]*r[$_]" } 0..$k-1) . ";\n";
+  }
+  $code .= "}\n";
+
+  # and the weighted version
+  print $code . "\n" . _makeScaled_mulVector($code) . "\n";
+}
+
+sub symIndexTables
+{
+  # Lookup tables, so that looking up element (i,j) of a packed symmetric matrix
+  # doesn't need a branch on i<=j and the integer math. With constant i,j the
+  # compiler folds these lookups away entirely. The float header has the same
+  # tables, so they're only defined once
+  print <<EOC;
+// Offsets of element (i,j) in a packed symmetric NxN matrix (upper triangle
+// stored, row-first): minimath_index_symNN[i*N + j]. Either triangle may be
+// given
+#ifndef MINIMATH_INDEX_TABLES
+#define MINIMATH_INDEX_TABLES
+EOC
+  foreach my $n (@_)
+  {
+    my @rows;
+    for my $i(0..$n-1)
+    {
+      push @rows, join(',', map { _symIndex($i, $_, $n) } 0..$n-1);
+    }
+    print "static const int minimath_index_sym$n$n\[$n*$n] =\n  { " . join(",\n    ", @rows) . " };\n";
+  }
+  print "#endif\n\n";
+}
+
+sub symBlocks
+{
+  my ($b, $n) = @_;
+
+  # Kernels to read, write, accumulate and multiply the BxB block at (i0,j0) of
+  # a packed symmetric NxN matrix. The bodies are fully unrolled. The offsets
+  # come from the index table, relative to the block origin, so there are no
+  # branches in the index computations. If i0,j0 are known at compile time,
+  # these fold to constants. The block may lie anywhere, including across the
+  # diagonal. When writing, only the elements in the upper triangle are
+  # touched, so diagonal blocks aren't accumulated twice. Those checks are
+  # predictable branches, and disappear also if i0,j0 are known
+  my $bb   = "$b$b";
+  my $nn   = "$n$n";
+  my $ix   = "const int* ix = &minimath_index_sym${nn}[i0*$n + j0];";
+  my $ixd  = "$ix\n  const int  d  = j0 - i0;";
+  my @ac   = map { my $a = $_; map {[$a, $_]} 0..$b-1 } 0..$b-1;
+  my $dense = sub { my ($name,$a,$c) = @_; "${name}[$a*${name}_s0 + $c*${name}_s1]" };
+  my $sym   = sub { my ($a,$c) = @_; "s[ix[" . ($a*$n + $c) . "]]" };
+  my $upper = sub
+  {
+    my ($a,$c,$stmt) = @_;
+    return "  if(d >= " . ($a-$c) . ") $stmt\n";
+  };
+
+  # the elements of A*B for dense A,B, and of A*block
+  my $mulDense = sub { my ($a,$c) = @_; join(' + ', map { $dense->('A',$a,$_) . "*" . $dense->('B',$_,$c) } 0..$b-1) };
+  my $mulBlock = sub { my ($a,$c) = @_; join(' + ', map { $dense->('A',$a,$_) . "*" . $sym->($_,$c) } 0..$b-1) };
+
+  my $get   = join('', map { "  P[$_->[0]*P_s0 + $_->[1]*P_s1] = scale * " . $sym->(@$_) . ";\n" } @ac);
+  my $set   = join('', map { $upper->(@$_, $sym->(@$_) . " = scale * " . $dense->('M', @$_) . ";") } @ac);
+  my $accum = join('', map { $upper->(@$_, $sym->(@$_) . " += scale * " . $dense->('M', @$_) . ";") } @ac);
+  my $mul   = join('', map { "  P[$_->[0]*P_s0 + $_->[1]*P_s1] = scale * (" . $mulBlock->(@$_) . ");\n" } @ac);
+  my $mulAccum = join('', map { $upper->(@$_, $sym->(@$_) . " += scale * (" . $mulDense->(@$_) . ");") } @ac);
+
+  # function header, with the arguments aligned on the open paren
+  my $header = sub
+  {
+    my ($name, @args) = @_;
+    my $open = "static inline void $name(";
+    return $open . join(",\n" . (' ' x length($open)), @args) . ")";
+  };
+  my @get  = ('double* restrict P, int P_s0, int P_s1', 'const double* restrict s, int i0, int j0, double scale');
+  my @set  = ('double* restrict s, int i0, int j0', 'const double* restrict M, int M_s0, int M_s1, double scale');
+  my @mul  = ('double* restrict P, int P_s0, int P_s1', 'const double* restrict A, int A_s0, int A_s1',
+              'const double* restrict s, int i0, int j0, double scale');
+  my @mulA = ('double* restrict s, int i0, int j0', 'const double* restrict A, int A_s0, int A_s1',
+              'const double* restrict B, int B_s0, int B_s1', 'double scale');
+
+  print "// Reads the ${b}x$b block at (i0,j0) of a packed symmetric ${n}x$n matrix s into\n"
+      . "// the general matrix P, with the given strides: P = block*scale\n"
+      . $header->("get_block${bb}_sym${nn}", @get) . "\n{\n  $ix\n$get}\n\n";
+  print "// Writes M*scale into the ${b}x$b block at (i0,j0) of a packed symmetric\n"
+      . "// ${n}x$n matrix s. Only the elements in the upper triangle of s are written\n"
+      . $header->("set_block${bb}_sym${nn}", @set) . "\n{\n  $ixd\n$set}\n\n";
+  print "// Adds M*scale to the ${b}x$b block at (i0,j0) of a packed symmetric ${n}x$n\n"
+      . "// matrix s. Only the elements in the upper triangle of s are touched\n"
+      . $header->("accum_block${bb}_sym${nn}", @set) . "\n{\n  $ixd\n$accum}\n\n";
+  print "// P = A * block * scale, where the block is the ${b}x$b block at (i0,j0) of a\n"
+      . "// packed symmetric ${n}x$n matrix s, and A is a general ${b}x$b matrix\n"
+      . $header->("mul_gen${bb}_block${bb}_sym${nn}", @mul) . "\n{\n  $ix\n$mul}\n\n";
+  print "// Adds A*B*scale to the ${b}x$b block at (i0,j0) of a packed symmetric ${n}x$n\n"
+      . "// matrix s, where A and B are general ${b}x$b matrices. Only the elements in\n"
+      . "// the upper triangle of s are touched\n"
+      . $header->("mul_gen${bb}_gen${bb}_accum_block${bb}_sym${nn}", @mulA) . "\n{\n  $ixd\n$mulAccum}\n\n";
+}
+
+sub syrk
+{
+  my $n = shift;
+
+  # s += scale * At*A for an Nxn A. The upper triangle of the result is
+  # accumulated in local variables in one pass over A, and the result is scaled
+  # and written out once at the end. The accumulators are independent, so the
+  # compiler can vectorize across them
+  my @ij;
+  for my $i(0..$n-1)
+  {
+    push @ij, map { [$i, $_] } $i..$n-1;
+  }
+
+  my $accumulate = join('', map { "    c$_ += a[$ij[$_][0]]*a[$ij[$_][1]];\n" } 0..$#ij);
+  my $init       = join('', map { "  double c$_ = 0.0;\n" } 0..$#ij);
+
+  my %versions = (vout          => ['=',  ''],
+                  vaccum        => ['+=', ''],
+                  vout_scaled   => ['=',  'scale*'],
+                  vaccum_scaled => ['+=', 'scale*']);
+  foreach my $v (qw(vout vaccum vout_scaled vaccum_scaled))
+  {
+    my ($op, $scale) = @{$versions{$v}};
+    my $args  = "int n, const double* restrict a, double* restrict s";
+    $args    .= ", double scale" if $scale;
+    my $store = join('', map { "  s[" . _symIndex(@{$ij[$_]}, $n) . "] $op ${scale}c$_;\n" } 0..$#ij);
+    my $what  = $op eq '=' ? '' : ' accumulated into s';
+    $what    .= ' and scaled' if $scale;
+
+    print <<EOC;
+// symmetric rank-k update: At*A for a general Nx$n matrix A, stored in a packed
+// symmetric ${n}x$n matrix s$what
+static inline void syrk_genN${n}_$v($args)
+{
+$init
+  for(int i=0; i<n; i++, a += $n)
+  {
+$accumulate  }
+
+$store}
+
+EOC
+  }
+}
+
+sub solveRefine
+{
+  my $n = shift;
+  my $Ns = $n*($n+1)/2;
+
+  # Iterative refinement. The expensive part (the factorization) is done in
+  # float. Each iteration computes the residual r = v - S*x in double, and
+  # solves for the correction with the float factor. Each iteration gains
+  # ~-log10(cond(S)*eps_float) digits, so this converges as long as S isn't too
+  # ill-conditioned for a float factorization. I stop when the solution is
+  # backward-stable in double: |r| <= n*eps*|S|*|x|, with max-norms
+  my $maxiter = 10;
+  print <<EOC;
+// Solves S*x = v for a symmetric positive-definite ${n}x$n S, to double
+// precision, given u: the single-precision Cholesky factor of S from
+// chol_sym${n}${n}_vout_f(). The residuals are computed in double precision, and
+// the corrections are solved with u. Returns the number of refinement iterations
+// taken, or $maxiter+1 if the iteration did not converge
+static inline int solve_sym${n}${n}_refine_vout(const double* restrict v, const double* restrict s, const float* restrict u, double* restrict vout)
+{
+  float d[$n];
+  for(int i=0; i<$n; i++) d[i] = (float)v[i];
+  solve_sym${n}${n}_chol_f(d, u);
+  for(int i=0; i<$n; i++) vout[i] = (double)d[i];
+
+  double smax = 0.0;
+  for(int i=0; i<$Ns; i++) smax = fmax(smax, fabs(s[i]));
+
+  for(int iter=0; iter<=$maxiter; iter++)
+  {
+    double r[$n];
+    double rmax = 0.0, xmax = 0.0;
+    mul_vec${n}_sym${n}${n}_vout(vout, s, r);
+    for(int i=0; i<$n; i++)
+    {
+      r[i] = v[i] - r[i];
+      rmax = fmax(rmax, fabs(r[i]));
+      xmax = fmax(xmax, fabs(vout[i]));
+    }
+    if(rmax <= $n.0*2.220446049250313e-16*smax*xmax)
+      return iter;
+    if(iter == $maxiter)
+      break;
+
+    for(int i=0; i<$n; i++) d[i] = (float)r[i];
+    solve_sym${n}${n}_chol_f(d, u);
+    for(int i=0; i<$n; i++) vout[i] += (double)d[i];
+  }
+  return $maxiter+1;
+}
+
+// Solves S*x = v to double precision, with the factorization done in single
+// precision. See solve_sym${n}${n}_refine_vout(). Returns 0 if S is not
+// positive-definite in single precision, or if the refinement did not converge
+static inline int solve_sym${n}${n}_mixed_vout(const double* restrict v, const double* restrict s, double* restrict vout)
+{
+  float sf[$Ns], u[$Ns];
+  for(int i=0; i<$Ns; i++) sf[i] = (float)s[i];
+  if(!chol_sym${n}${n}_vout_f(sf, u))
+    return 0;
+  return solve_sym${n}${n}_refine_vout(v, s, u, vout) <= $maxiter;
+}
+
+EOC
+}
+
+sub qrUpdate
+{
+  my $n = shift;
+
+  # Streaming least-squares: min |J*x - b|^2 for a tall Nx$n J. I keep only the
+  # upper-triangular R and Qt*b, and update them with blocks of rows using
+  # Householder reflections on the stacked [R; J_block]. The rows are copied
+  # into local column-major buffers of a fixed size, so the memory use is
+  # constant, and the loops over the rows are contiguous and vectorizable. The
+  # diagonal of R is kept positive, so R matches the Cholesky factor of Jt*J.
+  # Each call returns the contribution of its rows to the residual |J*x - b|^2
+  # at the optimum
+  my $chunk = 32;
+
+  my $code = <<EOC;
+// Updates the QR factorization of a tall Nx$n least-squares system J*x = b with
+// n more rows. r is the upper-triangular ${n}x$n factor, stored packed, and qtb is
+// Qt*b. Initialize both to 0 before the first call. The solution is then
+// solve_ut$n(qtb, r). Returns the contribution of these n rows to the squared
+// norm of the optimal residual
+static inline double qr_update_genN$n(int n, const double* restrict J, const double* restrict b, double* restrict r, double* restrict qtb)
+{
+  double residual2 = 0.0;
+
+  for(int i0=0; i0<n; i0 += $chunk)
+  {
+    const int m = n-i0 < $chunk ? n-i0 : $chunk;
+
+    // column-major copy of this chunk
+    double a[$n][$chunk], bb[$chunk];
+    for(int i=0; i<m; i++)
+    {
+EOC
+  $code .= join('', map { "      a[$_][i] = J[(i0+i)*$n + $_];\n" } 0..$n-1);
+  $code .= <<EOC;
+      bb[i] = b[i0+i];
+    }
+EOC
+
+  for my $k(0..$n-1)
+  {
+    my $kk = _symIndex($k, $k, $n);
+    $code .= <<EOC;
+
+    // column $k: the Householder vector is v = [r_kk - alpha; a[$k][0..m-1]]
+    {
+      double norm2 = r[$kk]*r[$kk];
+      for(int i=0; i<m; i++)
+        norm2 += a[$k][i]*a[$k][i];
+      if(norm2 > 0.0)
+      {
+        const double sigma = sqrt(norm2);
+        const double alpha = r[$kk] > 0.0 ? -sigma : sigma;
+        const double v0    = r[$kk] - alpha;
+        // 2/(vt*v)
+        const double scale = 1.0 / (sigma*(sigma + fabs(r[$kk])));
+EOC
+    for my $j($k+1..$n-1)
+    {
+      my $kj = _symIndex($k, $j, $n);
+      $code .= <<EOC;
+        {
+          double w = v0*r[$kj];
+          for(int i=0; i<m; i++)
+            w += a[$k][i]*a[$j][i];
+          w *= scale;
+          r[$kj] -= w*v0;
+          for(int i=0; i<m; i++)
+            a[$j][i] -= w*a[$k][i];
+        }
+EOC
+    }
+    my @row = map { _symIndex($k, $_, $n) } $k+1..$n-1;
+    $code .= <<EOC;
+        {
+          double w = v0*qtb[$k];
+          for(int i=0; i<m; i++)
+            w += a[$k][i]*bb[i];
+          w *= scale;
+          qtb[$k] -= w*v0;
+          for(int i=0; i<m; i++)
+            bb[i] -= w*a[$k][i];
+        }
+
+        // alpha > 0 only if r_kk was <= 0. I flip the sign of the row to keep
+        // the diagonal positive
+        const double sign = alpha > 0.0 ? 1.0 : -1.0;
+        r[$kk] = sign*alpha;
+EOC
+    $code .= join('', map { "        r[$_] *= sign;\n" } @row);
+    $code .= <<EOC;
+        qtb[$k] *= sign;
+      }
+    }
+EOC
+  }
+
+  $code .= <<EOC;
+
+    // whatever is left of b can't be explained by the model
+    for(int i=0; i<m; i++)
+      residual2 += bb[i]*bb[i];
+  }
+
+  return residual2;
+}
+
+EOC
+
+  print $code;
+}
+
+sub cofactorsSym
+{
+  my $n = shift;
+
+  # The cofactors are computed by Laplace expansion along the first remaining
+  # row. Each minor is computed once into a temporary, and then reused by all
+  # the larger minors that contain it. Since the matrix is symmetric, the minor
+  # with rows R and columns C is equal to the minor with rows C and columns R,
+  # so I store those only once also
+  my %minors;
+  my $temporaries = '';
+  my $Nminors = 0;
+
+  my $minor = sub
+  {
+    my ($self, $rows, $cols) = @_;
+    my $k = @$rows;
+
+    return "m[" . _symIndex($rows->[0], $cols->[0], $n) . "]" if $k == 1;
+
+    my $key  = join(',', @$rows) . ';' . join(',', @$cols);
+    my $keyt = join(',', @$cols) . ';' . join(',', @$rows);
+    ($key) = sort ($key, $keyt);
+    return $minors{$key} if defined $minors{$key};
+
+    my $expr = _laplaceExpansion($self, $n, $rows, $cols, 1);
+    my $name = "d${k}_" . $Nminors++;
+    $temporaries .= "  const double $name = $expr;\n";
+    return $minors{$key} = $name;
+  };
+
+  my $body = '';
+  for my $i(0..$n-1)
+  {
+    for my $j($i..$n-1)
+    {
+      my @rows = grep {$_ != $i} 0..$n-1;
+      my @cols = grep {$_ != $j} 0..$n-1;
+      my $sign = ($i + $j) % 2 ? -1 : 1;
+      $body .= "  c[" . _symIndex($i, $j, $n) . "] = " . _laplaceExpansion($minor, $n, \@rows, \@cols, $sign) . ";\n";
+    }
+  }
+
+  my $det = join(' + ', map { "m[$_]*c[$_]" } 0..$n-1);
+
+  print <<EOC;
+// Cofactors of a symmetric ${n}x$n matrix. Returns the determinant. Original
+// matrix * cofactors / det = identity
+static inline double cofactors_sym$n(const double* restrict m, double* restrict c)
+{
+$temporaries
+$body
+  return $det;
+}
+
+EOC
+}
+
+sub _laplaceExpansion
+{
+  my ($minor, $n, $rows, $cols, $sign) = @_;
+
+  # determinant of the submatrix of a symmetric NxN matrix with the given rows
+  # and columns, expanding along the first row. $minor is called to get the
+  # determinants of the smaller submatrices
+  my ($row, @rows) = @$rows;
+  my $expr = '';
+  for my $p(0..$#$cols)
+  {
+    my @cols = @$cols;
+    my ($col) = splice @cols, $p, 1;
+
+    my $thissign = $p % 2 ? -$sign : $sign;
+    $expr .= $thissign < 0 ? ($p ? ' - ' : '-') : ($p ? ' + ' : '');
+    $expr .= "m[" . _symIndex($row, $col, $n) . "]*" . $minor->($minor, \@rows, \@cols);
+  }
+  return $expr;
+}
+
+sub _parseSizes
+{
+  my $spec = shift;
+
+  my %sizes;
+  foreach my $range (split /,/, $spec)
+  {
+    my ($from, $to) = $range =~ /^\s*(\d+)\s*(?:(?:-|\.\.)\s*(\d+)\s*)?$/
+      or die "Couldn't parse size range '$range'\n$usage";
+    $to //= $from;
+    die "Sizes must be >= 2; got '$range'" if $from < 2;
+    $sizes{$_} = 1 for $from..$to;
+  }
+
+  die "No sizes given\n$usage" unless %sizes;
+  return sort {$a <=> $b} keys %sizes;
+}
+
 sub _multiplicationVersions
 {
   my $vout = shift;
@@ -301,6 +1367,47 @@ sub _multiplicationVersions
   return $funcs;
 }
 
+sub _makeSoa
+{
+  my $v = shift;
+
+  # I take the single-vector kernels, and make batched flavors that operate on n
+  # vectors stored in a structure-of-arrays layout: element j of vector i lives
+  # in v[j*stride + i]. The caller can thus pass separate x[], y[], z[] arrays
+  # laid out with a fixed stride between them. Each iteration of the lane loop
+  # touches consecutive memory, so the compiler can vectorize across vectors
+
+  # rename functions: mul_vec3_... -> mul_soaN3_...
+  $v =~ s/^(static inline \w+ )mul_vec(\d+)_/${1}mul_soaN$2_/gm;
+
+  # better comment
+  $v =~ s{^// (\d+)-vector by}{// N $1-vectors (structure-of-arrays) by}gm;
+
+  # add the lane count, stride arguments
+  $v =~ s/^(static inline \w+ \w+\()/${1}int n, int stride, /gm;
+
+  # index the lanes
+  $v =~ s/\b(v|vout|vaccum)\[(\d+)\]/$1\[$2*stride + i\]/gm;
+
+  # loop over the lanes
+  $v =~ s{^\{\n(.*?)^\}$}
+         {my $body = $1;
+          $body =~ s/^/  /gm;
+          "{\n  MINIMATH_PARALLEL_FOR(n)\n  for(int i=0; i<n; i++)\n  {\n$body  }\n}"}gmse;
+
+  return $v;
+}
+
+sub _symIndex
+{
+  my ($i, $j, $n) = @_;
+
+  # index of (i,j) in a packed symmetric NxN matrix. The upper triangle is
+  # stored, row-first
+  ($i,$j) = ($j,$i) if $j < $i;
+  return (2*$n - $i - 1)*$i/2 + $j;
+}
+
 sub _getSymmetricIndices_row
 {
   my $hash     = shift;
@@ -461,3 +1568,62 @@ sub _makeScaled_mulMatrix
 
   return $f;
 }
+
+sub _definedNames
+{
+  my $f = shift;
+
+  # all the function definitions, function-like macros and struct types
+  return map {$_ => 1}
+    ( $f =~ /^(?:static\s+)?(?:inline\s+)?(?:void|int|double)\s+(\w+)\s*\(/mg,
+      $f =~ /^#\s*define\s+(\w+)\(/mg,
+      $f =~ /^typedef\s+struct\b.*\}.*?(\w+)\s*;\s*$/mg );
+}
+
+sub _collectIncludedNames
+{
+  my $f    = shift;
+  my $dir  = shift;
+  my $seen = shift // {};
+
+  my %names;
+  foreach my $include ( $f =~ /^#\s*include\s+"([^"]+)"/mg )
+  {
+    next if $seen->{$include}++;
+    open my $fd, '<', "$dir$include" or die "Couldn't open included '$dir$include'";
+    local $/ = undef;
+    my $contents = <$fd>;
+
+    %names = (%names,
+              _definedNames($contents),
+              _collectIncludedNames($contents, $dir, $seen));
+  }
+  return %names;
+}
+
+sub _makeFloat
+{
+  my $f = shift;
+
+  # Everything gets a _f suffix: all the functions and macros defined here, and
+  # in the headers we include (passed in by the caller)
+  my %names = (_definedNames($f), @_);
+
+  # rename. If the name is used in a token-pasting macro, the suffix must go at
+  # the end of the pasted result
+  $f =~ s{\b(\w+)\b((?:\s*##\s*\w+)?)}
+         {!exists $names{$1} ? "$1$2" :
+          $2 eq ''           ? "${1}_f" :
+                               "$1$2 ## _f"}ge;
+
+  # the headers I include have float flavors too
+  $f =~ s/^(#\s*include\s+")(\w[\w-]*)\.h"/$1$2_f.h"/mg;
+
+  $f =~ s/\bdouble\b/float/g;
+
+  # float literals and libm calls
+  $f =~ s/(?<![\w.])((?:\d+\.\d*|\.\d+)(?:[eE][-+]?\d+)?)(?![\w.])/${1}f/g;
+  $f =~ s/\b(sqrt|fabs|sin|cos|tan|asin|acos|atan|atan2|exp|log|pow|cbrt|hypot|fmin|fmax|copysign)\s*\(/${1}f(/g;
+
+  return $f;
+}
@@ -1,4 +1,5 @@
 #include "minimath.h"
+#include "minimath_f.h"
 
 #include <stdio.h>
 #include <math.h>
@@ -164,6 +165,22 @@ int main(void)
     mul_sym33_sym33_sym33_vout(s3_a, s3_b, v6);
     assert_vector_elemeq6(v6[i], s3_aba[i]);
 
+    // covariance propagation: J*S*Jt with a 3x5 J. Output is a packed sym33
+    {
+      double t[15], ref[9];
+      for(int i=0; i<3; i++)
+        mul_vec5_sym55_vout(&m35[5*i], s5, &t[5*i]);
+      for(int i=0; i<3; i++)
+        for(int j=0; j<3; j++)
+          ref[3*i+j] = dot_vec(5, &t[5*i], &m35[5*j]);
+      double ref_packed[] = {ref[0], ref[1], ref[2], ref[4], ref[5], ref[8]};
+
+      mul_gen35_sym55_gen35t_vout(m35, s5, v6);
+      assert_vector_elemeq6(v6[i], ref_packed[i]);
+      mul_gen35_sym55_gen35t_vaccum_scaled(m35, s5, v6, -3.0);
+      assert_vector_elemeq6(v6[i], -2.0*ref_packed[i]);
+    }
+
     // conjugation
     assert_eq( conj_3(a3, s3_a, b3),
                conj_result );
@@ -189,6 +206,25 @@ int main(void)
     memcpy(v5, a5, sizeof(a5));
     mul_vec5_gen53_vaccum_scaled(a5, m53, v5, -3.0);
     assert_vector_elemeq3(v5[i], -3.0*a_x_m53[i] + a5[i]);
+
+    // batched, structure-of-arrays. Two vectors: a5 and the result of a5*m53
+    // zero-padded to 5 elements
+    double soa[2*5];
+    double soa_out[2*3];
+    for(int i=0; i<5; i++)
+    {
+      soa[i*2 + 0] = a5[i];
+      soa[i*2 + 1] = i < 3 ? a_x_m53[i] : 0.0;
+    }
+    mul_soaN5_gen53_vout(2, 2, soa, m53, soa_out);
+    assert_vector_elemeq3(soa_out[i*2 + 0], a_x_m53[i]);
+    double second[5] = {a_x_m53[0], a_x_m53[1], a_x_m53[2], 0.0, 0.0};
+    mul_vec5_gen53_vout(second, m53, v3);
+    assert_vector_elemeq3(soa_out[i*2 + 1], v3[i]);
+
+    mul_soaN5_gen53_scaled(2, 2, soa, m53, -3.0);
+    assert_vector_elemeq3(soa[i*2 + 0], -3.0*a_x_m53[i]);
+    assert_vector_elemeq3(soa[i*2 + 1], -3.0*v3[i]);
   }
 
   // general transposed multiplication
@@ -213,6 +249,39 @@ int main(void)
     assert_vector_elemeq3(v5[i], -3.0*a_x_m35t[i] + a5[i]);
   }
 
+  // fixed-size matrix-matrix products
+  {
+    double m33[9];
+    double ref[9];
+    for(int i=0; i<3; i++)
+      for(int j=0; j<3; j++)
+      {
+        ref[i*3+j] = 0.0;
+        for(int k=0; k<5; k++)
+          ref[i*3+j] += m35[i*5+k] * m53[k*3+j];
+      }
+
+    mul_gen35_gen53_vout(m35, m53, m33);
+    for(int i=0; i<9; i++) assert_eq(m33[i], ref[i]);
+
+    // m53 is the transpose of a 3x5 matrix, and m35 is the transpose of a 5x3
+    mul_gen53t_gen53_vout(m35, m53, m33);
+    for(int i=0; i<9; i++)
+    {
+      double x = 0.0;
+      for(int k=0; k<5; k++) x += m35[k*3 + i/3] * m53[k*3 + i%3];
+      assert_eq(m33[i], x);
+    }
+
+    mul_gen35_gen35t_vout_scaled(m35, m35, m33, 2.0);
+    for(int i=0; i<9; i++)
+      assert_eq(m33[i], 2.0*dot_vec(5, &m35[5*(i/3)], &m35[5*(i%3)]));
+
+    memcpy(m33, ref, sizeof(ref));
+    mul_gen35_gen53_vaccum_scaled(m35, m53, m33, -3.0);
+    for(int i=0; i<9; i++) assert_eq(m33[i], -2.0*ref[i]);
+  }
+
   // now some matrix inversions. Symmetric
   {
     double s3[] =
@@ -236,6 +305,524 @@ int main(void)
 
   }
 
+  // the larger symmetric inversions. M * cofactors / det should be identity
+  {
+    double s6[] =
+      { 1.9826929 , 0.49539104, 1.21536243, 0.98610923, 1.68623959, 1.0331091 ,
+                    1.96643809, 1.42962549, 0.9336305 , 1.96542156, 0.6086516 ,
+                                0.81542249, 0.74012536, 0.83940333, 1.58604071,
+                                            0.1338364 , 1.03314221, 0.44817192,
+                                                        1.97146512, 0.27591278,
+                                                                    1.51474051 };
+    // top-left corner of s6
+    double s4[] =
+      { 1.9826929 , 0.49539104, 1.21536243, 0.98610923,
+                    1.96643809, 1.42962549, 0.9336305 ,
+                                0.81542249, 0.74012536,
+                                            0.1338364  };
+    double c[21];
+    double full_m[36], full_c[36];
+
+    for(int N=4; N<=6; N++)
+    {
+      const double* s = N == 4 ? s4 : (N == 5 ? s5 : s6);
+      double det      = N == 4 ? cofactors_sym4(s4, c) :
+                       (N == 5 ? cofactors_sym5(s5, c) : cofactors_sym6(s6, c));
+
+      for(int i=0, is=0; i<N; i++)
+        for(int j=i; j<N; j++, is++)
+        {
+          full_m[i*N + j] = full_m[j*N + i] = s[is];
+          full_c[i*N + j] = full_c[j*N + i] = c[is];
+        }
+
+      for(int i=0; i<N; i++)
+        for(int j=0; j<N; j++)
+          assert_eq(dot_vec(N, &full_m[i*N], &full_c[j*N]) / det, i==j ? 1 : 0);
+    }
+  }
+
+  // blocks of packed symmetric matrices. I compare against the full 6x6 matrix
+  {
+    double s[21], full[36];
+    for(int i=0, is=0; i<6; i++)
+      for(int j=i; j<6; j++, is++)
+      {
+        s[is] = (double)is;
+        full[i*6 + j] = full[j*6 + i] = (double)is;
+      }
+
+    // this block straddles the diagonal. P is read transposed
+    double P[9];
+    get_block33_sym66(P, 1, 3, s, 1, 2, 2.0);
+    for(int a=0; a<3; a++)
+      for(int c=0; c<3; c++)
+        assert_eq(P[c*3 + a], 2.0 * full[(1+a)*6 + 2+c]);
+
+    // accumulating the identity into a diagonal block touches each diagonal
+    // element once
+    const double I[9] = {1,0,0, 0,1,0, 0,0,1};
+    accum_block33_sym66(s, 3, 3, I, 3, 1, 1.0);
+    assert_eq(s[15], 16.0);
+    assert_eq(s[18], 19.0);
+    assert_eq(s[20], 21.0);
+    assert_eq(s[16], 16.0);
+
+    // A * block
+    double AB[9];
+    mul_gen33_block33_sym66(AB, 3, 1, m53, 3, 1, s, 0, 3, 1.0);
+    for(int a=0; a<3; a++)
+      for(int c=0; c<3; c++)
+        assert_eq(AB[a*3 + c],
+                  m53[a*3 + 0]*s[3 + c] + m53[a*3 + 1]*s[8 + c] + m53[a*3 + 2]*s[12 + c]);
+  }
+
+  // triangular solves. I check U*x = v, Ut*x = v, L*x = v and Lt*x = v
+  {
+    // packed ut4 and lt4: the same values, row-first
+    double t4[] = { 1.5, 0.2, -0.7, 0.9,
+                         2.1,  0.4, 0.3,
+                              -1.3, 0.6,
+                                    0.8 };
+    double U[16] = {}, L[16] = {};
+    for(int i=0, iut=0; i<4; i++)
+      for(int j=i; j<4; j++, iut++)
+        U[i*4 + j] = t4[iut];
+    for(int i=0, ilt=0; i<4; i++)
+      for(int j=0; j<=i; j++, ilt++)
+        L[i*4 + j] = t4[ilt];
+
+    double x[8], v[8];
+    for(int i=0; i<8; i++) v[i] = a5[i%5] + (double)i;
+
+#define CHECK_SOLVE(M, transposed)                                      \
+    for(int k=0; k<2; k++)                                              \
+      for(int i=0; i<4; i++)                                            \
+      {                                                                 \
+        double b = 0.0;                                                 \
+        for(int j=0; j<4; j++)                                          \
+          b += (transposed ? M[j*4 + i] : M[i*4 + j]) * x[4*k + j];     \
+        assert_eq(b, v[4*k + i]);                                       \
+      }
+
+    solve_genN4_ut4_vout(2, v, t4, x);
+    CHECK_SOLVE(U, 0);
+    solve_genN4_ut4t_vout(2, v, t4, x);
+    CHECK_SOLVE(U, 1);
+    solve_genN4_lt4_vout(2, v, t4, x);
+    CHECK_SOLVE(L, 0);
+    memcpy(x, v, sizeof(x));
+    solve_lt4t(x, t4);
+    solve_lt4t(&x[4], t4);
+    CHECK_SOLVE(L, 1);
+#undef CHECK_SOLVE
+  }
+
+  // eigen-decompositions. I check that v*s*vt = diag(l), and that v is
+  // orthonormal. The second matrix is I + u*ut: its eigenvalues are 1,1,2
+  {
+    double s_eig[2][6] =
+      { { 0.471011, 1.6661985 , 0.98615889,
+                    0.32707543, 1.0342404,
+                                0.49936779},
+        { 1.0 + 1.0/9.0, 2.0/9.0,       2.0/9.0,
+                         1.0 + 4.0/9.0, 4.0/9.0,
+                                        1.0 + 4.0/9.0 } };
+    double l_ref[2][3] = { {-1.27232695, -0.34210887, 2.91189003},
+                           {1.0, 1.0, 2.0} };
+
+    double soa_s[6*2], soa_l[3*2], soa_v[9*2];
+    for(int k=0; k<2; k++)
+      for(int j=0; j<6; j++)
+        soa_s[j*2 + k] = s_eig[k][j];
+    eig_soaN_sym33(2, 2, soa_l, soa_v, soa_s);
+
+    for(int k=0; k<2; k++)
+    {
+      double l[3], v[9], vs[9];
+      eig_sym33(l, v, s_eig[k]);
+      assert_vector_elemeq3(l[i], l_ref[k][i]);
+
+      for(int i=0; i<3; i++)
+        mul_vec3_sym33_vout(&v[3*i], s_eig[k], &vs[3*i]);
+      for(int i=0; i<3; i++)
+        for(int j=0; j<3; j++)
+        {
+          assert_eq(dot_vec(3, &vs[3*i], &v[3*j]), i==j ? l[i] : 0.0);
+          assert_eq(dot_vec(3, &v [3*i], &v[3*j]), i==j ? 1.0  : 0.0);
+        }
+
+      for(int j=0; j<3; j++) assert_eq(soa_l[j*2 + k], l[j]);
+      for(int j=0; j<9; j++) assert_eq(soa_v[j*2 + k], v[j]);
+    }
+  }
+
+  // 3x3 SVD and polar decomposition. I use the top 3x3 corner of m53, and its
+  // reflection. These have determinants of opposite signs
+  {
+    double m[2][9];
+    for(int i=0; i<3; i++)
+      for(int j=0; j<3; j++)
+      {
+        m[0][i*3 + j] = m53[i*3 + j];
+        m[1][i*3 + j] = (i == 0 ? -1.0 : 1.0) * m53[i*3 + j];
+      }
+
+    for(int k=0; k<2; k++)
+    {
+      double u[9], sv[3], v[9], r[9], rr[9], p[6];
+      svd_gen33(u, sv, v, m[k]);
+
+      // m = u * diag(s) * vt
+      for(int i=0; i<3; i++)
+        for(int j=0; j<3; j++)
+          assert_eq(u[i*3+0]*sv[0]*v[j*3+0] + u[i*3+1]*sv[1]*v[j*3+1] + u[i*3+2]*sv[2]*v[j*3+2],
+                    m[k][i*3 + j]);
+      assert_eq(det_orthonormal33(u), 1.0);
+      assert_eq(det_orthonormal33(v), 1.0);
+      double c[9];
+      assert_eq(sv[2] < 0.0 ? 1.0 : 0.0,
+                cofactors_gen33(c, m[k]) < 0.0 ? 1.0 : 0.0);
+
+      // m = r*p, with r a rotation
+      polar_gen33(r, p, m[k]);
+      nearest_rotation_gen33(rr, m[k]);
+      assert_eq(det_orthonormal33(r), 1.0);
+      for(int i=0; i<9; i++)
+        assert_eq(r[i], rr[i]);
+      for(int row=0; row<3; row++)
+      {
+        double rp[3];
+        mul_vec3_sym33_vout(&r[row*3], p, rp);
+        assert_vector_elemeq3(rp[i], m[k][row*3 + i]);
+      }
+    }
+  }
+
+  // Rotations. Round trips through all the representations, including a
+  // rotation by nearly 180 degrees. And finite-difference checks of the
+  // gradients
+  {
+    double r[2][3] = { { 0.3, -0.8, 1.1},
+                       { 3.1,  0.1, -0.2} };
+    for(int k=0; k<2; k++)
+    {
+      double R[9], dR_dr[9*3], q[4], R2[9], r2[3], dr_dR[3*9];
+      rotation_from_rodrigues(R, dR_dr, r[k]);
+      assert_eq(det_orthonormal33(R), 1.0);
+
+      quat_from_rotation(q, NULL, R);
+      rotation_from_quat(R2, NULL, q);
+      for(int i=0; i<9; i++) assert_eq(R2[i], R[i]);
+
+      rodrigues_from_rotation(r2, dr_dR, R);
+      assert_vector_elemeq3(r2[i], r[k][i]);
+
+      // dr/dR * dR/dr = I
+      for(int row=0; row<3; row++)
+        for(int col=0; col<3; col++)
+        {
+          double sum = 0.0;
+          for(int j=0; j<9; j++) sum += dr_dR[row*9 + j] * dR_dr[j*3 + col];
+          assert_eq(sum, row == col ? 1.0 : 0.0);
+        }
+
+      for(int col=0; col<3; col++)
+      {
+        const double delta = 1e-6;
+        double rp[3] = {r[k][0], r[k][1], r[k][2]};
+        double Rp[9];
+        rp[col] += delta;
+        rotation_from_rodrigues(Rp, NULL, rp);
+        for(int j=0; j<9; j++)
+          assert_eq((Rp[j] - R[j]) / delta, dR_dr[j*3 + col]);
+      }
+    }
+
+    // Composition. Both flavors should match the matrix product, and I check
+    // the gradient of the Rodrigues flavor
+    {
+      double R0[9], R1[9], R[9], Rq[9], Rr[9];
+      double q0[4], q1[4], q[4], rc[3], dr_dr0[9], dr_dr1[9];
+      rotation_from_rodrigues(R0, NULL, r[0]);
+      rotation_from_rodrigues(R1, NULL, r[1]);
+      mul_gen33_gen33_vout(R0, R1, R);
+
+      quat_from_rotation(q0, NULL, R0);
+      quat_from_rotation(q1, NULL, R1);
+      compose_quat(q, NULL, NULL, q0, q1);
+      rotation_from_quat(Rq, NULL, q);
+      compose_rodrigues(rc, dr_dr0, dr_dr1, r[0], r[1]);
+      rotation_from_rodrigues(Rr, NULL, rc);
+      for(int j=0; j<9; j++)
+      {
+        assert_eq(Rq[j], R[j]);
+        assert_eq(Rr[j], R[j]);
+      }
+
+      for(int col=0; col<3; col++)
+      {
+        const double delta = 1e-6;
+        double rp[3] = {r[1][0], r[1][1], r[1][2]};
+        double rcp[3];
+        rp[col] += delta;
+        compose_rodrigues(rcp, NULL, NULL, r[0], rp);
+        assert_vector_elemeq3((rcp[i] - rc[i]) / delta, dr_dr1[i*3 + col]);
+      }
+
+      // structure-of-arrays: the 2 compositions r0*r1 and r1*r0
+      double soa_r0[3*2], soa_r1[3*2], soa_r[3*2], rc2[3];
+      for(int j=0; j<3; j++)
+      {
+        soa_r0[j*2 + 0] = soa_r1[j*2 + 1] = r[0][j];
+        soa_r0[j*2 + 1] = soa_r1[j*2 + 0] = r[1][j];
+      }
+      compose_rodrigues_soaN(2, 2, soa_r, NULL, NULL, soa_r0, soa_r1);
+      compose_rodrigues(rc2, NULL, NULL, r[1], r[0]);
+      assert_vector_elemeq3(soa_r[i*2 + 0], rc [i]);
+      assert_vector_elemeq3(soa_r[i*2 + 1], rc2[i]);
+    }
+  }
+
+  // Rigid transforms. I transform 3 points in all the layouts, and check the
+  // composition and inverse against transforming the points twice
+  {
+    const double r0[3] = { 0.3, -0.8, 1.1}, r1[3] = {-1.0, 0.4, 0.2};
+    double Rt0[12], Rt1[12], Rt01[12], Rtinv[12];
+    rotation_from_rodrigues(Rt0, NULL, r0);
+    rotation_from_rodrigues(Rt1, NULL, r1);
+    Rt0[9] = 1.0; Rt0[10] = -2.0; Rt0[11] =  3.0;
+    Rt1[9] = 0.5; Rt1[10] =  0.1; Rt1[11] = -0.7;
+    compose_Rt_vout(Rt0, Rt1, Rt01);
+    invert_Rt_vout(Rt01, Rtinv);
+
+    double x[3*3] = { 1.0, 2.0, 3.0,
+                     -4.0, 0.5, 2.5,
+                      0.1, 0.2, -9.0 };
+    double y[3*3], y01[3*3], soa[3*3], soa_out[3*3];
+    transform_genN3_Rt_vout(3, x, Rt1, y);
+    transform_genN3_Rt(3, y, Rt0);
+    transform_genN3_Rt_vout(3, x, Rt01, y01);
+    for(int j=0; j<9; j++) assert_eq(y01[j], y[j]);
+
+    for(int k=0; k<3; k++)
+    {
+      for(int j=0; j<3; j++) soa[j*3 + k] = x[k*3 + j];
+      double xi[3] = {y01[k*3 + 0], y01[k*3 + 1], y01[k*3 + 2]};
+      transform_vec3_Rt(xi, Rtinv);
+      assert_vector_elemeq3(xi[i], x[k*3 + i]);
+    }
+    transform_soaN3_Rt_vout(3, 3, soa, Rt01, soa_out);
+    for(int k=0; k<3; k++)
+      assert_vector_elemeq3(soa_out[i*3 + k], y01[k*3 + i]);
+
+    // batches of 2: (Rt0*Rt1, Rt1*Rt0). The inverse of the inverse is the
+    // original transform
+    double b0[2*12], b1[2*12], bout[2*12];
+    for(int j=0; j<12; j++)
+    {
+      b0[j] = b1[12 + j] = Rt0[j];
+      b1[j] = b0[12 + j] = Rt1[j];
+    }
+    compose_batchN_Rt_vout(2, b0, b1, bout);
+    for(int j=0; j<12; j++) assert_eq(bout[j], Rt01[j]);
+    invert_batchN_Rt(2, bout);
+    for(int j=0; j<12; j++) assert_eq(bout[j], Rtinv[j]);
+    invert_batchN_Rt(2, bout);
+    compose_Rt(Rt1, Rt0);
+    for(int j=0; j<12; j++) assert_eq(bout[12 + j], Rt1[j]);
+  }
+
+  // Streaming QR least-squares. 40 rows, given in 2 uneven blocks. I compare
+  // against the normal equations
+  {
+    double J[40*3], b[40];
+    for(int i=0; i<40; i++)
+    {
+      for(int j=0; j<3; j++)
+        J[i*3 + j] = m53[(i*3 + j) % 15] + (double)((i*7 + j) % 11) / 10.0;
+      b[i] = a5[i%5] - (double)(i%3);
+    }
+
+    double r[6] = {}, qtb[3] = {};
+    double residual2 =
+      qr_update_genN3(25, J,      b,      r, qtb) +
+      qr_update_genN3(15, &J[75], &b[25], r, qtb);
+    double x[3];
+    solve_ut3_vout(qtb, r, x);
+
+    // r is the Cholesky factor of Jt*J
+    double jtj[6] = {}, jtb[3] = {}, u[6], x_ref[3];
+    for(int i=0; i<40; i++)
+      for(int j=0, ij=0; j<3; j++)
+      {
+        jtb[j] += J[i*3 + j] * b[i];
+        for(int k=j; k<3; k++, ij++)
+          jtj[ij] += J[i*3 + j] * J[i*3 + k];
+      }
+    chol_sym33_vout(jtj, u);
+    for(int i=0; i<6; i++)
+      assert_eq(r[i], u[i]);
+
+    // the same normal equations, accumulated 3 rows at a time, and then 1 row
+    {
+      double jtj_accum[6] = {}, jtb_accum[3] = {};
+      for(int i=0; i<39; i += 3)
+        normal_accum_gen33(&J[i*3], &b[i], jtj_accum, jtb_accum);
+      normal_accum_gen13_scaled(&J[39*3], &b[39], jtj_accum, jtb_accum, 1.0);
+      assert_vector_elemeq6(jtj_accum[i], jtj[i]);
+      assert_vector_elemeq3(jtb_accum[i], jtb[i]);
+
+      // and the same jtj with the rank-k update, in 2 pieces
+      double jtj_syrk[6];
+      syrk_genN3_vout(25, J, jtj_syrk);
+      syrk_genN3_vaccum_scaled(15, &J[25*3], jtj_syrk, 2.0);
+      syrk_genN3_vaccum_scaled(15, &J[25*3], jtj_syrk, -1.0);
+      assert_vector_elemeq6(jtj_syrk[i], jtj[i]);
+    }
+    solve_sym33_chol_vout(jtb, u, x_ref);
+    assert_vector_elemeq3(x[i], x_ref[i]);
+
+    double residual2_ref = 0.0;
+    for(int i=0; i<40; i++)
+    {
+      double e = dot_vec(3, &J[i*3], x) - b[i];
+      residual2_ref += e*e;
+    }
+    assert_eq(residual2, residual2_ref);
+  }
+
+  // Cholesky solves
+  {
+    double u[15], x[5], b[5];
+    assert_eq(chol_sym55_vout(s5, u), 0.0); // s5 isn't positive-definite
+
+    // s5 + 5*I is
+    double s5pd[15];
+    memcpy(s5pd, s5, sizeof(s5));
+    for(int i=0; i<5; i++) s5pd[(9-i)*i/2 + i] += 5.0;
+
+    assert_eq(chol_sym55_vout(s5pd, u), 1.0);
+    solve_sym55_chol_vout(a5, u, x);
+    mul_vec5_sym55_vout(x, s5pd, b);
+    assert_vector_elemeq5(b[i], a5[i]);
+
+    // rank-1 update and downdate: s5pd + a5*a5t
+    {
+      double s5up[15], uup[15], uup_ref[15], udown[15];
+      for(int i=0, is=0; i<5; i++)
+        for(int j=i; j<5; j++, is++)
+          s5up[is] = s5pd[is] + a5[i]*a5[j];
+      assert_eq(chol_sym55_vout(s5up, uup_ref), 1.0);
+
+      chol_sym55_update_vout(u, a5, uup);
+      for(int i=0; i<15; i++)
+        assert_eq(uup[i], uup_ref[i]);
+
+      assert_eq(chol_sym55_downdate_vout(uup, a5, udown), 1.0);
+      for(int i=0; i<15; i++)
+        assert_eq(udown[i], u[i]);
+
+      // downdating by a large vector makes the matrix indefinite
+      double big[5];
+      for(int i=0; i<5; i++) big[i] = 10.0*a5[i];
+      assert_eq(chol_sym55_downdate(udown, big), 0.0);
+    }
+
+    // in-place
+    memcpy(u, s5pd, sizeof(s5pd));
+    assert_eq(chol_sym55(u), 1.0);
+    memcpy(x, a5, sizeof(x));
+    solve_sym55_chol(x, u);
+    mul_vec5_sym55_vout(x, s5pd, b);
+    assert_vector_elemeq5(b[i], a5[i]);
+
+    // mixed-precision: factor in float, refine in double. The result should
+    // match the double-precision solve to far better than float precision
+    {
+      double xm[5];
+      assert_eq(solve_sym55_mixed_vout(a5, s5pd, xm), 1.0);
+      for(int i=0; i<5; i++)
+        assert_eq(fabs(xm[i] - x[i]) < 1e-12 ? 1.0 : 0.0, 1.0);
+      assert_eq(solve_sym55_mixed_vout(a5, s5, xm), 0.0);
+    }
+  }
+
+  // Batched Cholesky solves. 11 systems: a full block of MINIMATH_LANES and a
+  // partial one
+  {
+    double s_batch[11*6], v_batch[11*3], x_batch[11*3], det_batch[11];
+    for(int i=0; i<11; i++)
+    {
+      for(int j=0; j<6; j++) s_batch[6*i + j] = m35[j] + (double)i / 10.0;
+      s_batch[6*i + 0] += 3.0;
+      s_batch[6*i + 3] += 3.0;
+      s_batch[6*i + 5] += 3.0;
+      for(int j=0; j<3; j++) v_batch[3*i + j] = a5[j] - (double)i;
+    }
+
+    solve_batchN_sym33_chol(11, s_batch, v_batch, x_batch, det_batch);
+    for(int k=0; k<11; k++)
+    {
+      double b[3], c[6];
+      mul_vec3_sym33_vout(&x_batch[3*k], &s_batch[6*k], b);
+      assert_vector_elemeq3(b[i], v_batch[3*k + i]);
+      assert_eq(det_batch[k], cofactors_sym3(&s_batch[6*k], c));
+    }
+  }
+
+  // AoSoA batches. 11 points in 2 blocks. Each block is processed whole by a
+  // structure-of-arrays kernel, and the results match the contiguous ones
+  {
+    double p[11*3], p_ref[11*3], p_out[11*3];
+    for(int i=0; i<11*3; i++) p[i] = (double)i / 7.0 - 2.0;
+    mul_genN3_gen33_vout(11, p, m53, p_ref);
+
+    aosoa_vec3 blocks[2], blocks_out[2];
+    assert_eq((double)aosoa_nblocks(11),        2.0);
+    assert_eq((double)aosoa_block_lanes(11, 1), (double)(11 - MINIMATH_LANES));
+    aosoa_vec3_pack(11, blocks, p);
+    for(int b=0; b<aosoa_nblocks(11); b++)
+      mul_soaN3_gen33_vout(MINIMATH_LANES, MINIMATH_LANES, blocks[b].x[0], m53, blocks_out[b].x[0]);
+    aosoa_vec3_unpack(11, p_out, blocks_out);
+    for(int i=0; i<11*3; i++) assert_eq(p_out[i], p_ref[i]);
+
+    // the padding lanes are copies of the last point
+    assert_eq(blocks[1].x[2][MINIMATH_LANES-1], p[10*3 + 2]);
+  }
+
+  // LDLt solves
+  {
+    double l[15], x[5], b[5];
+
+    // s5 is indefinite. Only its first pivot is positive
+    assert_eq(ldlt_sym55_vout(s5, l, 1e-10), 1.0);
+
+    // J*Jt for a 5x3 J is semi-definite, with rank 3
+    double jjt[15];
+    for(int i=0, is=0; i<5; i++)
+      for(int j=i; j<5; j++, is++)
+        jjt[is] = m35[i] * m35[j] + m35[5+i] * m35[5+j] + m35[10+i] * m35[10+j];
+    assert_eq(ldlt_sym55_vout(jjt, l, 1e-10), 3.0);
+
+    // the solution still satisfies the system if v is in the range of J*Jt
+    double v[5];
+    mul_vec5_sym55_vout(a5, jjt, v);
+    solve_sym55_ldlt_vout(v, l, x);
+    mul_vec5_sym55_vout(x, jjt, b);
+    assert_vector_elemeq5(b[i], v[i]);
+
+    // full-rank, in-place
+    memcpy(l, jjt, sizeof(jjt));
+    for(int i=0; i<5; i++) l[(9-i)*i/2 + i] += 1.0;
+    assert_eq(ldlt_sym55(l, 1e-10), 5.0);
+    memcpy(x, a5, sizeof(x));
+    solve_sym55_ldlt(x, l);
+    for(int i=0; i<5; i++) jjt[(9-i)*i/2 + i] += 1.0;
+    mul_vec5_sym55_vout(x, jjt, b);
+    assert_vector_elemeq5(b[i], a5[i]);
+  }
+
   // upper/lower triangular inversions.
   {
       /* Comes from this python session:
@@ -400,6 +987,64 @@ In [20]: n = 5; m = np.tril(np.random.rand(n,n)); print m; print np.linalg.inv(m
       }
   }
 
+  // robust inverses. rcond_min = 1 forces the pivoted fallback, which should
+  // produce the same inverse as the cofactors
+  {
+    double ut[]      = {0.69412981,0.77539124,0.55602195,0.97512905,0.38083716,0.05308887,0.53878659,0.65848863,0.11064253,0.85354224};
+    double ut_inv[]  = {1.44065272,-2.93319458,-0.97999346,0.33269888,2.62579416,-0.21169756,-1.63005399,1.5186291,-0.19685606,1.17158817};
+    double inv[15], inv_pivoted[15];
+
+    assert_eq(inverse_ut4_robust(ut, inv,         1e-8) > 0.0 ? 1.0 : 0.0, 1.0);
+    assert_eq(inverse_ut4_robust(ut, inv_pivoted, 1.0)  > 0.0 ? 1.0 : 0.0, 1.0);
+    for(int i=0; i<10; i++)
+    {
+      assert_eq(inv[i],         ut_inv[i]);
+      assert_eq(inv_pivoted[i], ut_inv[i]);
+    }
+
+    const double rcond = inverse_sym5_robust(s5, inv, 1e-8);
+    assert_eq(inverse_sym5_robust(s5, inv_pivoted, 1.0), rcond);
+    for(int i=0; i<15; i++)
+      assert_eq(inv_pivoted[i], inv[i]);
+
+    // nearly-singular: the cofactors are inaccurate, but the pivoted inverse is
+    // still a good inverse
+    double m[]  = {1,2,3, 4,5,6, 7,8,9.000000001};
+    double m0[] = {1,0,3, 4,0,6, 7,0,9};
+    double minv[9];
+    assert_eq(inverse_gen33_robust(m, minv, 1e-8) < 1e-8 ? 1.0 : 0.0, 1.0);
+    for(int i=0; i<3; i++)
+      for(int j=0; j<3; j++)
+        assert_eq(m[i*3+0]*minv[0*3+j] + m[i*3+1]*minv[1*3+j] + m[i*3+2]*minv[2*3+j],
+                  i == j ? 1.0 : 0.0);
+
+    // singular
+    assert_eq(inverse_gen33_robust(m0, minv, 1e-8), 0.0);
+  }
+
+  // single-precision flavors. Same routines, with an _f suffix
+  {
+    float a5f[5], s5f[15], m53f[15], v5f[5], v3f[3];
+    for(int i=0; i<5;  i++) a5f[i]  = (float)a5[i];
+    for(int i=0; i<15; i++) s5f[i]  = (float)s5[i];
+    for(int i=0; i<15; i++) m53f[i] = (float)m53[i];
+
+    assert_eq( norm2_vec_f(5, a5f), 1.31977481447686 );
+
+    mul_vec5_sym55_vout_f(a5f, s5f, v5f);
+    assert_vector_elemeq5(v5f[i], a_x_s[i]);
+
+    mul_vec5_gen53_vout_scaled_f(a5f, m53f, v3f, -3.0f);
+    assert_vector_elemeq3(v3f[i], -3.0*a_x_m53[i]);
+
+    float s3f[] =
+      { 0.471011f, 1.6661985f , 0.98615889f,
+                   0.32707543f, 1.0342404f,
+                                0.49936779f};
+    float cofactors[6];
+    assert_eq(cofactors_sym3_f(s3f, cofactors), 1.26747089766342);
+  }
+
   // det of orthornormal matrices
   {
       {